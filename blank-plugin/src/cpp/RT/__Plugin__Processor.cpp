@@ -13,7 +13,7 @@ namespace [-namespace-]::RT {
 //------------------------------------------------------------------------
 // Constructor
 //------------------------------------------------------------------------
-[-name-]Processor::[-name-]Processor() : RTProcessor([-name-]ControllerUID), fParams{}, fState{fParams}
+[-name-]Processor::[-name-]Processor() : RTKernelProcessor([-name-]ControllerUID), fParams{}, fState{fParams}
 {
   DLOG_F(INFO, "[%s] [-name-]Processor() - jamba: %s - plugin: v%s (%s)",
          stringPluginName,
@@ -25,6 +25,9 @@ namespace [-namespace-]::RT {
 #ifndef NDEBUG
   DLOG_F(INFO, "Parameters ---> \n%s", Debug::ParamTable::from(fParams).full().toString().c_str());
 #endif
+
+  // the bypass is handled by the framework (crossfade, processKernel not called when bypassed)
+  enableBypass(fState.fBypass);
 }
 
 //------------------------------------------------------------------------
@@ -42,7 +45,7 @@ tresult [-name-]Processor::initialize(FUnknown *context)
 {
   DLOG_F(INFO, "[-name-]Processor::initialize()");
 
-  tresult result = RTProcessor::initialize(context);
+  tresult result = RTKernelProcessor::initialize(context);
   if(result != kResultOk)
   {
     return result;
@@ -74,7 +77,7 @@ tresult [-name-]Processor::terminate()
 {
   DLOG_F(INFO, "[-name-]Processor::terminate()");
 
-  return RTProcessor::terminate();
+  return RTKernelProcessor::terminate();
 }
 
 //------------------------------------------------------------------------
@@ -82,7 +85,7 @@ tresult [-name-]Processor::terminate()
 //------------------------------------------------------------------------
 tresult [-name-]Processor::setupProcessing(ProcessSetup &setup)
 {
-  tresult result = RTProcessor::setupProcessing(setup);
+  tresult result = RTKernelProcessor::setupProcessing(setup);
 
   if(result != kResultOk)
     return result;
@@ -98,11 +101,11 @@ tresult [-name-]Processor::setupProcessing(ProcessSetup &setup)
 }
 
 //------------------------------------------------------------------------
-// [-name-]Processor::genericProcessInputs
+// [-name-]Processor::processKernel
 // Implementation of the generic (32 and 64 bits) logic.
 //------------------------------------------------------------------------
 template<typename SampleType>
-tresult [-name-]Processor::genericProcessInputs(ProcessData &data)
+tresult [-name-]Processor::processKernel(ProcessData &data)
 {
   if(data.numInputs == 0 || data.numOutputs == 0)
   {
@@ -116,7 +119,7 @@ tresult [-name-]Processor::genericProcessInputs(ProcessData &data)
   // simply copy input into output
   out.copyFrom(in);
   
-  // use fState.fBypass to disable plugin effect...
+  // fState.fBypass is handled by the framework (see enableBypass in the constructor)
 
   return kResultOk;
 }
@@ -1,7 +1,7 @@
 #ifndef VST3_JAMBA_[-name-]_RT_PROCESSOR_H
 #define VST3_JAMBA_[-name-]_RT_PROCESSOR_H
 
-#include <pongasoft/VST/RT/RTProcessor.h>
+#include <pongasoft/VST/RT/RTKernelProcessor.h>
 #include "../Plugin.h"
 
 namespace [-namespace-]::RT {
@@ -11,7 +11,7 @@ using namespace pongasoft::VST::RT;
 //------------------------------------------------------------------------
 // [-name-]Processor - Real Time Processor
 //------------------------------------------------------------------------
-class [-name-]Processor : public RTProcessor
+class [-name-]Processor : public RTKernelProcessor<[-name-]Processor>
 {
 public:
   //------------------------------------------------------------------------
@@ -43,17 +43,9 @@ public:
   // This is where the setup happens which depends on sample rate, etc..
   tresult PLUGIN_API setupProcessing(ProcessSetup &setup) override;
 
-protected:
-
-  // genericProcessInputs<SampleType>
+  // processKernel<SampleType> (called by RTKernelProcessor for 32 and 64 bits processing)
   template<typename SampleType>
-  tresult genericProcessInputs(ProcessData &data);
-
-  // processInputs32Bits
-  tresult processInputs32Bits(ProcessData &data) override { return genericProcessInputs<Sample32>(data); }
-
-  // processInputs64Bits
-  tresult processInputs64Bits(ProcessData &data) override { return genericProcessInputs<Sample64>(data); }
+  tresult processKernel(ProcessData &data);
 
 private:
   // The processor gets a copy of the parameters (defined in Plugin.h)
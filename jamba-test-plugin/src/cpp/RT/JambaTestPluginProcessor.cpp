@@ -31,7 +31,7 @@ namespace pongasoft::test::jamba::RT {
 //------------------------------------------------------------------------
 // Constructor
 //------------------------------------------------------------------------
-JambaTestPluginProcessor::JambaTestPluginProcessor() : RTProcessor(JambaTestPluginControllerUID), fParams{}, fState{fParams}
+JambaTestPluginProcessor::JambaTestPluginProcessor() : RTKernelProcessor(JambaTestPluginControllerUID), fParams{}, fState{fParams}
 {
   DLOG_F(INFO, "[%s] JambaTestPluginProcessor() - jamba: %s - plugin: v%s (%s)",
          stringPluginName,
@@ -43,6 +43,9 @@ JambaTestPluginProcessor::JambaTestPluginProcessor() : RTProcessor(JambaTestPlug
 #ifndef NDEBUG
   DLOG_F(INFO, "Parameters ---> \n%s", Debug::ParamTable::from(fParams).full().toString().c_str());
 #endif
+
+  // the bypass is handled by the framework (crossfade, processKernel not called when bypassed)
+  enableBypass(fState.fBypass);
 }
 
 //------------------------------------------------------------------------
@@ -60,7 +63,7 @@ tresult JambaTestPluginProcessor::initialize(FUnknown *context)
 {
   DLOG_F(INFO, "JambaTestPluginProcessor::initialize()");
 
-  tresult result = RTProcessor::initialize(context);
+  tresult result = RTKernelProcessor::initialize(context);
   if(result != kResultOk)
   {
     return result;
@@ -92,7 +95,7 @@ tresult JambaTestPluginProcessor::terminate()
 {
   DLOG_F(INFO, "JambaTestPluginProcessor::terminate()");
 
-  return RTProcessor::terminate();
+  return RTKernelProcessor::terminate();
 }
 
 //------------------------------------------------------------------------
@@ -100,7 +103,7 @@ tresult JambaTestPluginProcessor::terminate()
 //------------------------------------------------------------------------
 tresult JambaTestPluginProcessor::setupProcessing(ProcessSetup &setup)
 {
-  tresult result = RTProcessor::setupProcessing(setup);
+  tresult result = RTKernelProcessor::setupProcessing(setup);
 
   if(result != kResultOk)
     return result;
@@ -116,11 +119,11 @@ tresult JambaTestPluginProcessor::setupProcessing(ProcessSetup &setup)
 }
 
 //------------------------------------------------------------------------
-// JambaTestPluginProcessor::genericProcessInputs
+// JambaTestPluginProcessor::processKernel
 // Implementation of the generic (32 and 64 bits) logic.
 //------------------------------------------------------------------------
 template<typename SampleType>
-tresult JambaTestPluginProcessor::genericProcessInputs(ProcessData &data)
+tresult JambaTestPluginProcessor::processKernel(ProcessData &data)
 {
   if(data.numInputs == 0 || data.numOutputs == 0)
   {
@@ -134,7 +137,7 @@ tresult JambaTestPluginProcessor::genericProcessInputs(ProcessData &data)
   // simply copy input into output
   out.copyFrom(in);
   
-  // use fState.fBypass to disable plugin effect...
+  // fState.fBypass is handled by the framework (see enableBypass in the constructor)
 
   return kResultOk;
 }
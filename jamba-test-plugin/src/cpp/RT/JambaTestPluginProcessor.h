@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include <pongasoft/VST/RT/RTProcessor.h>
+#include <pongasoft/VST/RT/RTKernelProcessor.h>
 #include "../Plugin.h"
 
 namespace pongasoft::test::jamba::RT {
@@ -28,7 +28,7 @@ using namespace pongasoft::VST::RT;
 //------------------------------------------------------------------------
 // JambaTestPluginProcessor - Real Time Processor
 //------------------------------------------------------------------------
-class JambaTestPluginProcessor : public RTProcessor
+class JambaTestPluginProcessor : public RTKernelProcessor<JambaTestPluginProcessor>
 {
 public:
   static inline ::Steinberg::FUID UUID() { return JambaTestPluginProcessorUID; };
@@ -58,17 +58,9 @@ public:
   // This is where the setup happens which depends on sample rate, etc..
   tresult PLUGIN_API setupProcessing(ProcessSetup &setup) override;
 
-protected:
-
-  // genericProcessInputs<SampleType>
+  // processKernel<SampleType> (called by RTKernelProcessor for 32 and 64 bits processing)
   template<typename SampleType>
-  tresult genericProcessInputs(ProcessData &data);
-
-  // processInputs32Bits
-  tresult processInputs32Bits(ProcessData &data) override { return genericProcessInputs<Sample32>(data); }
-
-  // processInputs64Bits
-  tresult processInputs64Bits(ProcessData &data) override { return genericProcessInputs<Sample64>(data); }
+  tresult processKernel(ProcessData &data);
 
 private:
   // The processor gets a copy of the parameters (defined in Plugin.h)
@@ -18,30 +18,76 @@
 #ifndef __PONGASOFT_UTILS_COLLECTION_CIRCULAR_BUFFER_H__
 #define __PONGASOFT_UTILS_COLLECTION_CIRCULAR_BUFFER_H__
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <memory>
 
 namespace pongasoft {
 namespace Utils {
 namespace Collection {
 
+/**
+ * A fixed size circular buffer, where offset `0` is the head (the oldest element, which is the one `push` replaces)
+ * and offset `-1` is the most recently pushed element. Offsets (positive or negative) wrap around.
+ *
+ * When the size is a power of 2 (see `nextPowerOfTwo`), indices are computed with a mask instead of the (slower)
+ * wrapping loops.
+ *
+ * For block processing (delay lines, scopes...), `pushBlock` pushes an entire audio block and `getSpans` exposes any
+ * range as (at most) 2 contiguous spans so that the caller can run (vectorizable) loops without any wrap check:
+ *
+ * ```
+ * auto spans = buffer.getSpans(-windowSize, windowSize); // the last windowSize elements (oldest first)
+ * for(int i = 0; i < spans.fFirstSize; i++) sum += spans.fFirst[i];
+ * for(int i = 0; i < spans.fSecondSize; i++) sum += spans.fSecond[i];
+ * ```
+ */
 template<typename T>
 class CircularBuffer
 {
 public:
-  explicit CircularBuffer(int iSize) : fSize(iSize), fStart(0)
+  /**
+   * A range of elements as 2 contiguous spans (the second one being empty when the range does not wrap around) */
+  template<typename U>
+  struct TwoSpans
+  {
+    U *fFirst;
+    int fFirstSize;
+    U *fSecond;
+    int fSecondSize;
+
+    inline int size() const { return fFirstSize + fSecondSize; }
+  };
+
+public:
+  explicit CircularBuffer(int iSize) : fSize(iSize), fStart(0), fMask(computeMask(iSize))
   {
     assert(fSize > 0);
 
     fBuf = new T[iSize];
   };
 
-  CircularBuffer(CircularBuffer const& iOther) : fSize(iOther.fSize), fStart(iOther.fStart)
+  CircularBuffer(CircularBuffer const& iOther) : fSize(iOther.fSize), fStart(iOther.fStart), fMask(iOther.fMask)
   {
     fBuf = new T[fSize];
     memcpy(fBuf, iOther.fBuf, fSize * sizeof(T));
   }
 
+  /**
+   * @return the smallest power of 2 greater or equal to `iSize` (use as the size of the buffer to enable mask
+   *         indexing) */
+  static constexpr int nextPowerOfTwo(int iSize)
+  {
+    int res = 1;
+    while(res < iSize)
+      res <<= 1;
+    return res;
+  }
+
+  // whether the size is a power of 2 (mask indexing)
+  inline bool isPowerOfTwo() const { return fMask != -1; }
+
   ~CircularBuffer()
   {
     delete[] fBuf;
@@ -74,6 +120,49 @@ public:
     incrementHead();
   }
 
+  /**
+   * Pushes `iSize` elements at once (same result as calling `push` for each element, in order). When `iSize` is
+   * bigger than the size of the buffer, only the last `getSize()` elements are kept. */
+  inline void pushBlock(T const *iBlock, int iSize)
+  {
+    assert(iSize >= 0);
+
+    if(iSize > fSize)
+    {
+      // the first elements would be overwritten anyway
+      fStart = adjustIndex(fStart + (iSize - fSize));
+      iBlock += iSize - fSize;
+      iSize = fSize;
+    }
+
+    auto spans = getSpans(0, iSize);
+    std::copy(iBlock, iBlock + spans.fFirstSize, spans.fFirst);
+    std::copy(iBlock + spans.fFirstSize, iBlock + iSize, spans.fSecond);
+    fStart = adjustIndex(fStart + iSize);
+  }
+
+  /**
+   * Returns the `iSize` elements starting at `startOffset` (in increasing offset order) as (at most) 2 contiguous
+   * spans. `iSize` must be in `[0, getSize()]`.
+   */
+  inline TwoSpans<T const> getSpans(int startOffset, int iSize) const
+  {
+    int first, second;
+    auto start = computeSpans(startOffset, iSize, first, second);
+    return {fBuf + start, first, fBuf, second};
+  }
+
+  /**
+   * Returns the `iSize` elements starting at `startOffset` (in increasing offset order) as (at most) 2 contiguous
+   * spans which can be modified. `iSize` must be in `[0, getSize()]`.
+   */
+  inline TwoSpans<T> getSpans(int startOffset, int iSize)
+  {
+    int first, second;
+    auto start = computeSpans(startOffset, iSize, first, second);
+    return {fBuf + start, first, fBuf, second};
+  }
+
   inline void init(T initValue)
   {
     for(int i = 0; i < fSize; ++i)
@@ -84,14 +173,15 @@ public:
 
   inline void copyToBuffer(int startOffset, T *oBuffer, int iSize)
   {
-    int adjStartOffset = adjustIndexFromOffset(startOffset);
-
-    if(adjStartOffset + iSize < fSize)
+    if(iSize <= fSize)
     {
-      memcpy(oBuffer, &fBuf[adjStartOffset], iSize * sizeof(T));
+      auto spans = getSpans(startOffset, iSize);
+      std::copy(spans.fFirst, spans.fFirst + spans.fFirstSize, oBuffer);
+      std::copy(spans.fSecond, spans.fSecond + spans.fSecondSize, oBuffer + spans.fFirstSize);
     }
     else
     {
+      int adjStartOffset = adjustIndexFromOffset(startOffset);
       int i = adjStartOffset;
       for(int k = 0; k < iSize; k++)
       {
@@ -134,6 +224,17 @@ public:
 
     U resultValue = initValue;
 
+    // most frequent case => no wrap check
+    if(startOffset < endOffsetNotIncluded && endOffsetNotIncluded - startOffset <= fSize)
+    {
+      auto spans = getSpans(startOffset, endOffsetNotIncluded - startOffset);
+      for(int k = 0; k < spans.fFirstSize; k++)
+        resultValue = op(resultValue, spans.fFirst[k]);
+      for(int k = 0; k < spans.fSecondSize; k++)
+        resultValue = op(resultValue, spans.fSecond[k]);
+      return resultValue;
+    }
+
     int i = adjustIndexFromOffset(startOffset);
 
     if(startOffset < endOffsetNotIncluded)
@@ -196,6 +297,18 @@ public:
 
     U resultValue = initValue;
 
+    // most frequent case => no wrap check
+    if(startOffset < endOffsetNotIncluded && endOffsetNotIncluded - startOffset <= fSize)
+    {
+      auto spans = getSpans(startOffset, endOffsetNotIncluded - startOffset);
+      int index = startOffset;
+      for(int k = 0; k < spans.fFirstSize; k++)
+        resultValue = op(index++, resultValue, spans.fFirst[k]);
+      for(int k = 0; k < spans.fSecondSize; k++)
+        resultValue = op(index++, resultValue, spans.fSecond[k]);
+      return resultValue;
+    }
+
     int i = adjustIndexFromOffset(startOffset);
     int index = startOffset;
 
@@ -256,8 +369,29 @@ private:
     return adjustIndex(fStart + offset);
   }
 
+  // computeSpans => returns the index of the first span
+  inline int computeSpans(int startOffset, int iSize, int &oFirstSize, int &oSecondSize) const
+  {
+    assert(iSize >= 0 && iSize <= fSize);
+
+    int start = adjustIndexFromOffset(startOffset);
+    oFirstSize = std::min(iSize, fSize - start);
+    oSecondSize = iSize - oFirstSize;
+    return start;
+  }
+
+  // computeMask => size - 1 for a power of 2, -1 otherwise
+  static constexpr int computeMask(int iSize)
+  {
+    return iSize > 0 && (iSize & (iSize - 1)) == 0 ? iSize - 1 : -1;
+  }
+
   inline int adjustIndex(int index) const
   {
+    // power of 2 => works for negative indices as well (2's complement)
+    if(fMask != -1)
+      return index & fMask;
+
     // shortcut since this is a frequent use case
     if(index == fSize)
       return 0;
@@ -274,6 +408,7 @@ private:
   int fSize;
   T *fBuf;
   int fStart;
+  int fMask;
 };
 
 }
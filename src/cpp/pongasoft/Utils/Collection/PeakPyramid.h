@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#ifndef __PONGASOFT_UTILS_COLLECTION_PEAK_PYRAMID_H__
+#define __PONGASOFT_UTILS_COLLECTION_PEAK_PYRAMID_H__
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// SSE is always available on x86_64 (define JAMBA_PEAK_PYRAMID_SSE to 0 to force the scalar implementation)
+#ifndef JAMBA_PEAK_PYRAMID_SSE
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define JAMBA_PEAK_PYRAMID_SSE 1
+#else
+#define JAMBA_PEAK_PYRAMID_SSE 0
+#endif
+#endif
+
+#if JAMBA_PEAK_PYRAMID_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace pongasoft {
+namespace Utils {
+namespace Collection {
+
+/**
+ * The summary (min / max / RMS) of a range of samples */
+template<typename T>
+struct Peak
+{
+  T fMin{std::numeric_limits<T>::max()};
+  T fMax{std::numeric_limits<T>::lowest()};
+  double fSumOfSquares{0};
+  uint32_t fCount{0};
+
+  // isEmpty (no sample)
+  inline bool isEmpty() const { return fCount == 0; }
+
+  // getRMS
+  inline T getRMS() const { return fCount == 0 ? 0 : static_cast<T>(std::sqrt(fSumOfSquares / fCount)); }
+
+  // merge (the result is the summary of both ranges)
+  inline void merge(Peak const &iOther)
+  {
+    fMin = std::min(fMin, iOther.fMin);
+    fMax = std::max(fMax, iOther.fMax);
+    fSumOfSquares += iOther.fSumOfSquares;
+    fCount += iOther.fCount;
+  }
+};
+
+namespace impl {
+
+/**
+ * Computes the peak of `iCount` samples. The scalar version uses 4 independent accumulators (no loop carried
+ * dependency) so that the compiler can vectorize it. */
+template<typename T>
+inline Peak<T> computePeak(T const *iSamples, size_t iCount)
+{
+  Peak<T> res{};
+  if(iCount == 0)
+    return res;
+
+  size_t i = 0;
+
+#if JAMBA_PEAK_PYRAMID_SSE
+  if constexpr(std::is_same_v<T, float>)
+  {
+    if(iCount >= 4)
+    {
+      __m128 vMin = _mm_set1_ps(res.fMin);
+      __m128 vMax = _mm_set1_ps(res.fMax);
+      __m128 vSum = _mm_setzero_ps();
+      for(; i + 4 <= iCount; i += 4)
+      {
+        __m128 v = _mm_loadu_ps(iSamples + i);
+        vMin = _mm_min_ps(vMin, v);
+        vMax = _mm_max_ps(vMax, v);
+        vSum = _mm_add_ps(vSum, _mm_mul_ps(v, v));
+      }
+      alignas(16) float mins[4], maxs[4], sums[4];
+      _mm_store_ps(mins, vMin);
+      _mm_store_ps(maxs, vMax);
+      _mm_store_ps(sums, vSum);
+      for(int k = 0; k < 4; k++)
+      {
+        res.fMin = std::min(res.fMin, mins[k]);
+        res.fMax = std::max(res.fMax, maxs[k]);
+        res.fSumOfSquares += sums[k];
+      }
+    }
+  }
+#endif
+
+  if(iCount - i >= 4)
+  {
+    T mins[4]{res.fMin, res.fMin, res.fMin, res.fMin};
+    T maxs[4]{res.fMax, res.fMax, res.fMax, res.fMax};
+    T sums[4]{};
+    for(; i + 4 <= iCount; i += 4)
+    {
+      for(int k = 0; k < 4; k++)
+      {
+        auto s = iSamples[i + k];
+        mins[k] = std::min(mins[k], s);
+        maxs[k] = std::max(maxs[k], s);
+        sums[k] += s * s;
+      }
+    }
+    for(int k = 0; k < 4; k++)
+    {
+      res.fMin = std::min(res.fMin, mins[k]);
+      res.fMax = std::max(res.fMax, maxs[k]);
+      res.fSumOfSquares += sums[k];
+    }
+  }
+
+  for(; i < iCount; i++)
+  {
+    auto s = iSamples[i];
+    res.fMin = std::min(res.fMin, s);
+    res.fMax = std::max(res.fMax, s);
+    res.fSumOfSquares += static_cast<double>(s) * s;
+  }
+
+  res.fCount = static_cast<uint32_t>(iCount);
+  return res;
+}
+
+}
+
+/**
+ * A multi resolution summary of a (growing) sequence of samples, meant for drawing waveforms at any zoom level
+ * without scanning all the samples on every redraw.
+ *
+ * Level `0` stores one `Peak` (min / max / RMS) per bucket of `getBaseBucketSize()` samples, and each level above
+ * summarizes 2 buckets of the level below (level `n` => buckets of `getBaseBucketSize() << n` samples). The memory
+ * used is roughly `2 * numSamples / baseBucketSize` peaks.
+ *
+ * Samples are added with `append` (incrementally: only the last bucket of each level is recomputed, so recording or
+ * streaming audio is cheap) and `getPeaks` computes one peak per pixel for any offset / zoom by picking the level
+ * whose bucket size is just below the number of samples per pixel, so it costs O(pixels) independently of the
+ * number of samples:
+ *
+ * ```
+ * // whenever the sample changes
+ * fPyramid.build(sample.data(), sample.size());
+ *
+ * // in draw (offset and zoom coming from a ScrollbarView for example)
+ * auto width = static_cast<size_t>(getWidth());
+ * fPeaks.resize(width);
+ * fPyramid.getPeaks(offsetInSamples, samplesPerPixel, fPeaks.data(), width, sample.data());
+ * ```
+ *
+ * Note that the peak of a pixel is computed from whole buckets, so it may include a few samples from the neighboring
+ * pixels (which is invisible on screen). When zoomed in further than the base bucket size, providing the samples to
+ * `getPeaks` makes it scan the samples directly (exact result, at most `getBaseBucketSize()` samples per pixel).
+ *
+ * @tparam T the type of the samples (usually `float` or `double`) */
+template<typename T = float>
+class PeakPyramid
+{
+public:
+  using value_type = T;
+  using PeakType = Peak<T>;
+
+  //! Default number of samples summarized by a bucket of level 0
+  static constexpr size_t kDefaultBaseBucketSize = 64;
+
+public:
+  /**
+   * @param iBaseBucketSize number of samples summarized by a bucket of level 0 (must be a power of 2) */
+  explicit PeakPyramid(size_t iBaseBucketSize = kDefaultBaseBucketSize) :
+    fBaseBucketSize{iBaseBucketSize}
+  {
+    assert(iBaseBucketSize > 0 && (iBaseBucketSize & (iBaseBucketSize - 1)) == 0);
+  }
+
+  // getBaseBucketSize
+  inline size_t getBaseBucketSize() const { return fBaseBucketSize; }
+
+  // getSampleCount
+  inline size_t getSampleCount() const { return fSampleCount; }
+
+  // getLevelCount
+  inline size_t getLevelCount() const { return fLevels.size(); }
+
+  // getBucketSize (number of samples per bucket for the level)
+  inline size_t getBucketSize(size_t iLevel) const { return fBaseBucketSize << iLevel; }
+
+  // getLevel (the last bucket of a level may be partial)
+  inline std::vector<PeakType> const &getLevel(size_t iLevel) const { return fLevels[iLevel]; }
+
+  //! Removes all the samples
+  void clear()
+  {
+    fLevels.clear();
+    fSampleCount = 0;
+  }
+
+  //! Replaces the content with the samples provided
+  void build(T const *iSamples, size_t iCount)
+  {
+    clear();
+    if(iCount > 0)
+      fLevels.reserve(computeLevelCount(iCount));
+    append(iSamples, iCount);
+  }
+
+  /**
+   * Appends samples: only the buckets affected are recomputed (amortized O(iCount / baseBucketSize + levels) on top
+   * of reading the samples) */
+  void append(T const *iSamples, size_t iCount)
+  {
+    if(iCount == 0)
+      return;
+
+    if(fLevels.empty())
+      fLevels.emplace_back();
+
+    auto &level0 = fLevels[0];
+
+    // index of the first bucket modified (the last one if it is partial)
+    auto firstDirty = fSampleCount / fBaseBucketSize;
+
+    while(iCount > 0)
+    {
+      auto offsetInBucket = fSampleCount % fBaseBucketSize;
+      if(offsetInBucket == 0)
+        level0.emplace_back();
+      auto count = std::min(iCount, fBaseBucketSize - offsetInBucket);
+      level0.back().merge(impl::computePeak(iSamples, count));
+      iSamples += count;
+      iCount -= count;
+      fSampleCount += count;
+    }
+
+    // propagate to the levels above (only the buckets which depend on the modified ones)
+    for(size_t l = 1; fLevels[l - 1].size() > 1; l++)
+    {
+      firstDirty /= 2;
+      if(l == fLevels.size())
+        fLevels.emplace_back();
+
+      auto const &below = fLevels[l - 1];
+      auto &level = fLevels[l];
+      level.resize((below.size() + 1) / 2);
+      for(auto i = firstDirty; i < level.size(); i++)
+      {
+        auto peak = below[2 * i];
+        if(2 * i + 1 < below.size())
+          peak.merge(below[2 * i + 1]);
+        level[i] = peak;
+      }
+    }
+  }
+
+  /**
+   * Computes the peak of the samples `[iFromSample, iToSample)` using the coarsest level whose buckets fit in the
+   * range (rounded to whole buckets). */
+  PeakType getPeak(size_t iFromSample, size_t iToSample) const
+  {
+    iToSample = std::min(iToSample, fSampleCount);
+    if(iFromSample >= iToSample)
+      return {};
+    return computePeak(findLevel(iToSample - iFromSample), iFromSample, iToSample);
+  }
+
+  /**
+   * Computes one peak per pixel, where pixel `p` covers the samples
+   * `[iStartSample + p * iSamplesPerPixel, iStartSample + (p + 1) * iSamplesPerPixel)`. Pixels outside the samples
+   * get an empty peak (`Peak::isEmpty()`).
+   *
+   * @param iSamples (optional) the samples used to build the pyramid: when provided and `iSamplesPerPixel` is
+   *                 smaller than the base bucket size, the peaks are computed from the samples (exact) instead of
+   *                 from the (coarser) level 0 */
+  void getPeaks(double iStartSample,
+                double iSamplesPerPixel,
+                PeakType *oPeaks,
+                size_t iNumPixels,
+                T const *iSamples = nullptr) const
+  {
+    if(iNumPixels == 0)
+      return;
+
+    iSamplesPerPixel = std::max(iSamplesPerPixel, std::numeric_limits<double>::min());
+
+    auto level = findLevel(static_cast<size_t>(std::max(1.0, iSamplesPerPixel)));
+    bool fromSamples = iSamples != nullptr && iSamplesPerPixel < static_cast<double>(fBaseBucketSize);
+
+    auto sampleCount = static_cast<double>(fSampleCount);
+
+    for(size_t p = 0; p < iNumPixels; p++)
+    {
+      auto from = iStartSample + p * iSamplesPerPixel;
+      auto to = from + iSamplesPerPixel;
+
+      if(to <= 0 || from >= sampleCount)
+      {
+        oPeaks[p] = {};
+        continue;
+      }
+
+      auto fromSample = static_cast<size_t>(std::max(0.0, std::floor(from)));
+      auto toSample = static_cast<size_t>(std::min(sampleCount, std::ceil(to)));
+      if(toSample <= fromSample)
+        toSample = fromSample + 1;
+
+      if(fromSamples)
+        oPeaks[p] = impl::computePeak(iSamples + fromSample, toSample - fromSample);
+      else
+        oPeaks[p] = computePeak(level, fromSample, toSample);
+    }
+  }
+
+private:
+  // computeLevelCount
+  size_t computeLevelCount(size_t iSampleCount) const
+  {
+    size_t res = 1;
+    for(auto buckets = (iSampleCount + fBaseBucketSize - 1) / fBaseBucketSize; buckets > 1; buckets = (buckets + 1) / 2)
+      res++;
+    return res;
+  }
+
+  // findLevel (the coarsest level whose bucket size is <= iSampleCount)
+  size_t findLevel(size_t iSampleCount) const
+  {
+    size_t level = 0;
+    while(level + 1 < fLevels.size() && getBucketSize(level + 1) <= iSampleCount)
+      level++;
+    return level;
+  }
+
+  // computePeak (from the buckets of a level overlapping [iFromSample, iToSample))
+  PeakType computePeak(size_t iLevel, size_t iFromSample, size_t iToSample) const
+  {
+    PeakType res{};
+    if(fLevels.empty())
+      return res;
+
+    auto const &level = fLevels[iLevel];
+    auto bucketSize = getBucketSize(iLevel);
+    auto last = std::min((iToSample - 1) / bucketSize, level.size() - 1);
+    for(auto b = iFromSample / bucketSize; b <= last; b++)
+      res.merge(level[b]);
+    return res;
+  }
+
+private:
+  size_t fBaseBucketSize;
+  size_t fSampleCount{0};
+  std::vector<std::vector<PeakType>> fLevels{};
+};
+
+}
+}
+}
+
+#endif // __PONGASOFT_UTILS_COLLECTION_PEAK_PYRAMID_H__
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#ifndef __PONGASOFT_UTILS_COLLECTION_SPSC_RING_BUFFER_H__
+#define __PONGASOFT_UTILS_COLLECTION_SPSC_RING_BUFFER_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace pongasoft {
+namespace Utils {
+namespace Collection {
+
+/**
+ * A lock free ring buffer with a single producer thread (ex: the RT thread) and a single consumer thread (ex: the UI
+ * thread) meant to stream a continuous flow of samples (scopes, spectrum analyzers...), which `CircularBuffer` (single
+ * threaded) and `SingleElementQueue` (latest value only) cannot do.
+ *
+ * The policy is **overwrite oldest**: the producer never blocks, never fails and never even looks at where the
+ * consumer is. A consumer which falls behind by more than `getCapacity()` elements simply loses the oldest ones
+ * (accounted for in `getDroppedCount()`), which is what a GUI wants (it only cares about the most recent samples).
+ *
+ * Both sides work on blocks (`write` / `read`) and copy (at most) 2 contiguous spans with `memcpy`, so the cost is
+ * independent of the number of elements. The indices are 64 bits (they never wrap) and live on separate cache lines
+ * so that the producer and consumer do not invalidate each other's cache line on every access.
+ *
+ * Implementation note: since the producer never waits, it may overwrite a span while the consumer is copying it. The
+ * consumer detects it (seqlock style: the producer publishes how far it is about to write *before* writing) and
+ * discards the elements that may have been overwritten, so `read` only ever returns consistent data. This is the
+ * reason why `T` must be trivially copyable.
+ *
+ * ```
+ * // RT (processing thread)
+ * fRing->write(out.getBuffer(), numSamples);
+ *
+ * // GUI (timer or draw)
+ * auto count = fRing->readLatest(fSamples.data(), fSamples.size());
+ * ```
+ *
+ * @tparam T the type of the elements (must be trivially copyable, usually `float` or `double`) */
+template<typename T>
+class SPSCRingBuffer
+{
+  static_assert(std::is_trivially_copyable_v<T>, "SPSCRingBuffer requires a trivially copyable type");
+
+public:
+  using value_type = T;
+
+  //! Size used for padding the indices (most common cache line size)
+  static constexpr size_t kCacheLineSize = 64;
+
+public:
+  /**
+   * @param iMinCapacity the minimum number of elements the buffer can hold (rounded up to a power of 2) */
+  explicit SPSCRingBuffer(size_t iMinCapacity) :
+    fCapacity{nextPowerOfTwo(iMinCapacity)},
+    fMask{fCapacity - 1},
+    fBuffer{new T[fCapacity]{}}
+  {
+  }
+
+  // shared between 2 threads => no copy
+  SPSCRingBuffer(SPSCRingBuffer const &) = delete;
+  SPSCRingBuffer &operator=(SPSCRingBuffer const &) = delete;
+
+  //! @return the smallest power of 2 greater or equal to `iSize`
+  static constexpr size_t nextPowerOfTwo(size_t iSize)
+  {
+    size_t res = 1;
+    while(res < iSize)
+      res <<= 1;
+    return res;
+  }
+
+  // getCapacity
+  inline size_t getCapacity() const { return fCapacity; }
+
+  //------------------------------------------------------------------------------------------------------------
+  // WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
+  //
+  // All the following methods (write / push) should be called in a single thread (the producer)
+  //
+  // WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
+  //------------------------------------------------------------------------------------------------------------
+
+  /**
+   * Writes `iCount` elements. Never blocks and never fails: when `iCount` is bigger than the capacity, only the last
+   * `getCapacity()` elements are written (the other ones are considered written and immediately overwritten). */
+  void write(T const *iData, size_t iCount)
+  {
+    if(iCount == 0)
+      return;
+
+    auto index = fWriteIndex.load(std::memory_order_relaxed);
+
+    if(iCount > fCapacity)
+    {
+      index += iCount - fCapacity;
+      iData += iCount - fCapacity;
+      iCount = fCapacity;
+    }
+
+    auto end = index + iCount;
+
+    // announce which slots are about to be overwritten (for the consumer to validate what it copied)
+    fClaimIndex.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto start = static_cast<size_t>(index & fMask);
+    auto firstSize = std::min(iCount, fCapacity - start);
+    std::memcpy(fBuffer.get() + start, iData, firstSize * sizeof(T));
+    if(firstSize < iCount)
+      std::memcpy(fBuffer.get(), iData + firstSize, (iCount - firstSize) * sizeof(T));
+
+    fWriteIndex.store(end, std::memory_order_release);
+  }
+
+  // push (a single element)
+  inline void push(T const &iElement) { write(&iElement, 1); }
+
+  //------------------------------------------------------------------------------------------------------------
+  // WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
+  //
+  // All the following methods should be called in a single thread (the consumer)
+  //
+  // WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING WARNING
+  //------------------------------------------------------------------------------------------------------------
+
+  /**
+   * @return the number of elements available for reading (never more than the capacity) */
+  size_t getReadableCount() const
+  {
+    auto available = fWriteIndex.load(std::memory_order_acquire) - fReadIndex.load(std::memory_order_relaxed);
+    return static_cast<size_t>(std::min<uint64_t>(available, fCapacity));
+  }
+
+  /**
+   * Reads (and consumes) up to `iMaxCount` elements, oldest first. If the producer got ahead by more than the
+   * capacity (or overwrites the elements while they are being copied), the elements lost are skipped and added to
+   * `getDroppedCount()`.
+   *
+   * @return the number of elements copied into `oData` */
+  size_t read(T *oData, size_t iMaxCount)
+  {
+    auto readIndex = fReadIndex.load(std::memory_order_relaxed);
+    auto writeIndex = fWriteIndex.load(std::memory_order_acquire);
+
+    // overrun => the oldest elements are gone
+    if(writeIndex - readIndex > fCapacity)
+    {
+      fDroppedCount += writeIndex - fCapacity - readIndex;
+      readIndex = writeIndex - fCapacity;
+    }
+
+    auto count = static_cast<size_t>(std::min<uint64_t>(writeIndex - readIndex, iMaxCount));
+    if(count == 0)
+    {
+      fReadIndex.store(readIndex, std::memory_order_relaxed);
+      return 0;
+    }
+
+    auto start = static_cast<size_t>(readIndex & fMask);
+    auto firstSize = std::min(count, fCapacity - start);
+    std::memcpy(oData, fBuffer.get() + start, firstSize * sizeof(T));
+    if(firstSize < count)
+      std::memcpy(oData + firstSize, fBuffer.get(), (count - firstSize) * sizeof(T));
+
+    // validate: the slots claimed by the producer in the meantime may have been (partially) overwritten
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto claimIndex = fClaimIndex.load(std::memory_order_relaxed);
+
+    fReadIndex.store(readIndex + count, std::memory_order_relaxed);
+
+    if(claimIndex - readIndex > fCapacity)
+    {
+      auto lost = static_cast<size_t>(std::min<uint64_t>(claimIndex - fCapacity - readIndex, count));
+      fDroppedCount += lost;
+      count -= lost;
+      if(count > 0)
+        std::memmove(oData, oData + lost, count * sizeof(T));
+    }
+
+    return count;
+  }
+
+  /**
+   * Same as `read` but first skips (without accounting them as dropped) the older elements so that at most
+   * `iMaxCount` are left: `oData` ends up with the most recent elements, which is what a scope usually wants. */
+  size_t readLatest(T *oData, size_t iMaxCount)
+  {
+    auto writeIndex = fWriteIndex.load(std::memory_order_acquire);
+    if(writeIndex > iMaxCount && fReadIndex.load(std::memory_order_relaxed) < writeIndex - iMaxCount)
+      fReadIndex.store(writeIndex - iMaxCount, std::memory_order_relaxed);
+    return read(oData, iMaxCount);
+  }
+
+  /**
+   * Skips all the elements currently available */
+  void skipAll()
+  {
+    fReadIndex.store(fWriteIndex.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+
+  /**
+   * @return the number of elements the consumer lost because it was too slow */
+  inline uint64_t getDroppedCount() const { return fDroppedCount; }
+
+  /**
+   * @return the total number of elements consumed since creation (read, dropped or skipped) */
+  inline uint64_t getConsumedCount() const { return fReadIndex.load(std::memory_order_relaxed); }
+
+  //------------------------------------------------------------------------------------------------------------
+  // Can be called from any thread (informative only)
+  //------------------------------------------------------------------------------------------------------------
+
+  //! Total number of elements written since creation
+  inline uint64_t getWrittenCount() const { return fWriteIndex.load(std::memory_order_relaxed); }
+
+private:
+  size_t const fCapacity;
+  size_t const fMask;
+  std::unique_ptr<T[]> const fBuffer;
+
+  // producer cache line
+  alignas(kCacheLineSize) std::atomic<uint64_t> fWriteIndex{0};
+  std::atomic<uint64_t> fClaimIndex{0};
+
+  // consumer cache line
+  alignas(kCacheLineSize) std::atomic<uint64_t> fReadIndex{0};
+  uint64_t fDroppedCount{0};
+};
+
+}
+}
+}
+
+#endif // __PONGASOFT_UTILS_COLLECTION_SPSC_RING_BUFFER_H__
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace pongasoft::Utils::Concurrent {
+
+/**
+ * A single background thread executing jobs in the order in which they were submitted. The thread is started lazily
+ * on the first call to `submit` and stopped (after all pending jobs have been executed) in the destructor.
+ *
+ * This class uses locks and allocates memory so `submit` must **never** be called from the RT thread. It is
+ * meant to move expensive work (decoding, formatting, analysis...) away from the UI and RT threads. */
+class WorkerThread
+{
+public:
+  using Job = std::function<void()>;
+
+public:
+  WorkerThread() = default;
+
+  // Destructor => executes all pending jobs and joins the thread
+  ~WorkerThread() { stop(); }
+
+  WorkerThread(WorkerThread const &) = delete;
+  WorkerThread &operator=(WorkerThread const &) = delete;
+
+  /**
+   * Submits a job to be executed by the background thread. Never call from the RT thread! */
+  void submit(Job iJob)
+  {
+    {
+      std::lock_guard<std::mutex> lock{fMutex};
+      fJobs.emplace_back(std::move(iJob));
+      if(!fThread.joinable())
+      {
+        fStopRequested = false;
+        fThread = std::thread{[this] { run(); }};
+      }
+    }
+    fCondition.notify_one();
+  }
+
+  /**
+   * Blocks until all the jobs submitted so far have been executed (mostly useful for testing) */
+  void waitForIdle()
+  {
+    std::unique_lock<std::mutex> lock{fMutex};
+    fIdleCondition.wait(lock, [this] { return fJobs.empty() && !fBusy; });
+  }
+
+  /**
+   * Executes all pending jobs and stops the thread (`submit` restarts it) */
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock{fMutex};
+      if(!fThread.joinable())
+        return;
+      fStopRequested = true;
+    }
+    fCondition.notify_one();
+    fThread.join();
+  }
+
+  // isRunning
+  bool isRunning() const
+  {
+    std::lock_guard<std::mutex> lock{fMutex};
+    return fThread.joinable();
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock{fMutex};
+    while(true)
+    {
+      fCondition.wait(lock, [this] { return fStopRequested || !fJobs.empty(); });
+
+      if(fJobs.empty())
+        break; // stop requested and nothing left to do
+
+      auto job = std::move(fJobs.front());
+      fJobs.pop_front();
+      fBusy = true;
+      lock.unlock();
+      job();
+      lock.lock();
+      fBusy = false;
+      if(fJobs.empty())
+        fIdleCondition.notify_all();
+    }
+    fIdleCondition.notify_all();
+  }
+
+private:
+  mutable std::mutex fMutex{};
+  std::condition_variable fCondition{};
+  std::condition_variable fIdleCondition{};
+  std::deque<Job> fJobs{};
+  bool fStopRequested{false};
+  bool fBusy{false};
+  std::thread fThread{};
+};
+
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#ifndef __PONGASOFT_UTILS_DENORMALS_H__
+#define __PONGASOFT_UTILS_DENORMALS_H__
+
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define JAMBA_DENORMALS_SSE 1
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define JAMBA_DENORMALS_AARCH64 1
+#elif defined(__arm__) && defined(__ARM_FP) && (defined(__GNUC__) || defined(__clang__))
+#define JAMBA_DENORMALS_ARM 1
+#endif
+
+namespace pongasoft {
+namespace Utils {
+
+/**
+ * Denormal (subnormal) numbers are extremely small floating point numbers (ex: the decaying tail of a filter or a
+ * reverb feedback loop) which most CPUs handle in microcode, making each operation involving them 10 to 100 times
+ * slower. This RAII class sets the floating point unit of the current thread in a mode where denormals are treated as
+ * (and flushed to) 0 for the duration of the scope and restores the previous mode (the host's) when it ends:
+ *
+ * - x86 (SSE): `FTZ` (flush to zero) and `DAZ` (denormals are zero) bits of the `MXCSR` register
+ * - ARM 64 bits: `FZ` bit of the `FPCR` register
+ * - ARM 32 bits (VFP): `FZ` bit of the `FPSCR` register
+ *
+ * On any other platform (or compiler), this class does nothing (see `isSupported()`).
+ *
+ * ```
+ * {
+ *   Utils::ScopedNoDenormals noDenormals{};
+ *   // ... processing code
+ * }
+ * ```
+ *
+ * \note `RTProcessor` does it automatically around `processInputs` (see `RTProcessor::enableNoDenormals`) */
+class ScopedNoDenormals
+{
+public:
+  // Constructor
+  ScopedNoDenormals() : fPreviousMode{getMode()}
+  {
+    auto mode = fPreviousMode | kNoDenormalsMask;
+    if(mode != fPreviousMode)
+      setMode(mode);
+  }
+
+  // Destructor (restores the previous mode)
+  ~ScopedNoDenormals()
+  {
+    if((fPreviousMode | kNoDenormalsMask) != fPreviousMode)
+      setMode(fPreviousMode);
+  }
+
+  /**
+   * @return `true` if this platform supports it (otherwise this class does nothing) */
+  static constexpr bool isSupported() { return kNoDenormalsMask != 0; }
+
+  // disabling copy
+  ScopedNoDenormals(ScopedNoDenormals const &) = delete;
+  ScopedNoDenormals& operator=(ScopedNoDenormals const &) = delete;
+
+private:
+#if JAMBA_DENORMALS_SSE
+  using Mode = unsigned int;
+  static constexpr Mode kNoDenormalsMask = 0x8040; // FTZ (bit 15) | DAZ (bit 6)
+  static inline Mode getMode() { return _mm_getcsr(); }
+  static inline void setMode(Mode iMode) { _mm_setcsr(iMode); }
+#elif JAMBA_DENORMALS_AARCH64
+  using Mode = uint64_t;
+  static constexpr Mode kNoDenormalsMask = static_cast<Mode>(1) << 24; // FZ
+  static inline Mode getMode() { Mode mode; asm volatile("mrs %0, fpcr" : "=r"(mode)); return mode; }
+  static inline void setMode(Mode iMode) { asm volatile("msr fpcr, %0" : : "r"(iMode)); }
+#elif JAMBA_DENORMALS_ARM
+  using Mode = uint32_t;
+  static constexpr Mode kNoDenormalsMask = static_cast<Mode>(1) << 24; // FZ
+  static inline Mode getMode() { Mode mode; asm volatile("vmrs %0, fpscr" : "=r"(mode)); return mode; }
+  static inline void setMode(Mode iMode) { asm volatile("vmsr fpscr, %0" : : "r"(iMode)); }
+#else
+  using Mode = uint32_t;
+  static constexpr Mode kNoDenormalsMask = 0;
+  static inline Mode getMode() { return 0; }
+  static inline void setMode(Mode) {}
+#endif
+
+private:
+  Mode const fPreviousMode;
+};
+
+}
+}
+
+#endif // __PONGASOFT_UTILS_DENORMALS_H__
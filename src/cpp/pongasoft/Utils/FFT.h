@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace pongasoft::Utils {
+
+/**
+ * Forward FFT of a real signal of size `N` (a power of 2), computed as a complex FFT of size `N / 2` (the even
+ * samples being the real part and the odd samples the imaginary part) followed by a split step, which is about twice
+ * as fast as a complex FFT of size `N`.
+ *
+ * All the tables (bit reversal, twiddle factors) are computed in the constructor and the work buffers are owned by
+ * the instance so `forward` does not allocate. The data is kept in split form (real and imaginary parts in separate
+ * arrays) and the twiddle factors are stored contiguously per stage so that the inner loops of each butterfly stage
+ * are straight loops over contiguous arrays that the compiler auto-vectorizes (SSE/AVX/NEON).
+ *
+ * An instance is **not** thread safe (it owns its work buffers): use one instance per thread.
+ *
+ * @tparam T `float` or `double` */
+template<typename T>
+class RealFFT
+{
+  // M_PI is not standard (requires _USE_MATH_DEFINES with MSVC)
+  static constexpr double kPi = 3.14159265358979323846;
+
+public:
+  /**
+   * @param iSize the size of the FFT (rounded up to a power of 2, minimum 4) */
+  explicit RealFFT(int iSize)
+  {
+    fSize = 4;
+    while(fSize < iSize)
+      fSize *= 2;
+    fHalfSize = fSize / 2;
+
+    // bit reversal (for the complex FFT of size N/2)
+    int bits = 0;
+    while((1 << bits) < fHalfSize)
+      bits++;
+    fBitReverse.resize(fHalfSize);
+    for(int i = 0; i < fHalfSize; i++)
+    {
+      int r = 0;
+      for(int b = 0; b < bits; b++)
+        r |= ((i >> b) & 1) << (bits - 1 - b);
+      fBitReverse[i] = r;
+    }
+
+    // twiddle factors per stage: stage with half length h uses e^(-i.pi.j/h) for j in [0, h) at offset h - 1
+    fStageCos.resize(std::max(fHalfSize - 1, 1));
+    fStageSin.resize(std::max(fHalfSize - 1, 1));
+    for(int h = 1; h < fHalfSize; h *= 2)
+    {
+      for(int j = 0; j < h; j++)
+      {
+        auto angle = kPi * j / h;
+        fStageCos[h - 1 + j] = static_cast<T>(std::cos(angle));
+        fStageSin[h - 1 + j] = static_cast<T>(-std::sin(angle));
+      }
+    }
+
+    // twiddle factors for the split step: e^(-2.i.pi.k/N) for k in [0, N/2]
+    fSplitCos.resize(fHalfSize + 1);
+    fSplitSin.resize(fHalfSize + 1);
+    for(int k = 0; k <= fHalfSize; k++)
+    {
+      auto angle = 2.0 * kPi * k / fSize;
+      fSplitCos[k] = static_cast<T>(std::cos(angle));
+      fSplitSin[k] = static_cast<T>(-std::sin(angle));
+    }
+
+    fReal.resize(fHalfSize);
+    fImag.resize(fHalfSize);
+  }
+
+  // getSize
+  inline int getSize() const { return fSize; }
+
+  /**
+   * @return the number of bins computed by `forward` (`N / 2 + 1`, from DC to Nyquist) */
+  inline int getNumBins() const { return fHalfSize + 1; }
+
+  /**
+   * Computes the (unnormalized) spectrum of `iInput`.
+   *
+   * @param iInput `getSize()` samples
+   * @param oReal, oImag `getNumBins()` elements each */
+  void forward(T const *iInput, T *oReal, T *oImag)
+  {
+    auto const M = fHalfSize;
+
+    // pack (even => real, odd => imag) in bit reversed order
+    for(int n = 0; n < M; n++)
+    {
+      auto j = fBitReverse[n];
+      fReal[j] = iInput[2 * n];
+      fImag[j] = iInput[2 * n + 1];
+    }
+
+    // butterflies
+    T *re = fReal.data();
+    T *im = fImag.data();
+    for(int h = 1; h < M; h *= 2)
+    {
+      T const *wr = fStageCos.data() + h - 1;
+      T const *wi = fStageSin.data() + h - 1;
+      for(int g = 0; g < M; g += 2 * h)
+      {
+        T *ar = re + g;
+        T *ai = im + g;
+        T *br = ar + h;
+        T *bi = ai + h;
+        for(int j = 0; j < h; j++)
+        {
+          auto tr = br[j] * wr[j] - bi[j] * wi[j];
+          auto ti = br[j] * wi[j] + bi[j] * wr[j];
+          br[j] = ar[j] - tr;
+          bi[j] = ai[j] - ti;
+          ar[j] = ar[j] + tr;
+          ai[j] = ai[j] + ti;
+        }
+      }
+    }
+
+    // split: X[k] = E[k] + W^k.O[k] with E = (Z[k] + Z*[M-k]) / 2 and O = (Z[k] - Z*[M-k]) / 2i
+    for(int k = 0; k <= M; k++)
+    {
+      auto zk = k == M ? 0 : k;
+      auto zmk = k == 0 ? 0 : M - k;
+
+      auto er = (re[zk] + re[zmk]) * T{0.5};
+      auto ei = (im[zk] - im[zmk]) * T{0.5};
+      auto orr = (im[zk] + im[zmk]) * T{0.5};
+      auto oi = (re[zmk] - re[zk]) * T{0.5};
+
+      oReal[k] = er + fSplitCos[k] * orr - fSplitSin[k] * oi;
+      oImag[k] = ei + fSplitCos[k] * oi + fSplitSin[k] * orr;
+    }
+  }
+
+  /**
+   * Fills `oWindow` (`iSize` elements) with a (periodic) Hann window
+   *
+   * @return the sum of the window coefficients (a sine of amplitude `A` has a peak magnitude of `A * sum / 2`) */
+  static T hannWindow(T *oWindow, int iSize)
+  {
+    T sum{};
+    for(int i = 0; i < iSize; i++)
+    {
+      oWindow[i] = static_cast<T>(0.5 - 0.5 * std::cos(2.0 * kPi * i / iSize));
+      sum += oWindow[i];
+    }
+    return sum;
+  }
+
+private:
+  int fSize{};
+  int fHalfSize{};
+  std::vector<int> fBitReverse{};
+  std::vector<T> fStageCos{};
+  std::vector<T> fStageSin{};
+  std::vector<T> fSplitCos{};
+  std::vector<T> fSplitSin{};
+  std::vector<T> fReal{};
+  std::vector<T> fImag{};
+};
+
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "ParamSnapshot.h"
+
+#include <base/source/fstring.h>
+
+namespace pongasoft::VST::Debug {
+
+namespace impl {
+
+//------------------------------------------------------------------------
+// impl::computeSaveOrder => keeps only the vst parameters registered with the state
+//------------------------------------------------------------------------
+NormalizedState::SaveOrder computeSaveOrder(std::map<ParamID, std::unique_ptr<RT::RTRawVstParameter>> const &iParameters,
+                                            std::vector<ParamID> const &iParamIDs)
+{
+  NormalizedState::SaveOrder saveOrder{-1, {}};
+
+  if(iParamIDs.empty())
+  {
+    for(auto const &p: iParameters)
+      saveOrder.fOrder.emplace_back(p.first);
+  }
+  else
+  {
+    for(auto paramID: iParamIDs)
+    {
+      if(iParameters.find(paramID) != iParameters.cend())
+        saveOrder.fOrder.emplace_back(paramID);
+      else
+        DLOG_F(WARNING, "ParamSnapshot - [%d] is not a vst parameter registered with the RT state => ignored", paramID);
+    }
+  }
+
+  saveOrder.buildIndex();
+  return saveOrder;
+}
+
+}
+
+//------------------------------------------------------------------------
+// ParamSnapshot::ParamSnapshot
+//------------------------------------------------------------------------
+ParamSnapshot::ParamSnapshot(RT::RTState const *iState,
+                             int32 iIntervalInSamples,
+                             std::vector<ParamID> const &iParamIDs) :
+  fPluginParameters{iState->fPluginParameters},
+  fSaveOrder{impl::computeSaveOrder(iState->fVstParameters, iParamIDs)},
+  fIntervalInSamples{std::max(0, iIntervalInSamples)},
+  fSnapshot{std::make_unique<NormalizedState>(&fSaveOrder)},
+  fCurrent{&fSaveOrder},
+  fPrevious{&fSaveOrder}
+{
+  fRTParameters.reserve(fSaveOrder.fOrder.size());
+  for(auto paramID: fSaveOrder.fOrder)
+    fRTParameters.emplace_back(iState->fVstParameters.at(paramID).get());
+}
+
+//------------------------------------------------------------------------
+// ParamSnapshot::capture
+//------------------------------------------------------------------------
+bool ParamSnapshot::capture(int32 iNumSamples)
+{
+  fSamplesSinceLastCapture += iNumSamples;
+
+  if(fSamplesSinceLastCapture < fIntervalInSamples)
+    return false;
+
+  captureNow();
+  return true;
+}
+
+//------------------------------------------------------------------------
+// ParamSnapshot::captureNow
+//------------------------------------------------------------------------
+void ParamSnapshot::captureNow()
+{
+  fSamplesSinceLastCapture = 0;
+
+  fSnapshot.update([this](NormalizedState *oSnapshot) {
+    for(int i = 0; i < oSnapshot->getCount(); i++)
+      oSnapshot->set(i, fRTParameters[i]->getNormalizedValue());
+  });
+
+  fCaptureCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------
+// ParamSnapshot::update
+//------------------------------------------------------------------------
+bool ParamSnapshot::update()
+{
+  if(fSnapshot.isEmpty())
+    return false;
+
+  fSnapshot.get(fCurrent);
+  return true;
+}
+
+//------------------------------------------------------------------------
+// ParamSnapshot::diffs
+//------------------------------------------------------------------------
+std::vector<ParamSnapshot::Diff> ParamSnapshot::diffs()
+{
+  std::vector<Diff> res{};
+
+  // nothing captured since the last call (or nothing captured at all yet)
+  if(!update())
+    return res;
+
+  for(int i = 0; i < fCurrent.getCount(); i++)
+  {
+    auto value = fCurrent.get(i);
+    auto previousValue = fPrevious.get(i);
+
+    if(fFirstDiff || value != previousValue)
+    {
+      auto paramID = fSaveOrder.fOrder[i];
+      std::string s{};
+      auto paramDef = fPluginParameters.getRawVstParamDef(paramID);
+      if(paramDef)
+      {
+        String128 s128;
+        paramDef->toString(value, s128);
+        s = String(s128).text8();
+      }
+      res.emplace_back(Diff{paramID, previousValue, value, std::move(s)});
+    }
+  }
+
+  fPrevious = fCurrent;
+  fFirstDiff = false;
+
+  return res;
+}
+
+//------------------------------------------------------------------------
+// ParamSnapshot::toString
+//------------------------------------------------------------------------
+std::string ParamSnapshot::toString(std::vector<ParamDisplay::Key> const &iKeys)
+{
+  update();
+  return ParamTable::from(fPluginParameters).keys(iKeys).toString(fCurrent);
+}
+
+}
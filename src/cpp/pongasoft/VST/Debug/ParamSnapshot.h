@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pongasoft/Utils/Concurrent/Concurrent.h>
+#include <pongasoft/VST/NormalizedState.h>
+#include <pongasoft/VST/RT/RTState.h>
+
+#include "ParamTable.h"
+
+#include <string>
+#include <vector>
+
+namespace pongasoft::VST::Debug {
+
+/**
+ * This helper class makes it possible to watch the RT parameter values live, including in production builds: unlike
+ * `ParamTable` and `ParamDisplay`, the RT side (`capture`) only copies the raw normalized values into a preallocated
+ * snapshot (no memory allocation, no lock, rate limited). All the string formatting and table layout happens on the
+ * (non RT) thread calling `diffs` or `toString`.
+ *
+ * Usage:
+ *
+ * ```
+ * // processor constructor (or setupProcessing) => allocates the snapshot
+ * fSnapshot = std::make_unique<Debug::ParamSnapshot>(&fState, 4096);
+ *
+ * // in processInputs (RT)
+ * fSnapshot->capture(data.numSamples);
+ *
+ * // in a (non RT) timer, for example RTProcessor::onGUITimer
+ * for(auto &diff: fSnapshot->diffs())
+ *   DLOG_F(INFO, "%d: %s", diff.fParamID, diff.fValue.c_str());
+ * ```
+ *
+ * Only vst parameters are captured (jmb parameters are not plain normalized values). `capture` must be called by a
+ * single (RT) thread and `update`/`diffs`/`toString` by a single (non RT) thread. */
+class ParamSnapshot
+{
+public:
+  /**
+   * Describes a parameter whose value has changed since the last call to `diffs` */
+  struct Diff
+  {
+    ParamID fParamID{};
+    ParamValue fPreviousNormalizedValue{};
+    ParamValue fNormalizedValue{};
+    std::string fValue{}; // the value as rendered by the param definition (`RawVstParamDef::toString`)
+  };
+
+public:
+  /**
+   * @param iState the state to capture (must outlive this object)
+   * @param iIntervalInSamples rate limit: `capture` only captures the values once every `iIntervalInSamples` samples
+   *                           (`0` means every call)
+   * @param iParamIDs the vst parameters to capture (empty means all the vst parameters registered with the state) */
+  explicit ParamSnapshot(RT::RTState const *iState,
+                         int32 iIntervalInSamples = 0,
+                         std::vector<ParamID> const &iParamIDs = {});
+
+  ParamSnapshot(ParamSnapshot const &) = delete;
+  ParamSnapshot &operator=(ParamSnapshot const &) = delete;
+
+  //------------------------------------------------------------------------
+  // RT thread
+  //------------------------------------------------------------------------
+
+  /**
+   * Captures the values if at least `iIntervalInSamples` samples have elapsed since the last capture. RT safe.
+   *
+   * @param iNumSamples the number of samples processed since the last call (typically `ProcessData::numSamples`)
+   * @return `true` if the values were captured */
+  bool capture(int32 iNumSamples);
+
+  /**
+   * Captures the values regardless of the rate limit. RT safe. */
+  void captureNow();
+
+  //------------------------------------------------------------------------
+  // non RT thread
+  //------------------------------------------------------------------------
+
+  /**
+   * Fetches the latest snapshot captured by the RT thread (if any)
+   *
+   * @return `true` if there was a new snapshot */
+  bool update();
+
+  /**
+   * @return the latest snapshot fetched by `update` */
+  NormalizedState const &current() const { return fCurrent; }
+
+  /**
+   * Calls `update` and returns the parameters whose values have changed since the previous call (all parameters on
+   * the first call following a capture). Returns an empty vector when nothing has been captured yet. */
+  std::vector<Diff> diffs();
+
+  /**
+   * Calls `update` and renders the latest snapshot as a table (`ParamTable` configured with `iKeys`) */
+  std::string toString(std::vector<ParamDisplay::Key> const &iKeys = {ParamDisplay::Key::kID,
+                                                                     ParamDisplay::Key::kTitle,
+                                                                     ParamDisplay::Key::kValue});
+
+  // number of snapshots captured by the RT thread so far (approximate when read outside the RT thread)
+  uint32 getCaptureCount() const { return fCaptureCount.load(); }
+
+  // ids
+  std::vector<ParamID> const &ids() const { return fSaveOrder.fOrder; }
+
+private:
+  Parameters const &fPluginParameters;
+
+  // the order of the values in the snapshot (must be declared before the states)
+  NormalizedState::SaveOrder fSaveOrder;
+
+  // the RT parameters (same order as fSaveOrder) => resolved once at construction
+  std::vector<RT::RTRawVstParameter const *> fRTParameters{};
+
+  // RT side
+  int32 fIntervalInSamples;
+  int32 fSamplesSinceLastCapture{0};
+  std::atomic<uint32> fCaptureCount{0};
+
+  // hand-off RT -> non RT
+  Utils::Concurrent::LockFree::AtomicValue<NormalizedState> fSnapshot;
+
+  // non RT side
+  NormalizedState fCurrent;
+  NormalizedState fPrevious;
+  bool fFirstDiff{true};
+};
+
+}
@@ -40,6 +40,12 @@ FObjectCx::FObjectCx(FObject *iTarget) : fTarget{iTarget}
 //------------------------------------------------------------------------
 void FObjectCx::close()
 {
+  if(fScheduler)
+  {
+    fScheduler->cancel(this);
+    fScheduler = nullptr;
+  }
+
   if(fIsConnected)
   {
     fTarget->removeDependent(this);
@@ -55,7 +61,57 @@ void FObjectCx::update(FUnknown * /* iChangedUnknown */, Steinberg::int32 iMessa
 {
   if(iMessage == IDependent::kChanged)
   {
+    if(fIsSuspended)
+      fChangedWhileSuspended = true;
+    else
+    {
+      if(fScheduler)
+        fScheduler->schedule(this);
+      else
+        onTargetChange();
+    }
+  }
+}
+
+//------------------------------------------------------------------------
+// FObjectCx::setScheduler
+//------------------------------------------------------------------------
+void FObjectCx::setScheduler(std::shared_ptr<IFObjectCxScheduler> iScheduler)
+{
+  if(fScheduler)
+    fScheduler->cancel(this);
+
+  fScheduler = std::move(iScheduler);
+}
+
+//------------------------------------------------------------------------
+// FObjectCx::dispatchScheduledChange
+//------------------------------------------------------------------------
+void FObjectCx::dispatchScheduledChange()
+{
+  if(!fIsConnected)
+    return;
+
+  // the connection got suspended after the change was scheduled => resume will deliver it
+  if(fIsSuspended)
+    fChangedWhileSuspended = true;
+  else
     onTargetChange();
+}
+
+//------------------------------------------------------------------------
+// FObjectCx::resume
+//------------------------------------------------------------------------
+void FObjectCx::resume()
+{
+  if(fIsSuspended)
+  {
+    fIsSuspended = false;
+    if(fChangedWhileSuspended)
+    {
+      fChangedWhileSuspended = false;
+      onTargetChange();
+    }
   }
 }
 
@@ -21,12 +21,35 @@
 #include <pluginterfaces/vst/vsttypes.h>
 #include <pongasoft/VST/Parameters.h>
 
+#include <memory>
+
 namespace pongasoft {
 namespace VST {
 
 using namespace Steinberg::Vst;
 using namespace Steinberg;
 
+class FObjectCx;
+
+/**
+ * A scheduler defers (and collapses) the change notifications of the connections it is set on: instead of calling
+ * `onTargetChange` right away, the connection calls `schedule` and the scheduler is expected to call
+ * `FObjectCx::dispatchScheduledChange` at a later time (see `GUI::GUIUpdateScheduler`). */
+class IFObjectCxScheduler
+{
+public:
+  virtual ~IFObjectCxScheduler() = default;
+
+  /**
+   * Called when the target of the connection changes. Scheduling the same connection several times before it is
+   * dispatched should result in only one dispatch. */
+  virtual void schedule(FObjectCx *iCx) = 0;
+
+  /**
+   * Called when the connection is closed: the scheduler must not dispatch it anymore. */
+  virtual void cancel(FObjectCx *iCx) = 0;
+};
+
 /**
  * Wrapper class which maintains a connection between the target and this object. The connection will be
  * terminated if close() is called or automatically when the destructor is called. The main point of this class
@@ -48,6 +71,27 @@ public:
    */
   virtual void onTargetChange() {};
 
+  /**
+   * Suspends the connection: changes to the target are no longer propagated (`onTargetChange` is not called) but
+   * are remembered so that `resume` can catch up. */
+  inline void suspend() { fIsSuspended = true; }
+
+  /**
+   * Resumes a suspended connection, calling `onTargetChange` once if the target changed while suspended. */
+  void resume();
+
+  // isSuspended
+  inline bool isSuspended() const { return fIsSuspended; }
+
+  /**
+   * Sets the scheduler used to defer change notifications (`nullptr` means `onTargetChange` is called
+   * synchronously, which is the default). */
+  void setScheduler(std::shared_ptr<IFObjectCxScheduler> iScheduler);
+
+  /**
+   * Called by the scheduler to deliver a change previously scheduled. */
+  void dispatchScheduledChange();
+
   /**
    * Automatically closes the connection and stops listening */
   inline ~FObjectCx() override { close(); }
@@ -65,6 +109,9 @@ protected:
 protected:
   FObject *fTarget;
   bool fIsConnected;
+  bool fIsSuspended{false};
+  bool fChangedWhileSuspended{false};
+  std::shared_ptr<IFObjectCxScheduler> fScheduler{};
 };
 
 /**
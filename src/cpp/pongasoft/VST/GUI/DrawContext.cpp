@@ -25,6 +25,20 @@ namespace GUI {
 
 using namespace VSTGUI;
 
+//------------------------------------------------------------------------
+// getBitmapScaleFactor
+//------------------------------------------------------------------------
+std::optional<double> getBitmapScaleFactor(CDrawContext *iContext)
+{
+  auto const &transform = iContext->getCurrentTransform();
+
+  // same condition as VSTGUI (CDrawContext::drawBitmap implementations) to take the transform into account
+  if(transform.m11 != transform.m22 || transform.m12 != 0 || transform.m21 != 0 || transform.m11 <= 0)
+    return std::nullopt;
+
+  return iContext->getScaleFactor() * transform.m11;
+}
+
 //------------------------------------------------------------------------
 // RelativeDrawContext::drawString
 //------------------------------------------------------------------------
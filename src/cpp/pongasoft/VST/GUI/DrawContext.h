@@ -24,6 +24,8 @@
 
 #include "Types.h"
 
+#include <optional>
+
 namespace pongasoft {
 namespace VST {
 namespace GUI {
@@ -162,6 +164,15 @@ protected:
   AbsoluteRect const &fRect;
 };
 
+/**
+ * VSTGUI picks the platform bitmap (resolution) used to draw a bitmap from the backing scale factor of the context
+ * multiplied by the scale of its current transform (ex: editor zoom). This function computes the same value so that a
+ * bitmap rendered offscreen (and cached) can be rendered at the resolution it will be drawn at.
+ *
+ * @return the scale factor or `std::nullopt` when the current transform is not a uniform scale (rotation, skew,
+ *         non uniform scale...) in which case there is no single resolution to render at */
+std::optional<double> getBitmapScaleFactor(CDrawContext *iContext);
+
 /**
  * Encapsulates the draw context provided by VSTGUI to reason in relative coordinates (0,0) is top,left
  */
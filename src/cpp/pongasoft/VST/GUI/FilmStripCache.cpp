@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "FilmStripCache.h"
+#include "DrawContext.h"
+
+#include <pongasoft/logging/logging.h>
+
+#include <vstgui4/vstgui/lib/coffscreencontext.h>
+
+#include <algorithm>
+
+namespace pongasoft::VST::GUI {
+
+//------------------------------------------------------------------------
+// FilmStripCache::instance
+//------------------------------------------------------------------------
+FilmStripCache &FilmStripCache::instance()
+{
+  static FilmStripCache kInstance{};
+  return kInstance;
+}
+
+//------------------------------------------------------------------------
+// FilmStripCache::drawFrame
+//------------------------------------------------------------------------
+void FilmStripCache::drawFrame(CDrawContext *iContext,
+                               BitmapPtr iFilmStrip,
+                               int32 iFrameCount,
+                               int32 iFrameIndex,
+                               CRect const &iRect)
+{
+  if(!iFilmStrip)
+    return;
+
+  if(fEnabled)
+  {
+    // the scale factor includes the zoom of the current transform (the resolution VSTGUI draws the slice at)
+    // and is not defined when the transform is not a uniform scale (rotation, skew...) => draw directly
+    auto scaleFactor = getBitmapScaleFactor(iContext);
+    auto frame = scaleFactor ? getFrame(iFilmStrip, iFrameCount, iFrameIndex, *scaleFactor) : nullptr;
+    if(frame)
+    {
+      frame->draw(iContext, iRect);
+      return;
+    }
+
+    fStats.fFallbacks++;
+  }
+
+  CCoord frameHeight = iFilmStrip->getHeight() / std::max<int32>(iFrameCount, 1);
+  iFilmStrip->draw(iContext, iRect, CPoint{0, iFrameIndex * frameHeight});
+}
+
+//------------------------------------------------------------------------
+// FilmStripCache::getFrame
+//------------------------------------------------------------------------
+BitmapSPtr FilmStripCache::getFrame(BitmapPtr iFilmStrip, int32 iFrameCount, int32 iFrameIndex, double iScaleFactor)
+{
+  if(!iFilmStrip || iFrameCount <= 0 || iFrameIndex < 0 || iFrameIndex >= iFrameCount)
+    return nullptr;
+
+  Key key{iFilmStrip, iFrameCount};
+
+  auto iter = fEntries.find(key);
+  if(iter == fEntries.end())
+  {
+    // new filmstrip => good time to release the ones no longer in use
+    purge();
+    iter = fEntries.emplace(key, Entry{BitmapSPtr{iFilmStrip}}).first;
+  }
+
+  auto &frames = iter->second.fFrames[iScaleFactor];
+  if(frames.empty())
+    frames.resize(static_cast<size_t>(iFrameCount));
+
+  auto &frame = frames[static_cast<size_t>(iFrameIndex)];
+  if(frame)
+  {
+    fStats.fHits++;
+    return frame;
+  }
+
+  CPoint frameSize{iFilmStrip->getWidth(), iFilmStrip->getHeight() / iFrameCount};
+  if(frameSize.x <= 0 || frameSize.y <= 0)
+    return nullptr;
+
+  auto offscreen = COffscreenContext::create(frameSize, iScaleFactor);
+  if(!offscreen)
+    return nullptr;
+
+  offscreen->beginDraw();
+  iFilmStrip->draw(offscreen.get(), CRect{CPoint{}, frameSize}, CPoint{0, iFrameIndex * frameSize.y});
+  offscreen->endDraw();
+
+  frame = offscreen->getBitmap();
+  if(frame)
+    fStats.fSlices++;
+
+  return frame;
+}
+
+//------------------------------------------------------------------------
+// FilmStripCache::purge
+//------------------------------------------------------------------------
+void FilmStripCache::purge()
+{
+  for(auto iter = fEntries.begin(); iter != fEntries.end();)
+  {
+    // the only reference left is the one held by this cache => the views using it are gone
+    if(iter->second.fFilmStrip->getNbReference() <= 1)
+      iter = fEntries.erase(iter);
+    else
+      ++iter;
+  }
+}
+
+//------------------------------------------------------------------------
+// FilmStripCache::release
+//------------------------------------------------------------------------
+void FilmStripCache::release()
+{
+  DCHECK_F(fUserCount > 0, "release called without acquire");
+  if(fUserCount == 0)
+    return;
+
+  if(--fUserCount == 0)
+    clear();
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <vstgui4/vstgui/lib/cdrawcontext.h>
+#include <pluginterfaces/base/ftypes.h>
+#include "Types.h"
+
+#include <map>
+#include <vector>
+
+namespace pongasoft::VST::GUI {
+
+using namespace Steinberg;
+
+/**
+ * A filmstrip is an image containing `N` frames stacked vertically (each frame being `height / N` pixels high) which
+ * is used by most views displaying a state (ex: `ParamImageView`, `ToggleButtonView`, `StepButtonView`...).
+ *
+ * Instead of drawing a sub-rectangle of the (potentially very large) filmstrip on every redraw, this cache slices the
+ * filmstrip (lazily, one frame at a time) into individual platform bitmaps, once per scale factor (backing scale
+ * factor multiplied by the zoom of the context, see `getBitmapScaleFactor()`), so that drawing a frame is a blit of a
+ * small bitmap. A frame drawn in a rotated or skewed context is drawn directly from the filmstrip. The slices are shared by all the views using the same bitmap (which is
+ * the case of all the views created from the same `uidesc` attribute).
+ *
+ * The cache keeps a reference to the filmstrip bitmaps it has sliced (so that a bitmap cannot be deleted and its
+ * address reused by another one while in the cache) and releases the ones no longer used by any view whenever a new
+ * filmstrip is added (or when `purge` is called). `GUIController` purges the cache when the editor closes (which
+ * keeps the slices still used by the other instances of the plugin) and, since the cache is shared by all the
+ * instances, declares itself as a user (`acquire` / `release`) so that the last instance to terminate clears it and no
+ * platform bitmap survives until static destruction. The slices are recreated lazily on the next draw.
+ *
+ * This class is **not** thread safe and is meant to be used from the UI thread (draw) only.
+ */
+class FilmStripCache
+{
+public:
+  struct Stats
+  {
+    uint64 fHits{};      // frame drawn from a slice
+    uint64 fSlices{};    // frame sliced (rendered offscreen)
+    uint64 fFallbacks{}; // frame drawn directly from the filmstrip because it could not be sliced (offscreen
+                         // rendering not available, transform not a uniform scale or invalid frame); not counted
+                         // when the cache is disabled
+  };
+
+public:
+  /**
+   * @return the (global) cache used by the Jamba views */
+  static FilmStripCache &instance();
+
+  /**
+   * Draws the frame `iFrameIndex` of the filmstrip (made of `iFrameCount` frames) in `iRect`, which is equivalent to
+   *
+   * ```
+   * iFilmStrip->draw(iContext, iRect, CPoint{0, iFrameIndex * iFilmStrip->getHeight() / iFrameCount});
+   * ```
+   *
+   * but uses the cached slice. */
+  void drawFrame(CDrawContext *iContext,
+                 BitmapPtr iFilmStrip,
+                 int32 iFrameCount,
+                 int32 iFrameIndex,
+                 CRect const &iRect);
+
+  /**
+   * @return the slice for the frame `iFrameIndex` (creating it if necessary) or `nullptr` if the frame index is out
+   *         of range or offscreen rendering is not available */
+  BitmapSPtr getFrame(BitmapPtr iFilmStrip, int32 iFrameCount, int32 iFrameIndex, double iScaleFactor);
+
+  /**
+   * Enables/disables the cache (when disabled, `drawFrame` always draws directly from the filmstrip) */
+  void setEnabled(bool iEnabled) { fEnabled = iEnabled; if(!fEnabled) clear(); }
+
+  // isEnabled
+  bool isEnabled() const { return fEnabled; }
+
+  /**
+   * Releases the slices of the filmstrips which are no longer used (only referenced by this cache) */
+  void purge();
+
+  /**
+   * Releases all the slices */
+  void clear() { fEntries.clear(); }
+
+  /**
+   * Declares a user of this cache (for example a controller). Must be balanced by a call to `release`. */
+  void acquire() { fUserCount++; }
+
+  /**
+   * The last user of this cache releases all the slices (see `clear`) */
+  void release();
+
+  // getUserCount
+  int getUserCount() const { return fUserCount; }
+
+  // getFilmStripCount
+  size_t getFilmStripCount() const { return fEntries.size(); }
+
+  // getStats
+  Stats const &getStats() const { return fStats; }
+
+  // resetStats
+  void resetStats() { fStats = {}; }
+
+private:
+  struct Entry
+  {
+    // keeps the filmstrip alive (and its address unique) for as long as the slices exist
+    BitmapSPtr fFilmStrip{};
+
+    // scale factor (including zoom) -> slices (`nullptr` until sliced)
+    std::map<double, std::vector<BitmapSPtr>> fFrames{};
+  };
+
+  using Key = std::pair<CBitmap *, int32>;
+
+  std::map<Key, Entry> fEntries{};
+  bool fEnabled{true};
+  Stats fStats{};
+  int fUserCount{};
+};
+
+}
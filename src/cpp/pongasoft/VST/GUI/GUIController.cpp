@@ -18,6 +18,9 @@
 #include "GUIController.h"
 #include <vstgui4/vstgui/plugin-bindings/vst3editor.h>
 #include <pongasoft/VST/GUI/Views/JambaViews.h>
+#include <pongasoft/VST/GUI/Views/CustomViewCreator.h>
+#include <pongasoft/VST/GUI/FilmStripCache.h>
+#include <pongasoft/VST/VstUtils/DataCacheManager.h>
 
 namespace pongasoft {
 namespace VST {
@@ -43,6 +46,7 @@ GUIController::GUIController(const char *iXmlFileName, char const *iMainViewName
 //------------------------------------------------------------------------
 GUIController::~GUIController()
 {
+  releaseUIDescription();
   delete fViewFactory;
 }
 
@@ -77,6 +81,27 @@ tresult GUIController::initialize(FUnknown *context)
 
   fViewFactory = new CustomUIViewFactory(guiState);
 
+  // the shared data cache manager must be shut down when the last controller terminates
+  if(!fDataCacheManagerAcquired)
+  {
+    VstUtils::DataCacheManager::acquireGlobal();
+    fDataCacheManagerAcquired = true;
+  }
+
+  // the (global) filmstrip cache is shared by all the instances of the plugin and cleared by the last one
+  if(!fFilmStripCacheAcquired)
+  {
+    FilmStripCache::instance().acquire();
+    fFilmStripCacheAcquired = true;
+  }
+
+  // must be set before any parameter gets registered
+  if(fGUIUpdateFramesPerSecond > 0)
+  {
+    fGUIUpdateScheduler = std::make_shared<GUIUpdateScheduler>(fGUIUpdateFramesPerSecond);
+    guiState->setUpdateScheduler(fGUIUpdateScheduler);
+  }
+
   registerParameters(dynamic_cast<ParamAware *>(this));
 
   return result;
@@ -95,6 +120,16 @@ void GUIController::registerParameters(ParamAware *iParamAware)
   }
 }
 
+//------------------------------------------------------------------------
+// GUIController::enableGUIUpdateScheduler
+//------------------------------------------------------------------------
+void GUIController::enableGUIUpdateScheduler(uint32 iFramesPerSecond)
+{
+  fGUIUpdateFramesPerSecond = iFramesPerSecond;
+  if(fGUIUpdateScheduler)
+    fGUIUpdateScheduler->setFramesPerSecond(iFramesPerSecond);
+}
+
 //------------------------------------------------------------------------
 // GUIController::terminate
 //------------------------------------------------------------------------
@@ -110,9 +145,32 @@ tresult GUIController::terminate()
   if(gpa)
     gpa->unregisterAll();
 
+  if(fGUIUpdateScheduler)
+  {
+    fGUIUpdateScheduler->clear();
+    getGUIState()->setUpdateScheduler(nullptr);
+    fGUIUpdateScheduler = nullptr;
+  }
+
+  // the description uses the view factory
+  releaseUIDescription();
+
+  // the slices are platform bitmaps which must not outlive the plugin (cleared when the last instance terminates)
+  if(fFilmStripCacheAcquired)
+  {
+    FilmStripCache::instance().release();
+    fFilmStripCacheAcquired = false;
+  }
+
   delete fViewFactory;
   fViewFactory = nullptr;
 
+  if(fDataCacheManagerAcquired)
+  {
+    VstUtils::DataCacheManager::releaseGlobal();
+    fDataCacheManagerAcquired = false;
+  }
+
   return res;
 }
 
@@ -125,12 +183,46 @@ IPlugView *GUIController::createView(const char *name)
   if(name && strcmp(name, ViewType::kEditor) == 0)
   {
     // we keep a reference to the UIDescription as it is needed to build the dialog view
-    fUIDescription = VSTGUI::makeOwned<UIDescription>(fXmlFileName, fViewFactory);
-    return new VSTGUI::VST3Editor(fUIDescription, this, fCurrentViewName.c_str(), fXmlFileName);
+    auto description = getUIDescription();
+    if(description)
+      return new VSTGUI::VST3Editor(description, this, fCurrentViewName.c_str(), fXmlFileName);
   }
   return nullptr;
 }
 
+//------------------------------------------------------------------------
+// GUIController::getUIDescription
+//------------------------------------------------------------------------
+SharedPointer<UIDescription> GUIController::getUIDescription()
+{
+  if(!fUIDescription)
+  {
+    auto description = VSTGUI::makeOwned<UIDescription>(fXmlFileName, fViewFactory);
+    if(!description->parse())
+    {
+      DLOG_F(ERROR, "Could not parse the ui description <%s>", fXmlFileName);
+      return nullptr;
+    }
+    fUIDescription = std::move(description);
+  }
+
+  return fUIDescription;
+}
+
+//------------------------------------------------------------------------
+// GUIController::releaseUIDescription
+//------------------------------------------------------------------------
+void GUIController::releaseUIDescription()
+{
+  if(fUIDescription)
+  {
+    fUIDescription = nullptr;
+    // the converted values may point to objects owned by the description (bitmaps, fonts...)
+    if(fViewFactory)
+      fViewFactory->getAttributeConversionCache().invalidate();
+  }
+}
+
 //------------------------------------------------------------------------
 // GUIController::didOpen
 //------------------------------------------------------------------------
@@ -146,7 +238,12 @@ void GUIController::didOpen(VST3Editor *editor)
 //------------------------------------------------------------------------
 void GUIController::willClose(VST3Editor * /* ignored */)
 {
-  fUIDescription = nullptr;
+  if(!fUIDescriptionCacheEnabled)
+    releaseUIDescription();
+
+  // release the slices no longer used by any view (the ones used by other instances of the plugin are kept)
+  FilmStripCache::instance().purge();
+
   fVST3Editor = nullptr;
 }
 
@@ -198,6 +295,14 @@ tresult GUIController::notify(IMessage *message)
 
   Message m{message};
 
+  // the latency of the processor changed => the host needs to query it again
+  if(m.getMessageID() == kLatencyChangedMessageID)
+  {
+    if(componentHandler)
+      return componentHandler->restartComponent(kLatencyChanged);
+    return kResultFalse;
+  }
+
   return getGUIState()->handleMessage(m);
 }
 
@@ -122,6 +122,43 @@ protected:
   //! Shows the dialog if necessary
   bool maybeShowDialog();
 
+  /**
+   * Call this method (in the constructor, as it takes effect in `initialize`) to deliver the parameter change
+   * notifications of views and `ParamAware` classes at most `iFramesPerSecond` times per second, collapsing
+   * repeated notifications for the same listener/callback in between (see `GUIUpdateScheduler`).
+   *
+   * \note This changes the timing of listeners and callbacks which are no longer invoked synchronously, which is
+   *       why it is not enabled by default. */
+  void enableGUIUpdateScheduler(uint32 iFramesPerSecond = GUIUpdateScheduler::kDefaultFramesPerSecond);
+
+  /**
+   * Returns the (parsed) description of the UI, loaded from `fXmlFileName` on first use. The description (and the
+   * attribute values converted while creating views, see `Views::AttributeConversionCache`) is kept for the lifetime
+   * of the controller so that opening the editor again does not parse the xml file again (unless disabled with
+   * `enableUIDescriptionCache(false)`).
+   *
+   * @return `nullptr` if the file could not be parsed */
+  SharedPointer<UIDescription> getUIDescription();
+
+  /**
+   * Releases the description (the next editor open will load and parse the xml file again) */
+  void releaseUIDescription();
+
+  /**
+   * Enables/disables keeping the description between editor opens. Enabled by default, except in editor mode (so that
+   * reopening the editor picks up the changes saved to the xml file). */
+  void enableUIDescriptionCache(bool iEnable = true) { fUIDescriptionCacheEnabled = iEnable; }
+
+  /**
+   * @return the cache of the attribute values converted while creating views (`nullptr` when not initialized) */
+  Views::AttributeConversionCache *getAttributeConversionCache()
+  {
+    return fViewFactory ? &fViewFactory->getAttributeConversionCache() : nullptr;
+  }
+
+  // getGUIUpdateScheduler (`nullptr` unless enabled)
+  GUIUpdateScheduler *getGUIUpdateScheduler() const { return fGUIUpdateScheduler.get(); }
+
 public:
   // allocateMessage - API adapter
   IPtr<IMessage> allocateMessage() override;
@@ -157,6 +194,19 @@ private:
   // Maintains a reference to the ui description
   SharedPointer<UIDescription> fUIDescription{};
 
+  // whether this controller is a user of VstUtils::DataCacheManager::global()
+  bool fDataCacheManagerAcquired{false};
+
+  // whether this controller is a user of FilmStripCache::instance()
+  bool fFilmStripCacheAcquired{false};
+
+  // whether fUIDescription is kept when the editor closes
+#ifdef EDITOR_MODE
+  bool fUIDescriptionCacheEnabled{false};
+#else
+  bool fUIDescriptionCacheEnabled{true};
+#endif
+
   // The name of the template for the dialog window => empty means no dialog
   std::string fDialogTemplateName{};
 
@@ -166,6 +216,10 @@ private:
   // we keep a reference to the editor to be able to switch views
   VSTGUI::VST3Editor *fVST3Editor{};
 
+  // the rate at which the update scheduler delivers notifications (0 means no scheduler)
+  uint32 fGUIUpdateFramesPerSecond{0};
+  std::shared_ptr<GUIUpdateScheduler> fGUIUpdateScheduler{};
+
 };
 
 }
\ No newline at end of file
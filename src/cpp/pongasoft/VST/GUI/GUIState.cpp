@@ -275,7 +275,7 @@ tresult GUIState::init(VstParametersSPtr iVstParameters, IMessageProducer *iMess
 //------------------------------------------------------------------------
 std::unique_ptr<GUIParamCxMgr> GUIState::createParamCxMgr()
 {
-  return std::unique_ptr<GUIParamCxMgr>(new GUIParamCxMgr(this));
+  return std::unique_ptr<GUIParamCxMgr>(new GUIParamCxMgr(this, fParamFanOutRegistry));
 }
 
 //------------------------------------------------------------------------
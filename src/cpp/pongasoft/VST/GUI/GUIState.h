@@ -23,9 +23,11 @@
 #include <pongasoft/VST/GUI/Params/GUIVstParameter.h>
 #include <pongasoft/VST/GUI/Params/IGUIParameter.hpp>
 #include <pongasoft/VST/GUI/Params/GUIJmbParameter.h>
+#include <pongasoft/VST/GUI/Params/GUIParamCx.h>
 #include <pongasoft/VST/MessageProducer.h>
 #include "ParamAwareViews.h"
 #include "IDialogHandler.h"
+#include "GUIUpdateScheduler.h"
 
 namespace pongasoft::VST {
 
@@ -191,7 +193,8 @@ public:
 
   /**
    * The CustomView class automatically calls this method to get a handle of a ParamCxMgr used to register for interest
-   * and obtain GUIParam instances. See CustomView::registerXXX methods.
+   * and obtain GUIParam instances. See CustomView::registerXXX methods. All the managers share the connections to the
+   * parameters (one per parameter, see `GUIParamFanOutRegistry`).
    */
   std::unique_ptr<GUIParamCxMgr> createParamCxMgr();
 
@@ -206,6 +209,18 @@ public:
   template<typename T>
   tresult broadcast(JmbParam<T> const &iParamDef, T const &iMessage);
 
+  /**
+   * When set, the connections created by `createParamCxMgr` (so all the listeners and callbacks registered by
+   * views and `ParamAware` classes) deliver their notifications through this scheduler (see
+   * `GUIController::enableGUIUpdateScheduler`). */
+  void setUpdateScheduler(std::shared_ptr<GUIUpdateScheduler> iScheduler) { fUpdateScheduler = std::move(iScheduler); }
+
+  // getUpdateScheduler (`nullptr` when not enabled)
+  std::shared_ptr<GUIUpdateScheduler> const &getUpdateScheduler() const { return fUpdateScheduler; }
+
+  // getParamConnectionCount (number of dependents registered with the parameters, by all the views)
+  size_t getParamConnectionCount() const { return fParamFanOutRegistry->getConnectionCount(); }
+
   // getAllRegistrationOrder
   std::vector<ParamID> const &getAllRegistrationOrder() const { return fAllRegistrationOrder; }
 
@@ -258,6 +273,12 @@ protected:
   // order in which the parameters were registered
   std::vector<ParamID> fAllRegistrationOrder{};
 
+  // collapses/defers parameter change notifications (optional)
+  std::shared_ptr<GUIUpdateScheduler> fUpdateScheduler{};
+
+  // the connections to the parameters shared by all the managers created by createParamCxMgr
+  std::shared_ptr<GUIParamFanOutRegistry> fParamFanOutRegistry{std::make_shared<GUIParamFanOutRegistry>()};
+
 protected:
   // setParamNormalized
   tresult setParamNormalized(NormalizedState const *iNormalizedState);
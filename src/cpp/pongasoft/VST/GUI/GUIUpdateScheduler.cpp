@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "GUIUpdateScheduler.h"
+
+#include <algorithm>
+
+namespace pongasoft::VST::GUI {
+
+//------------------------------------------------------------------------
+// GUIUpdateScheduler::setFramesPerSecond
+//------------------------------------------------------------------------
+void GUIUpdateScheduler::setFramesPerSecond(uint32 iFramesPerSecond)
+{
+  if(fFramesPerSecond == iFramesPerSecond)
+    return;
+
+  fFramesPerSecond = iFramesPerSecond;
+
+  // the timer will be recreated (with the new interval) on the next notification
+  fTimer = nullptr;
+  flush();
+}
+
+//------------------------------------------------------------------------
+// GUIUpdateScheduler::schedule
+//------------------------------------------------------------------------
+void GUIUpdateScheduler::schedule(FObjectCx *iCx)
+{
+  fStats.fReceivedCount++;
+
+  if(fFramesPerSecond == 0)
+  {
+    fStats.fDeliveredCount++;
+    iCx->dispatchScheduledChange();
+    return;
+  }
+
+  if(fPendingSet.insert(iCx).second)
+    fPending.emplace_back(iCx);
+
+  if(!fTimer)
+    fTimer = AutoReleaseTimer::create(this, std::max<uint32>(1, 1000 / fFramesPerSecond));
+}
+
+//------------------------------------------------------------------------
+// GUIUpdateScheduler::cancel
+//------------------------------------------------------------------------
+void GUIUpdateScheduler::cancel(FObjectCx *iCx)
+{
+  if(fPendingSet.erase(iCx) > 0)
+    std::replace(fPending.begin(), fPending.end(), iCx, static_cast<FObjectCx *>(nullptr));
+
+  std::replace(fDelivering.begin(), fDelivering.end(), iCx, static_cast<FObjectCx *>(nullptr));
+}
+
+//------------------------------------------------------------------------
+// GUIUpdateScheduler::flush
+//------------------------------------------------------------------------
+void GUIUpdateScheduler::flush()
+{
+  // flush is not reentrant (a callback triggering a flush would deliver the remaining ones out of order)
+  if(!fDelivering.empty())
+    return;
+
+  // changes triggered while delivering are scheduled for the next tick
+  std::swap(fPending, fDelivering);
+  fPendingSet.clear();
+
+  for(size_t i = 0; i < fDelivering.size(); i++)
+  {
+    auto cx = fDelivering[i];
+    if(cx)
+    {
+      fStats.fDeliveredCount++;
+      cx->dispatchScheduledChange();
+    }
+  }
+
+  fDelivering.clear();
+}
+
+//------------------------------------------------------------------------
+// GUIUpdateScheduler::clear
+//------------------------------------------------------------------------
+void GUIUpdateScheduler::clear()
+{
+  fPending.clear();
+  fPendingSet.clear();
+  std::fill(fDelivering.begin(), fDelivering.end(), nullptr);
+  fTimer = nullptr;
+}
+
+//------------------------------------------------------------------------
+// GUIUpdateScheduler::onTimer
+//------------------------------------------------------------------------
+void GUIUpdateScheduler::onTimer(Timer * /* timer */)
+{
+  fStats.fTickCount++;
+
+  flush();
+
+  // nothing changed during this tick => no need to keep the timer running
+  if(fPending.empty())
+    fTimer = nullptr;
+}
+
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pongasoft/VST/FObjectCx.h>
+#include <pongasoft/VST/Timer.h>
+
+#include <unordered_set>
+#include <vector>
+
+namespace pongasoft::VST::GUI {
+
+/**
+ * Collects the parameter change notifications (of the connections it is set on) and delivers them once per tick
+ * (frame), the same listener/callback being notified only once per tick no matter how many times the parameter
+ * changed in between. This is useful when a parameter changes a lot faster than the screen can refresh (ex: a
+ * parameter updated by RT on every frame, or automation), as views (and callbacks) end up doing the work only once.
+ *
+ * The timer only runs while there are pending notifications.
+ *
+ * \note The scheduler is opt-in (see `GUIController::enableGUIUpdateScheduler`) because it changes the timing
+ *       semantic of listeners and callbacks: they are no longer invoked synchronously when the parameter changes
+ *       (so for example reading a parameter right after updating it is fine, but a callback will only see the
+ *       last value of the tick).
+ *
+ * This class is **not** thread safe and is meant to be used from the UI thread (event loop) only.
+ */
+class GUIUpdateScheduler : public IFObjectCxScheduler, ITimerCallback
+{
+public:
+  constexpr static uint32 kDefaultFramesPerSecond = 60;
+
+  /**
+   * Keeps track of how many notifications were received vs delivered (the difference being the ones collapsed) */
+  struct Stats
+  {
+    uint64 fReceivedCount{};
+    uint64 fDeliveredCount{};
+    uint64 fTickCount{};
+  };
+
+public:
+  // Constructor
+  explicit GUIUpdateScheduler(uint32 iFramesPerSecond = kDefaultFramesPerSecond) :
+    fFramesPerSecond{iFramesPerSecond}
+  {}
+
+  /**
+   * Changes the rate at which notifications are delivered. `0` means that they are delivered immediately (no
+   * collapsing). */
+  void setFramesPerSecond(uint32 iFramesPerSecond);
+
+  // getFramesPerSecond
+  uint32 getFramesPerSecond() const { return fFramesPerSecond; }
+
+  // schedule
+  void schedule(FObjectCx *iCx) override;
+
+  // cancel
+  void cancel(FObjectCx *iCx) override;
+
+  /**
+   * Delivers all the pending notifications right away (called on every tick). */
+  void flush();
+
+  /**
+   * Drops all the pending notifications without delivering them */
+  void clear();
+
+  // getPendingCount
+  size_t getPendingCount() const { return fPendingSet.size(); }
+
+  // isRunning (true when the timer is running)
+  bool isRunning() const { return fTimer != nullptr; }
+
+  // getStats
+  Stats const &getStats() const { return fStats; }
+
+  // resetStats
+  void resetStats() { fStats = {}; }
+
+  // disabling copy
+  GUIUpdateScheduler(GUIUpdateScheduler const &) = delete;
+  GUIUpdateScheduler& operator=(GUIUpdateScheduler const &) = delete;
+
+protected:
+  // onTimer
+  void onTimer(Timer *timer) override;
+
+private:
+  uint32 fFramesPerSecond;
+
+  // in order of (first) notification
+  std::vector<FObjectCx *> fPending{};
+  std::unordered_set<FObjectCx *> fPendingSet{};
+
+  // the ones being delivered by flush (a callback can close another connection while being invoked)
+  std::vector<FObjectCx *> fDelivering{};
+
+  Stats fStats{};
+
+  std::unique_ptr<AutoReleaseTimer> fTimer{};
+};
+
+}
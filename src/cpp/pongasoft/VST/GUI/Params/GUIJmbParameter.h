@@ -281,6 +281,12 @@ public:
     return std::make_unique<FObjectCxCallback>(const_cast<GUIJmbParameter *>(this), std::move(iChangeCallback));
   }
 
+  // getConnectionTarget
+  FObject *getConnectionTarget() const override
+  {
+    return const_cast<GUIJmbParameter *>(this);
+  }
+
   // asDiscreteParameter
   std::shared_ptr<GUIDiscreteParameter> asDiscreteParameter(int32 iStepCount) override;
 
@@ -341,6 +347,12 @@ public:
     return fJmbParameter->connect(iChangeCallback);
   }
 
+  // getConnectionTarget
+  FObject *getConnectionTarget() const override
+  {
+    return fJmbParameter->getConnectionTarget();
+  }
+
   // asDiscreteParameter
   std::shared_ptr <GUIDiscreteParameter> asDiscreteParameter(int32 iStepCount) override
   {
@@ -595,6 +607,10 @@ public:
   // connect
   inline std::unique_ptr<FObjectCx> connect(Parameters::ChangeCallback iChangeCallback) { DCHECK_F(exists()); return fPtr->connect(std::move(iChangeCallback)); }
 
+  /**
+   * @copydoc IGUIParameter::getConnectionTarget() const */
+  inline FObject *getConnectionTarget() const { DCHECK_F(exists()); return fPtr->getConnectionTarget(); }
+
 private:
   std::shared_ptr<GUIJmbParameter<T>> fPtr;
 };
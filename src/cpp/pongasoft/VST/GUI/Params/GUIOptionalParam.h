@@ -178,6 +178,10 @@ public:
     return fParameter->connect(iChangeCallback);
   }
 
+  /**
+   * @copydoc IGUIParameter::getConnectionTarget() const */
+  inline FObject *getConnectionTarget() const { return fParameter->getConnectionTarget(); }
+
 private:
   std::shared_ptr<ITGUIParameter<ParamType>> fParameter;
 };
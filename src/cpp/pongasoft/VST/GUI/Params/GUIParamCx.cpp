@@ -53,6 +53,151 @@ void GUIParamCx::onTargetChange()
     fChangeListener->onParameterChange(fParamID);
 }
 
+//------------------------------------------------------------------------
+// GUIParamFanOutCx::~GUIParamFanOutCx
+//------------------------------------------------------------------------
+GUIParamFanOutCx::~GUIParamFanOutCx()
+{
+  if(fDestroyed)
+    *fDestroyed = true;
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutCx::add
+//------------------------------------------------------------------------
+void GUIParamFanOutCx::add(Entry *iEntry)
+{
+  iEntry->fCx = this;
+  iEntry->fIndex = fEntries.size();
+  fEntries.emplace_back(iEntry);
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutCx::remove
+//------------------------------------------------------------------------
+void GUIParamFanOutCx::remove(Entry *iEntry)
+{
+  DCHECK_F(iEntry->fCx == this && fEntries[iEntry->fIndex] == iEntry);
+
+  fEntries[iEntry->fIndex] = nullptr;
+  iEntry->fCx = nullptr;
+  fFreeSlotCount++;
+
+  // the entries are not moved while being dispatched
+  if(fDispatchDepth == 0 && fFreeSlotCount > fEntries.size() / 2)
+    compact();
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutCx::compact
+//------------------------------------------------------------------------
+void GUIParamFanOutCx::compact()
+{
+  size_t index = 0;
+  for(auto entry: fEntries)
+  {
+    if(entry)
+    {
+      entry->fIndex = index;
+      fEntries[index++] = entry;
+    }
+  }
+  fEntries.resize(index);
+  fFreeSlotCount = 0;
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutCx::close
+//------------------------------------------------------------------------
+void GUIParamFanOutCx::close()
+{
+  for(auto entry: fEntries)
+  {
+    if(entry)
+      entry->fCx = nullptr;
+  }
+  fEntries.clear();
+  fFreeSlotCount = 0;
+  FObjectCx::close();
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutCx::onTargetChange
+//------------------------------------------------------------------------
+void GUIParamFanOutCx::onTargetChange()
+{
+  // an entry may end up destroying this connection (ex: a view deleted as a result of a parameter change)
+  bool destroyed = false;
+  auto previous = fDestroyed;
+  fDestroyed = &destroyed;
+  fDispatchDepth++;
+
+  // entries added while dispatching are not notified of this change (entries removed are skipped)
+  auto count = fEntries.size();
+  for(size_t i = 0; i < count && i < fEntries.size(); i++)
+  {
+    auto entry = fEntries[i];
+    if(!entry)
+      continue;
+
+    if(entry->fIsSuspended)
+    {
+      entry->fChangedWhileSuspended = true;
+      continue;
+    }
+
+    entry->invoke();
+    if(destroyed)
+    {
+      // propagates to the outer dispatch (if any)
+      if(previous)
+        *previous = true;
+      return;
+    }
+  }
+
+  fDispatchDepth--;
+  fDestroyed = previous;
+
+  if(fDispatchDepth == 0 && fFreeSlotCount > fEntries.size() / 2)
+    compact();
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutRegistry::add
+//------------------------------------------------------------------------
+void GUIParamFanOutRegistry::add(FObject *iTarget,
+                                 GUIParamFanOutCx::Entry *iEntry,
+                                 std::shared_ptr<IFObjectCxScheduler> const &iScheduler)
+{
+  auto &cx = fCxs[iTarget];
+
+  if(!cx)
+  {
+    cx = std::make_unique<GUIParamFanOutCx>(iTarget);
+    if(iScheduler)
+      cx->setScheduler(iScheduler);
+  }
+
+  cx->add(iEntry);
+}
+
+//------------------------------------------------------------------------
+// GUIParamFanOutRegistry::remove
+//------------------------------------------------------------------------
+void GUIParamFanOutRegistry::remove(GUIParamFanOutCx::Entry *iEntry)
+{
+  auto cx = iEntry->fCx;
+  if(!cx)
+    return;
+
+  cx->remove(iEntry);
+
+  // last entry => no need to listen anymore (removes the dependent)
+  if(cx->getEntryCount() == 0)
+    fCxs.erase(cx->getTarget());
+}
+
 }
 }
 }
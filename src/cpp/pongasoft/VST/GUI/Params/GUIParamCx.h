@@ -22,6 +22,10 @@
 #include <pongasoft/VST/Parameters.h>
 #include <pongasoft/VST/FObjectCx.h>
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 namespace pongasoft {
 namespace VST {
 namespace GUI {
@@ -57,6 +61,111 @@ protected:
   Parameters::IChangeListener *fChangeListener;
 };
 
+/**
+ * A single connection to a parameter shared by many listeners and callbacks: only one dependent is registered with the
+ * target (`FObject::addDependent` uses a global locked structure) and changes are fanned out internally to all the
+ * entries. The entries themselves are owned (and allocated) by the caller (see `GUIParamCxMgr`) and must be removed
+ * before being destroyed. The connections are shared by all the views of a `GUIState` (see
+ * `GUIParamFanOutRegistry`).
+ */
+class GUIParamFanOutCx : public FObjectCx
+{
+public:
+  /**
+   * Either a listener (notified with the param ID) or a callback */
+  struct Entry
+  {
+    ParamID fParamID{};
+    Parameters::IChangeListener *fChangeListener{};
+    Parameters::ChangeCallback fChangeCallback{};
+
+    // a suspended entry is not invoked but remembers that the parameter changed (see `GUIParamCxMgr::suspendAll`)
+    bool fIsSuspended{false};
+    bool fChangedWhileSuspended{false};
+
+    // invoke
+    inline void invoke() const
+    {
+      if(fChangeListener)
+        fChangeListener->onParameterChange(fParamID);
+      else if(fChangeCallback)
+        fChangeCallback();
+    }
+
+    // the connection this entry belongs to and its position in it (managed by the connection)
+    GUIParamFanOutCx *fCx{};
+    size_t fIndex{};
+  };
+
+public:
+  // Constructor
+  explicit GUIParamFanOutCx(FObject *iTarget) : FObjectCx(iTarget) {}
+
+  // Destructor
+  ~GUIParamFanOutCx() override;
+
+  // add
+  void add(Entry *iEntry);
+
+  /**
+   * Removes the entry (constant time: the slot is freed and the entries are compacted once enough slots are free) */
+  void remove(Entry *iEntry);
+
+  // getEntryCount
+  inline size_t getEntryCount() const { return fEntries.size() - fFreeSlotCount; }
+
+  // getTarget
+  inline FObject *getTarget() const { return fTarget; }
+
+  // close
+  void close() override;
+
+  // onTargetChange => invokes all the entries (in the order they were added)
+  void onTargetChange() override;
+
+  // disabling copy
+  GUIParamFanOutCx(GUIParamFanOutCx const &) = delete;
+  GUIParamFanOutCx& operator=(GUIParamFanOutCx const &) = delete;
+
+private:
+  // compact (removes the free slots, preserving the order)
+  void compact();
+
+private:
+  std::vector<Entry *> fEntries{};
+  size_t fFreeSlotCount{};
+  int fDispatchDepth{};
+
+  // set while dispatching so that an entry destroying this connection stops the dispatch
+  bool *fDestroyed{};
+};
+
+/**
+ * Maintains one `GUIParamFanOutCx` per target for all the `GUIParamCxMgr` created by a `GUIState` (so for all the
+ * views of the editor): no matter how many views listen to a parameter, only one dependent is registered with it.
+ * The connection is closed when its last entry is removed.
+ *
+ * @internal
+ */
+class GUIParamFanOutRegistry
+{
+public:
+  /**
+   * Adds the entry to the connection to `iTarget` (created, with `iScheduler`, if this is the first entry for this
+   * target) */
+  void add(FObject *iTarget, GUIParamFanOutCx::Entry *iEntry, std::shared_ptr<IFObjectCxScheduler> const &iScheduler);
+
+  /**
+   * Removes the entry (closes the connection if it was the last one) */
+  void remove(GUIParamFanOutCx::Entry *iEntry);
+
+  // getConnectionCount (number of dependents registered with the parameters)
+  inline size_t getConnectionCount() const { return fCxs.size(); }
+
+private:
+  std::unordered_map<FObject *, std::unique_ptr<GUIParamFanOutCx>> fCxs{};
+};
+
 }
 }
 }
@@ -17,6 +17,8 @@
  */
 #include "GUIParamCxMgr.h"
 
+#include <algorithm>
+
 namespace pongasoft::VST::GUI::Params {
 
 //------------------------------------------------------------------------
@@ -24,9 +26,59 @@ namespace pongasoft::VST::GUI::Params {
 //------------------------------------------------------------------------
 void GUIParamCxMgr::invokeAll()
 {
+  // Implementation note: iterating by index as a callback may register new ones (which are not invoked) or
+  // unregister everything
+  auto count = fRegistrations.size();
+  for(size_t i = 0; i < count && i < fRegistrations.size(); i++)
+  {
+    auto const &registration = fRegistrations[i];
+    if(registration.fEntry)
+      registration.fEntry->invoke();
+    else
+      registration.fParamCx->onTargetChange();
+  }
+}
+
+//------------------------------------------------------------------------
+// GUIParamCxMgr::suspendAll
+//------------------------------------------------------------------------
+void GUIParamCxMgr::suspendAll()
+{
+  // the connections are shared => suspending the entries only
+  for(auto &it: fEntries)
+  {
+    it.fIsSuspended = true;
+  }
+
   for(auto &it: fParamCxs)
   {
-    it->onTargetChange();
+    it->suspend();
+  }
+}
+
+//------------------------------------------------------------------------
+// GUIParamCxMgr::resumeAll
+//------------------------------------------------------------------------
+void GUIParamCxMgr::resumeAll()
+{
+  // Implementation note: iterating by index as a callback may register new ones or unregister everything
+  for(size_t i = 0; i < fRegistrations.size(); i++)
+  {
+    auto const &registration = fRegistrations[i];
+    if(auto entry = registration.fEntry)
+    {
+      if(entry->fIsSuspended)
+      {
+        entry->fIsSuspended = false;
+        if(entry->fChangedWhileSuspended)
+        {
+          entry->fChangedWhileSuspended = false;
+          entry->invoke();
+        }
+      }
+    }
+    else
+      registration.fParamCx->resume();
   }
 }
 
@@ -35,9 +87,57 @@ void GUIParamCxMgr::invokeAll()
 //------------------------------------------------------------------------
 void GUIParamCxMgr::unregisterAll()
 {
+  // the entries must be removed from the (shared) connections before being released
+  for(auto &it: fEntries)
+  {
+    fFanOutRegistry->remove(&it);
+  }
+
+  fRegistrations.clear();
+  fEntries.clear();
   fParamCxs.clear();
 }
 
+//------------------------------------------------------------------------
+// GUIParamCxMgr::getConnectionCount
+//------------------------------------------------------------------------
+size_t GUIParamCxMgr::getConnectionCount() const
+{
+  std::vector<GUIParamFanOutCx const *> cxs{};
+  for(auto const &it: fEntries)
+  {
+    if(it.fCx && std::find(cxs.begin(), cxs.end(), it.fCx) == cxs.end())
+      cxs.emplace_back(it.fCx);
+  }
+  return cxs.size() + fParamCxs.size();
+}
+
+//------------------------------------------------------------------------
+// GUIParamCxMgr::addParamCx
+//------------------------------------------------------------------------
+void GUIParamCxMgr::addParamCx(std::unique_ptr<FObjectCx> iParamCx)
+{
+  if(!iParamCx)
+    return;
+
+  auto const &scheduler = fGUIState->getUpdateScheduler();
+  if(scheduler)
+    iParamCx->setScheduler(scheduler);
+
+  fRegistrations.emplace_back(Registration{nullptr, iParamCx.get()});
+  fParamCxs.emplace_back(std::move(iParamCx));
+}
+
+//------------------------------------------------------------------------
+// GUIParamCxMgr::addFanOutEntry
+//------------------------------------------------------------------------
+void GUIParamCxMgr::addFanOutEntry(FObject *iTarget, GUIParamFanOutCx::Entry iEntry)
+{
+  auto entry = &fEntries.emplace_back(std::move(iEntry));
+  fFanOutRegistry->add(iTarget, entry, fGUIState->getUpdateScheduler());
+  fRegistrations.emplace_back(Registration{entry, nullptr});
+}
+
 //------------------------------------------------------------------------
 // GUIParamCxMgr::registerOptionalDiscreteParam
 //------------------------------------------------------------------------
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <pongasoft/VST/GUI/GUIState.h>
+#include "GUIParamCx.h"
+#include <deque>
+#include <unordered_map>
 #include <vector>
 
 namespace pongasoft::VST::GUI::Params {
@@ -26,6 +29,13 @@ namespace pongasoft::VST::GUI::Params {
  * Maintains the connections established between parameters and its listeners/callbacks. All the connections are
  * properly closed when this class is destroyed.
  *
+ * Registering a listener or a callback on a parameter does not create a connection per listener: the `GUIState`
+ * maintains only one connection (`GUIParamFanOutCx`, see `GUIParamFanOutRegistry`) per underlying parameter, shared by
+ * all the managers it creates (one per view/`ParamAware`), which is the only one registered as a dependent of the
+ * parameter and fans out the changes to all the listeners/callbacks registered on it. This class only owns its
+ * listeners/callbacks (allocated in a `std::deque`: stable addresses, no per entry allocation) which are removed in
+ * bulk by `unregisterAll` (the dependent being removed from the parameter when its last entry goes away).
+ *
  * @internal
  */
 class GUIParamCxMgr
@@ -200,25 +210,66 @@ public:
   inline GUIState *getGUIState() const { return fGUIState; };
 
   /**
-   * Invoke all registered callbacks and listeners */
+   * @return the number of connections used by this manager (which is the number of distinct parameters listened to,
+   *         not the number of listeners/callbacks). Note that the connections are shared with the other managers
+   *         created by the same `GUIState`. */
+  size_t getConnectionCount() const;
+
+  /**
+   * Invoke all registered callbacks and listeners (in registration order) */
   void invokeAll();
 
+  /**
+   * Suspends all the connections: callbacks and listeners are no longer invoked until `resumeAll` is called
+   * (for example while a view is hidden). */
+  void suspendAll();
+
+  /**
+   * Resumes all the connections, invoking (once) the callbacks and listeners whose parameter changed while
+   * suspended. */
+  void resumeAll();
+
   friend class GUI::GUIState;
 
 protected:
-  explicit GUIParamCxMgr(GUIState *iGUIState) : fGUIState{iGUIState}
+  GUIParamCxMgr(GUIState *iGUIState, std::shared_ptr<GUIParamFanOutRegistry> iFanOutRegistry) :
+    fGUIState{iGUIState},
+    fFanOutRegistry{std::move(iFanOutRegistry)}
   {
     DCHECK_F(fGUIState != nullptr);
+    DCHECK_F(fFanOutRegistry != nullptr);
   }
 
+public:
+  // Destructor (removes the entries from the shared connections)
+  ~GUIParamCxMgr() { unregisterAll(); }
+
+  // disabling copy
+  GUIParamCxMgr(GUIParamCxMgr const &) = delete;
+  GUIParamCxMgr& operator=(GUIParamCxMgr const &) = delete;
+
+protected:
+
   template<typename TParam>
   inline TParam __registerListener(TParam iParam, Parameters::IChangeListener *iChangeListener)
   {
     if(iParam.exists() && iChangeListener)
-      fParamCxs.emplace_back(iParam.connect(iChangeListener));
+    {
+      auto target = iParam.getConnectionTarget();
+      if(target)
+        addFanOutEntry(target, {iParam.getParamID(), iChangeListener, {}});
+      else
+        addParamCx(iParam.connect(iChangeListener));
+    }
     return iParam;
   }
 
+  // addParamCx (the connection uses the update scheduler of the GUIState if there is one)
+  void addParamCx(std::unique_ptr<FObjectCx> iParamCx);
+
+  // addFanOutEntry (adds the entry to the connection (shared across managers) to iTarget)
+  void addFanOutEntry(FObject *iTarget, GUIParamFanOutCx::Entry iEntry);
+
   template<typename TParam>
   TParam __registerCallback(TParam iParam, Parameters::ChangeCallback iCallback, bool iInvokeCallback);
 
@@ -229,8 +280,22 @@ private:
   // the gui state
   GUIState *fGUIState;
 
+  // The shared connections (owned by the GUIState but kept alive as long as this manager exists)
+  std::shared_ptr<GUIParamFanOutRegistry> fFanOutRegistry;
+
   // Maintains the connections for the listeners and callbacks... will be automatically discarded in the destructor
   std::vector<std::unique_ptr<FObjectCx>> fParamCxs{};
+
+  // All the listeners/callbacks handled by a (shared) fan out connection
+  std::deque<GUIParamFanOutCx::Entry> fEntries{};
+
+  // Either an entry or a connection (in registration order, for invokeAll)
+  struct Registration
+  {
+    GUIParamFanOutCx::Entry *fEntry{};
+    FObjectCx *fParamCx{};
+  };
+  std::vector<Registration> fRegistrations{};
 };
 
 }
@@ -107,7 +107,11 @@ inline TParam GUIParamCxMgr::__registerCallback(TParam iParam, Parameters::Chang
     if(iInvokeCallback)
       iCallback();
 
-    fParamCxs.emplace_back(iParam.connect(std::move(iCallback)));
+    auto target = iParam.getConnectionTarget();
+    if(target)
+      addFanOutEntry(target, {iParam.getParamID(), nullptr, std::move(iCallback)});
+    else
+      addParamCx(iParam.connect(std::move(iCallback)));
   }
 
   return iParam;
@@ -136,7 +140,11 @@ inline TParam GUIParamCxMgr::__registerCallback1(TParam iParam,
     if(iInvokeCallback)
       callback();
 
-    fParamCxs.emplace_back(iParam.connect(std::move(callback)));
+    auto target = iParam.getConnectionTarget();
+    if(target)
+      addFanOutEntry(target, {iParam.getParamID(), nullptr, std::move(callback)});
+    else
+      addParamCx(iParam.connect(std::move(callback)));
   }
 
   return iParam;
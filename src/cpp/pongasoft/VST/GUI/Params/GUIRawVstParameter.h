@@ -233,6 +233,12 @@ public:
     return fVstParameters->connect(fParamID, std::move(iChangeCallback));
   }
 
+  // getConnectionTarget
+  FObject *getConnectionTarget() const override
+  {
+    return fVstParameters->getParameterObject(fParamID);
+  }
+
   /**
    * Converts to a typed parameter
    * @return `nullptr` if the underlying parameter is not of proper type
@@ -365,6 +371,10 @@ public:
    */
   inline std::unique_ptr<FObjectCx> connect(Parameters::ChangeCallback iChangeCallback) const { DCHECK_F(exists()); return fPtr->connect(std::move(iChangeCallback)); }
 
+  /**
+   * @copydoc IGUIParameter::getConnectionTarget() const */
+  inline FObject *getConnectionTarget() const { DCHECK_F(exists()); return fPtr->getConnectionTarget(); }
+
 private:
   std::shared_ptr<GUIRawVstParameter> fPtr;
 };
@@ -171,6 +171,12 @@ public:
     return std::make_unique<FObjectCxCallback>(const_cast<GUIValParameter *>(this), iChangeCallback);
   }
 
+  // getConnectionTarget
+  FObject *getConnectionTarget() const override
+  {
+    return const_cast<GUIValParameter *>(this);
+  }
+
   // asDiscreteParameter
   std::shared_ptr<GUIDiscreteParameter> asDiscreteParameter(int32 iStepCount) override;
 
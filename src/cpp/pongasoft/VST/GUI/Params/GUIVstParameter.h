@@ -254,6 +254,12 @@ public:
     return fRawParameter->connect(std::move(iChangeCallback));
   }
 
+  // getConnectionTarget
+  FObject *getConnectionTarget() const override
+  {
+    return fRawParameter->getConnectionTarget();
+  }
+
   // asDiscreteParameter
   std::shared_ptr<GUIDiscreteParameter> asDiscreteParameter(int32 iStepCount) override
   {
@@ -416,6 +422,10 @@ public:
    */
   inline std::unique_ptr<FObjectCx> connect(Parameters::ChangeCallback iChangeCallback) const { DCHECK_F(exists()); return fPtr->connect(std::move(iChangeCallback)); }
 
+  /**
+   * @copydoc IGUIParameter::getConnectionTarget() const */
+  inline FObject *getConnectionTarget() const { DCHECK_F(exists()); return fPtr->getConnectionTarget(); }
+
 private:
   std::shared_ptr<GUIVstParameter<T>> fPtr;
 };
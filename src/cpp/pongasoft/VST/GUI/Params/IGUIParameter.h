@@ -132,6 +132,13 @@ public:
    */
   virtual std::unique_ptr<FObjectCx> connect(Parameters::ChangeCallback iChangeCallback) const = 0;
 
+  /**
+   * @return the object notifying the changes of this parameter (the target of the connections created by `connect`)
+   *         or `nullptr` if not available. `GUIParamCxMgr` uses it to share a single connection between all the
+   *         listeners and callbacks registered for the same parameter.
+   */
+  virtual FObject *getConnectionTarget() const { return nullptr; }
+
 public:
   /**
    * Downcasts this parameter into a typed version.
@@ -434,6 +441,10 @@ public:
    * @copydoc IGUIParameter::connect(Parameters::ChangeCallback) const */
   std::unique_ptr<FObjectCx> connect(Parameters::ChangeCallback iChangeCallback) const { DCHECK_F(exists()); return fPtr->connect(std::move(iChangeCallback)); }
 
+  /**
+   * @copydoc IGUIParameter::getConnectionTarget() const */
+  inline FObject *getConnectionTarget() const { DCHECK_F(exists()); return fPtr->getConnectionTarget(); }
+
 private:
   std::shared_ptr<IGUIParameter> fPtr;
 };
@@ -109,6 +109,24 @@ void ParamAware::invokeAll()
     fParamCxMgr->invokeAll();
 }
 
+//------------------------------------------------------------------------
+// ParamAware::suspendAll
+//------------------------------------------------------------------------
+void ParamAware::suspendAll()
+{
+  if(fParamCxMgr)
+    fParamCxMgr->suspendAll();
+}
+
+//------------------------------------------------------------------------
+// ParamAware::resumeAll
+//------------------------------------------------------------------------
+void ParamAware::resumeAll()
+{
+  if(fParamCxMgr)
+    fParamCxMgr->resumeAll();
+}
+
 //------------------------------------------------------------------------
 // ParamAware::registerOptionalDiscreteParam
 //------------------------------------------------------------------------
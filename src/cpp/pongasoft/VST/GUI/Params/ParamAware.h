@@ -546,6 +546,16 @@ public:
    * Invoke all (currently) registered callbacks and `onParameterChange()` (if registered). */
   void invokeAll();
 
+  /**
+   * Suspends all (currently) registered callbacks and `onParameterChange()` (for example while the view is hidden
+   * and kept in a cache, see `SwitchViewContainer`). */
+  void suspendAll();
+
+  /**
+   * Resumes all the suspended callbacks and `onParameterChange()`, invoking (once) the ones whose parameter has
+   * changed while suspended. */
+  void resumeAll();
+
 protected:
   // Access to parameters
   std::unique_ptr<GUIParamCxMgr> fParamCxMgr{};
@@ -16,8 +16,12 @@
  * @author Yan Pujante
  */
 #include <vstgui4/vstgui/lib/cdrawcontext.h>
+#include <vstgui4/vstgui/lib/coffscreencontext.h>
 #include "CustomView.h"
 #include <pongasoft/VST/GUI/Views/CustomViewFactory.h>
+#include <pongasoft/VST/GUI/DrawContext.h>
+
+#include <chrono>
 
 namespace pongasoft::VST::GUI::Views {
 
@@ -56,6 +60,138 @@ void CustomView::drawBackColor(CDrawContext *iContext)
   }
 }
 
+//------------------------------------------------------------------------
+// CustomView::drawRect
+//------------------------------------------------------------------------
+void CustomView::drawRect(CDrawContext *iContext, const CRect &iUpdateRect)
+{
+  auto const &viewSize = getViewSize();
+  fUpdateRect = iUpdateRect;
+  fUpdateRect.offset(-viewSize.left, -viewSize.top);
+  fDrawing = true;
+
+  if(fDrawStats)
+  {
+    auto start = std::chrono::steady_clock::now();
+    CView::drawRect(iContext, iUpdateRect);
+    auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    fDrawing = false;
+
+    fDrawStats->fDrawCount++;
+    fDrawStats->fLastDrawMilliseconds = ms;
+    fDrawStats->fTotalDrawMilliseconds += ms;
+    fDrawStats->fMaxDrawMilliseconds = std::max(fDrawStats->fMaxDrawMilliseconds, ms);
+    fDrawStats->fLastUpdateRect = fUpdateRect;
+    onDrawStats(*fDrawStats);
+  }
+  else
+  {
+    CView::drawRect(iContext, iUpdateRect);
+    fDrawing = false;
+  }
+}
+
+//------------------------------------------------------------------------
+// CustomView::intersectsUpdateRect
+//------------------------------------------------------------------------
+bool CustomView::intersectsUpdateRect(CRect const &iRect) const
+{
+  if(!fDrawing)
+    return true;
+
+  // Implementation note: CRect::rectOverlap considers rects sharing an edge as overlapping
+  CRect intersection{fUpdateRect};
+  intersection.bound(iRect);
+  return !intersection.isEmpty();
+}
+
+//------------------------------------------------------------------------
+// CustomView::markDirty
+//------------------------------------------------------------------------
+void CustomView::markDirty(CRect const &iRect)
+{
+  auto const &viewSize = getViewSize();
+  CRect rect{iRect};
+  rect.offset(viewSize.left, viewSize.top);
+  rect.bound(viewSize);
+  if(!rect.isEmpty())
+    invalidRect(rect);
+}
+
+//------------------------------------------------------------------------
+// CustomView::drawStaticLayer
+//------------------------------------------------------------------------
+void CustomView::drawStaticLayer(CDrawContext *iContext)
+{
+  if(getBackColor().alpha != 0)
+  {
+    iContext->setFillColor(getBackColor());
+    iContext->drawRect(CRect{0, 0, getWidth(), getHeight()}, kDrawFilled);
+  }
+}
+
+//------------------------------------------------------------------------
+// CustomView::drawCachedStaticLayer
+//------------------------------------------------------------------------
+void CustomView::drawCachedStaticLayer(CDrawContext *iContext)
+{
+  auto const &viewSize = getViewSize();
+
+  // the scale factor includes the zoom of the current transform (the resolution VSTGUI draws the bitmap at)
+  auto scaleFactor = getBitmapScaleFactor(iContext);
+
+  // the size of the view or the scale factor changed => render again
+  if(fStaticLayer && (fStaticLayer->getWidth() != viewSize.getWidth() ||
+                      fStaticLayer->getHeight() != viewSize.getHeight() ||
+                      fStaticLayerScaleFactor != scaleFactor))
+    fStaticLayer = nullptr;
+
+  // when the transform is not a uniform scale, there is no single resolution to render at => draw directly
+  if(!fStaticLayer && scaleFactor)
+  {
+    auto offscreen = COffscreenContext::create(viewSize.getSize(), *scaleFactor);
+    if(offscreen)
+    {
+      offscreen->beginDraw();
+      drawStaticLayer(offscreen.get());
+      offscreen->endDraw();
+      fStaticLayer = offscreen->getBitmap();
+      fStaticLayerScaleFactor = *scaleFactor;
+    }
+  }
+
+  if(fStaticLayer)
+  {
+    fStaticLayer->draw(iContext, viewSize);
+  }
+  else
+  {
+    // offscreen rendering not available (or transform not a uniform scale) => draw directly
+    CDrawContext::Transform transform{*iContext, CGraphicsTransform().translate(viewSize.getTopLeft())};
+    drawStaticLayer(iContext);
+  }
+}
+
+//------------------------------------------------------------------------
+// CustomView::invalidateStaticLayer
+//------------------------------------------------------------------------
+void CustomView::invalidateStaticLayer()
+{
+  fStaticLayer = nullptr;
+  markDirty();
+}
+
+//------------------------------------------------------------------------
+// CustomView::enableDrawStats
+//------------------------------------------------------------------------
+void CustomView::enableDrawStats(bool iEnable)
+{
+  if(iEnable)
+    fDrawStats = std::make_unique<DrawStats>();
+  else
+    fDrawStats = nullptr;
+}
+
 ///////////////////////////////////////////
 // CustomView::setBackColor
 ///////////////////////////////////////////
@@ -74,15 +210,31 @@ void CustomView::setBackColor(CColor const &iColor)
 ///////////////////////////////////////////
 void CustomView::drawStyleChanged()
 {
-  markDirty();
+  invalidateStaticLayer();
 }
 
 ///////////////////////////////////////////
 // CustomView::onParameterChange
 ///////////////////////////////////////////
-void CustomView::onParameterChange(ParamID /* iParamID */)
+void CustomView::onParameterChange(ParamID iParamID)
 {
-  markDirty();
+  CRect rect{};
+  if(getParamDirtyRect(iParamID, rect))
+    markDirty(rect);
+  else
+    markDirty();
+}
+
+//------------------------------------------------------------------------
+// CustomView::getParamDirtyRect
+//------------------------------------------------------------------------
+bool CustomView::getParamDirtyRect(ParamID iParamID, CRect &oRect) const
+{
+  auto iter = fParamDirtyRects.find(iParamID);
+  if(iter == fParamDirtyRects.end())
+    return false;
+  oRect = iter->second;
+  return true;
 }
 
 ///////////////////////////////////////////
@@ -19,6 +19,7 @@
 
 #include <vstgui4/vstgui/lib/cview.h>
 #include <map>
+#include <memory>
 #include <pongasoft/VST/GUI/GUIState.h>
 #include <pongasoft/VST/GUI/Params/ParamAware.hpp>
 #include <pongasoft/VST/GUI/Views/CustomViewFactory.h>
@@ -47,6 +48,35 @@ using namespace Params;
  * - `onParameterChange()` to react to parameters that have changed (don't forget to call `markDirty()` or delegate to
  *   this class for the view to be redrawn).
  *
+ * Large views which depend on many parameters (ex: a grid of steps) can avoid redrawing everything when a single
+ * parameter changes:
+ *
+ * - `setParamDirtyRect()` (or overriding `getParamDirtyRect()`) limits the area marked dirty by `onParameterChange()`
+ * - `intersectsUpdateRect()` lets `draw()` skip what is outside of the area being redrawn
+ * - `drawCachedStaticLayer()` draws the static content (background, grid...) from an offscreen bitmap rendered once
+ * - `enableDrawStats()` measures how long `draw()` takes
+ *
+ * ```
+ * // Example (grid of 64 steps, one parameter per step)
+ * void registerParameters() override {
+ *   for(int i = 0; i < 64; i++)
+ *   {
+ *     fSteps[i] = registerParam(fParams->fSteps[i]);
+ *     setParamDirtyRect(fSteps[i].getParamID(), computeCellRect(i));
+ *   }
+ * }
+ *
+ * void draw(CDrawContext *iContext) override {
+ *   drawCachedStaticLayer(iContext); // background and grid lines
+ *   for(int i = 0; i < 64; i++)
+ *   {
+ *     if(intersectsUpdateRect(computeCellRect(i)))
+ *       drawCell(iContext, i);
+ *   }
+ *   setDirty(false);
+ * }
+ * ```
+ *
  * In addition to the attributes exposed by `CView`, this class exposes the following attributes:
  *
  * Attribute         | Description
@@ -158,16 +188,38 @@ public:
   virtual void drawBackColor(CDrawContext *iContext);
 
   /**
-   * Called when the draw style is changed (simply marks the view dirty)
+   * Overridden to record the area being redrawn (see `intersectsUpdateRect()`) and to measure how long `draw()` takes
+   * (when enabled with `enableDrawStats()`) */
+  void drawRect(CDrawContext *iContext, const CRect &iUpdateRect) override;
+
+  /**
+   * Called when the draw style is changed (discards the cached static layer and marks the view dirty)
    */
   void drawStyleChanged();
 
   /**
-   * Callback when a parameter changes. By default simply marks the view as dirty. This method is intended to be
+   * Callback when a parameter changes. By default marks the area of the view which depends on the parameter as dirty
+   * (see `getParamDirtyRect()`), or the whole view if there is no such area. This method is intended to be
    * overriden to implement specific behavior.
    */
   void onParameterChange(ParamID iParamID) override;
 
+  /**
+   * Defines which area of the view depends on the parameter, so that when it changes, only this area is redrawn
+   * (by `onParameterChange()`).
+   *
+   * @param iRect relative to the view (`0,0` is the top left corner of the view) */
+  void setParamDirtyRect(ParamID iParamID, CRect const &iRect) { fParamDirtyRects[iParamID] = iRect; }
+
+  //! Removes all the areas set with `setParamDirtyRect()`
+  void clearParamDirtyRects() { fParamDirtyRects.clear(); }
+
+  /**
+   * @return `true` if only an area of the view depends on the parameter, in which case `oRect` is set to this area
+   *         (relative to the view). The default implementation returns what was set with `setParamDirtyRect()`, but
+   *         it can be overridden to compute it instead (ex: the cell of a grid from the parameter id). */
+  virtual bool getParamDirtyRect(ParamID iParamID, CRect &oRect) const;
+
   /**
    * Marks this view dirty which will (at the appropriate time in the rendering lifecycle) trigger a call to `draw()`
    *
@@ -176,6 +228,49 @@ public:
    */
   inline void markDirty() { setDirty(true); }
 
+  /**
+   * Marks only an area of this view dirty. `draw()` will be invoked with a clip limited to the area(s) marked dirty
+   * and can use `intersectsUpdateRect()` to skip what is outside.
+   *
+   * @param iRect relative to the view (`0,0` is the top left corner of the view) */
+  void markDirty(CRect const &iRect);
+
+  /**
+   * @return `true` if the area (relative to the view) needs to be drawn: when called from `draw()`, whether it
+   *         intersects the area being redrawn, `true` otherwise */
+  bool intersectsUpdateRect(CRect const &iRect) const;
+
+  /**
+   * Statistics about the time spent in `draw()` (see `enableDrawStats()`) */
+  struct DrawStats
+  {
+    uint64 fDrawCount{0};
+    double fLastDrawMilliseconds{0};
+    double fTotalDrawMilliseconds{0};
+    double fMaxDrawMilliseconds{0};
+    CRect fLastUpdateRect{}; // relative to the view
+
+    inline double getAverageDrawMilliseconds() const { return fDrawCount > 0 ? fTotalDrawMilliseconds / fDrawCount : 0; }
+  };
+
+  /**
+   * Enables (or disables) measuring the time spent in `draw()` (disabled by default). After each draw,
+   * `onDrawStats()` is invoked and the stats are available with `getDrawStats()`. */
+  void enableDrawStats(bool iEnable = true);
+
+  //! @return the stats or `nullptr` when not enabled (see `enableDrawStats()`)
+  DrawStats const *getDrawStats() const { return fDrawStats.get(); }
+
+  /**
+   * Called after each draw when the stats are enabled (see `enableDrawStats()`). Can be overridden to log or
+   * display the draw time (ex: in editor mode). */
+  virtual void onDrawStats(DrawStats const &iStats) {}
+
+  /**
+   * Discards the cached static layer (and marks the view dirty). Must be called when what `drawStaticLayer()`
+   * draws changes (the size of the view and the scale factor are handled automatically). */
+  void invalidateStaticLayer();
+
   /**
    * Handles the lifecycle behavior getting triggered once all the attributes have been set (which usually happens
    * after the XML file (uidesc) has been read/processed, or when you modify attributes in the %VSTGUI Editor).
@@ -196,6 +291,19 @@ public:
 protected:
   using CView::sizeToFit; // fixes overload hiding warning
 
+  /**
+   * Draws the content of the view which does not change often (ex: a background, a grid...), relative to the view
+   * (`0,0` is the top left corner of the view). It is rendered once into an offscreen bitmap by
+   * `drawCachedStaticLayer()`, which then simply draws this bitmap. The default implementation draws the back color. */
+  virtual void drawStaticLayer(CDrawContext *iContext);
+
+  /**
+   * Draws the static layer (see `drawStaticLayer()`) from its cached offscreen bitmap, rendering it first if
+   * necessary (the bitmap is rendered again when the view size, the scale factor or the zoom changes, and the layer is
+   * drawn directly when the context is rotated or skewed). Call this method from `draw()` (instead of
+   * `drawBackColor()`) to use the cache. */
+  void drawCachedStaticLayer(CDrawContext *iContext);
+
   /**
    * Convenient call to size to fit this view according to the and height provided
    */
@@ -228,6 +336,14 @@ protected:
 #endif
   CColor fBackColor;
 
+private:
+  std::map<ParamID, CRect> fParamDirtyRects{};
+  CRect fUpdateRect{}; // relative to the view
+  bool fDrawing{false};
+  BitmapSPtr fStaticLayer{};
+  double fStaticLayerScaleFactor{1.0};
+  std::unique_ptr<DrawStats> fDrawStats{};
+
 public:
   /**
    * Defines and registers the attributes exposed in the %VSTGUI Editor and XML file (`.uidesc`) for `CustomView`.
@@ -345,6 +461,33 @@ public:
   //! @copydoc pongasoft::VST::GUI::Views::CustomView::markDirty()
   inline void markDirty() { TView::setDirty(true); }
 
+  //! @copydoc pongasoft::VST::GUI::Views::CustomView::markDirty(CRect const &)
+  void markDirty(CRect const &iRect)
+  {
+    auto const &viewSize = TView::getViewSize();
+    CRect rect{iRect};
+    rect.offset(viewSize.left, viewSize.top);
+    rect.bound(viewSize);
+    if(!rect.isEmpty())
+      TView::invalidRect(rect);
+  }
+
+  //! @copydoc pongasoft::VST::GUI::Views::CustomView::setParamDirtyRect()
+  void setParamDirtyRect(ParamID iParamID, CRect const &iRect) { fParamDirtyRects[iParamID] = iRect; }
+
+  //! @copydoc pongasoft::VST::GUI::Views::CustomView::clearParamDirtyRects()
+  void clearParamDirtyRects() { fParamDirtyRects.clear(); }
+
+  //! @copydoc pongasoft::VST::GUI::Views::CustomView::getParamDirtyRect()
+  virtual bool getParamDirtyRect(ParamID iParamID, CRect &oRect) const
+  {
+    auto iter = fParamDirtyRects.find(iParamID);
+    if(iter == fParamDirtyRects.end())
+      return false;
+    oRect = iter->second;
+    return true;
+  }
+
    //! @see getCustomViewTag()
   void setCustomViewTag (TagID iTag) { fTag = iTag; }
 
@@ -381,7 +524,14 @@ public:
 #endif
 
   //! @copydoc pongasoft::VST::GUI::Views::CustomView::onParameterChange()
-  void onParameterChange(ParamID iParamID) override { markDirty(); };
+  void onParameterChange(ParamID iParamID) override
+  {
+    CRect rect{};
+    if(getParamDirtyRect(iParamID, rect))
+      markDirty(rect);
+    else
+      markDirty();
+  };
 
   //! @copydoc pongasoft::VST::GUI::Views::CustomView::afterApplyAttributes()
   void afterApplyAttributes() override
@@ -397,6 +547,9 @@ protected:
   bool fEditorMode{false};
 #endif
 
+private:
+  std::map<ParamID, CRect> fParamDirtyRects{};
+
 public:
   using creator_super_type = TCustomViewCreator<CustomViewAdapter>;
 
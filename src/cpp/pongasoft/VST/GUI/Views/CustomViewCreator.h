@@ -18,6 +18,7 @@
 #pragma once
 
 #include <vstgui4/vstgui/uidescription/iviewcreator.h>
+#include <vstgui4/vstgui/uidescription/iuidescription.h>
 #include <vstgui4/vstgui/uidescription/uiviewcreator.h>
 #include <vstgui4/vstgui/uidescription/uiviewfactory.h>
 #include <vstgui4/vstgui/uidescription/uiattributes.h>
@@ -45,6 +46,141 @@ using namespace VSTGUI;
 // As a result, it is conditionally compiled so that it doesn't use unnecessary space in Release mode.
 //------------------------------------------------------------------------
 
+/**
+ * Converting an attribute value (a string coming from the xml file) into its actual value (for example a tag name
+ * into a tag, a bitmap name into a bitmap...) happens every time a view is created. Since the same values appear
+ * over and over (across views and every time the editor is opened), the converted values are cached.
+ *
+ * The cache is owned by the view factory of a controller (`CustomUIViewFactory`) and only ever contains values
+ * converted with the (one) description using this factory. Because the converted values may point to objects owned
+ * by the description (like bitmaps or fonts), the cache is cleared when the description is released
+ * (`GUIController::releaseUIDescription`), when a different description is used, and when the factory (and thus
+ * the controller) goes away.
+ *
+ * \note The cache is disabled in editor mode, since a value (like a named color) can then be edited in place.
+ */
+class AttributeConversionCache
+{
+public:
+  struct Stats
+  {
+    uint64_t fHits{};
+    uint64_t fMisses{};
+  };
+
+  /**
+   * Implemented by the view factory owning the cache (see `from`) */
+  class Provider
+  {
+  public:
+    virtual ~Provider() = default;
+    virtual AttributeConversionCache &getAttributeConversionCache() = 0;
+  };
+
+  /**
+   * @return the cache associated to the view factory of the description or `nullptr` if there is none (for example
+   *         when the factory is not a `CustomUIViewFactory`) */
+  static AttributeConversionCache *from(IUIDescription const *iDescription)
+  {
+    if(iDescription == nullptr)
+      return nullptr;
+    auto provider = dynamic_cast<Provider *>(iDescription->getViewFactory());
+    return provider ? &provider->getAttributeConversionCache() : nullptr;
+  }
+
+  /**
+   * Discards all the cached values */
+  void invalidate()
+  {
+    fValues.clear();
+    fDescription = nullptr;
+  }
+
+  // setEnabled
+  void setEnabled(bool iEnabled) { fEnabled = iEnabled; invalidate(); }
+
+  // isEnabled
+#ifdef EDITOR_MODE
+  bool isEnabled() const { return false; }
+#else
+  bool isEnabled() const { return fEnabled; }
+#endif
+
+  // getStats
+  Stats const &getStats() const { return fStats; }
+
+  // resetStats
+  void resetStats() { fStats = {}; }
+
+  /**
+   * Converts the string (using `iConverter`) or returns the value previously converted for this attribute (`iKey`)
+   *
+   * @return `false` if the value could not be converted (in which case nothing is cached) */
+  template<typename T, typename Converter>
+  bool convert(void const *iKey,
+               IUIDescription const *iDescription,
+               std::string const &iAttributeValue,
+               T &oValue,
+               Converter &&iConverter)
+  {
+    if(!isEnabled())
+      return iConverter(iDescription, iAttributeValue, oValue);
+
+    // values converted with another description cannot be used
+    if(fDescription != iDescription)
+    {
+      invalidate();
+      fDescription = iDescription;
+    }
+
+    auto &values = getValues<T>(iKey);
+    auto iter = values.find(iAttributeValue);
+    if(iter != values.end())
+    {
+      fStats.fHits++;
+      oValue = iter->second;
+      return true;
+    }
+
+    fStats.fMisses++;
+    if(iConverter(iDescription, iAttributeValue, oValue))
+    {
+      values.emplace(iAttributeValue, oValue);
+      return true;
+    }
+
+    return false;
+  }
+
+private:
+  struct IValues
+  {
+    virtual ~IValues() = default;
+  };
+
+  template<typename T>
+  struct TValues : public IValues
+  {
+    std::map<std::string, T> fMap{};
+  };
+
+  // getValues (the key identifies an attribute which always converts to the same T)
+  template<typename T>
+  std::map<std::string, T> &getValues(void const *iKey)
+  {
+    auto &values = fValues[iKey];
+    if(!values)
+      values = std::make_unique<TValues<T>>();
+    return static_cast<TValues<T> *>(values.get())->fMap;
+  }
+
+private:
+  bool fEnabled{true};
+  IUIDescription const *fDescription{};
+  std::map<void const *, std::unique_ptr<IValues>> fValues{};
+  Stats fStats{};
+};
+
 /**
  * Base abstract class for an attribute of a view
  */
@@ -202,7 +338,7 @@ private:
         if(attributeValue)
         {
           T value;
-          if(fromString(iDescription, *attributeValue, value))
+          if(convert(iDescription, *attributeValue, value))
           {
             std::invoke(fSetter, tv, value);
             return true;
@@ -212,6 +348,21 @@ private:
       return false;
     }
 
+    /**
+     * Converts the string (using `fromString`) or returns the value previously converted if it is cached (see
+     * `AttributeConversionCache`). */
+    bool convert(IUIDescription const *iDescription, std::string const &iAttributeValue, T &oValue) const
+    {
+      auto cache = AttributeConversionCache::from(iDescription);
+      if(cache == nullptr)
+        return fromString(iDescription, iAttributeValue, oValue);
+
+      return cache->convert(this, iDescription, iAttributeValue, oValue,
+                            [this](IUIDescription const *iDesc, std::string const &iValue, T &oConvertedValue) {
+                              return fromString(iDesc, iValue, oConvertedValue);
+                            });
+    }
+
 #ifdef EDITOR_MODE
     /**
      * Subclasses need to implement this method to convert a T to a string. Returns true if the
@@ -19,21 +19,26 @@
 
 #include <vstgui4/vstgui/uidescription/uiviewfactory.h>
 #include <pongasoft/VST/GUI/GUIState.h>
+#include <pongasoft/VST/GUI/Views/CustomViewCreator.h>
 
 namespace pongasoft::VST::GUI::Views {
 
 using namespace Params;
 
 /**
- * Custom view factory to give access to vst parameters
+ * Custom view factory to give access to vst parameters. It also owns the cache of converted attribute values (see
+ * `AttributeConversionCache`) so that the cache shares the lifetime of the controller.
  */
-class CustomUIViewFactory : public VSTGUI::UIViewFactory
+class CustomUIViewFactory : public VSTGUI::UIViewFactory, public AttributeConversionCache::Provider
 {
 public:
   explicit CustomUIViewFactory(GUIState *iGUIState) : fGUIState{iGUIState}
   {
   }
 
+  // getAttributeConversionCache
+  AttributeConversionCache &getAttributeConversionCache() override { return fAttributeConversionCache; }
+
 protected:
   // overridden to detect ParamAware instances
   bool applyAttributeValues(CView *view, const UIAttributes &attributes, const IUIDescription *desc) const override;
@@ -49,6 +54,7 @@ protected:
 
 private:
   GUIState *fGUIState{};
+  AttributeConversionCache fAttributeConversionCache{};
 };
 
 
@@ -17,6 +17,7 @@
  */
 
 #include "DiscreteButtonView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 
 #include <vstgui4/vstgui/lib/cdrawcontext.h>
 
@@ -49,7 +50,6 @@ void DiscreteButtonView::draw(CDrawContext *iContext)
   if(fImage)
   {
     int frameIndex;
-    CCoord frameHeight = fImage->getHeight() / getFrames();
     if(getFrames() == 4)
     {
       frameIndex = on ? 2 : 0;
@@ -61,7 +61,7 @@ void DiscreteButtonView::draw(CDrawContext *iContext)
       frameIndex = on ? 1 : 0;
     }
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, getFrames(), frameIndex, getViewSize());
   }
   else
   {
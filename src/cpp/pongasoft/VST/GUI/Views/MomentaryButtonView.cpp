@@ -16,6 +16,7 @@
  * @author Yan Pujante
  */
 #include "MomentaryButtonView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 
 #include <vstgui4/vstgui/lib/cdrawcontext.h>
 
@@ -49,21 +50,21 @@ void MomentaryButtonView::drawOn(CDrawContext *iContext)
 {
   if(fImage)
   {
-    CCoord frameHeight;
+    int32 frameCount;
     int frameIndex;
 
     if(fImageHasDisabledState)
     {
-      frameHeight = fImage->getHeight() / 3;
+      frameCount = 3;
       frameIndex = getMouseEnabled() ? 2 : 0;
     }
     else
     {
-      frameHeight = fImage->getHeight() / 2;
+      frameCount = 2;
       frameIndex = 1;
     }
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, frameCount, frameIndex, getViewSize());
   }
   else
   {
@@ -81,21 +82,21 @@ void MomentaryButtonView::drawOff(CDrawContext *iContext)
 {
   if(fImage)
   {
-    CCoord frameHeight;
+    int32 frameCount;
     int frameIndex;
 
     if(fImageHasDisabledState)
     {
-      frameHeight = fImage->getHeight() / 3;
+      frameCount = 3;
       frameIndex = getMouseEnabled() ? 1 : 0;
     }
     else
     {
-      frameHeight = fImage->getHeight() / 2;
+      frameCount = 2;
       frameIndex = 0;
     }
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, frameCount, frameIndex, getViewSize());
   }
   else
   {
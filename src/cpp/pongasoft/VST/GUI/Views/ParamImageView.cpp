@@ -17,6 +17,7 @@
  */
 
 #include "ParamImageView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 
 namespace pongasoft::VST::GUI::Views {
 
@@ -30,12 +31,11 @@ void ParamImageView::draw(CDrawContext *iContext)
   if(fImage)
   {
     auto frames = getFrames();
-    CCoord frameHeight = fImage->getHeight() / frames;
     auto frameIndex = getControlValue();
     if(fInverse)
       frameIndex = frames - frameIndex - 1;
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, frames, frameIndex, getViewSize());
   }
 }
 
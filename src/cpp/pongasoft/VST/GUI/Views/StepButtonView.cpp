@@ -16,6 +16,7 @@
  * @author Yan Pujante
  */
 #include "StepButtonView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 #include <pongasoft/Utils/Constants.h>
 
 
@@ -45,8 +46,7 @@ void StepButtonView::drawHeldButton(CDrawContext *iContext)
 {
   if(fImage)
   {
-    CCoord y = fImage->getHeight() / 2;
-    fImage->draw(iContext, getViewSize(), CPoint{0, y});
+    FilmStripCache::instance().drawFrame(iContext, fImage, 2, 1, getViewSize());
   }
   else
   {
@@ -62,8 +62,7 @@ void StepButtonView::drawReleasedButton(CDrawContext *iContext)
 {
   if(fImage)
   {
-    CCoord y = 0;
-    fImage->draw(iContext, getViewSize(), CPoint{0, y});
+    FilmStripCache::instance().drawFrame(iContext, fImage, 2, 0, getViewSize());
   }
   else
   {
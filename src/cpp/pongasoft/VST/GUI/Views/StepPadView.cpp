@@ -16,6 +16,7 @@
  * @author Yan Pujante
  */
 #include "StepPadView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 #include <pongasoft/Utils/Constants.h>
 
 
@@ -49,21 +50,21 @@ void StepPadView::drawHeldPad(CDrawContext *iContext)
 {
   if(fImage)
   {
-    CCoord frameHeight;
+    int32 frameCount;
     int frameIndex;
 
     if(fImageHasDisabledState)
     {
-      frameHeight = fImage->getHeight() / 3;
+      frameCount = 3;
       frameIndex = getMouseEnabled() ? 2 : 0;
     }
     else
     {
-      frameHeight = fImage->getHeight() / 2;
+      frameCount = 2;
       frameIndex = 1;
     }
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, frameCount, frameIndex, getViewSize());
   }
   else
   {
@@ -81,21 +82,21 @@ void StepPadView::drawReleasedPad(CDrawContext *iContext)
 {
   if(fImage)
   {
-    CCoord frameHeight;
+    int32 frameCount;
     int frameIndex;
 
     if(fImageHasDisabledState)
     {
-      frameHeight = fImage->getHeight() / 3;
+      frameCount = 3;
       frameIndex = getMouseEnabled() ? 1 : 0;
     }
     else
     {
-      frameHeight = fImage->getHeight() / 2;
+      frameCount = 2;
       frameIndex = 0;
     }
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, frameCount, frameIndex, getViewSize());
   }
   else
   {
@@ -18,6 +18,8 @@
 
 #include "SwitchViewContainer.h"
 
+#include <algorithm>
+
 namespace pongasoft::VST::GUI::Views {
 
 //------------------------------------------------------------------------
@@ -34,6 +36,7 @@ SwitchViewContainer::SwitchViewContainer(const CRect &iSize) : CustomViewAdapter
 SwitchViewContainer::~SwitchViewContainer()
 {
   unregisterViewContainerListener(this);
+  clearTemplateCache();
   setCurrentView(nullptr);
 }
 
@@ -69,18 +72,125 @@ void SwitchViewContainer::registerParameters()
 void SwitchViewContainer::switchCurrentView()
 {
   auto index = fControlSwitch.getValue();
-  auto templateName = UTF8String(computeTemplateName(index));
+  switchToTemplate(computeTemplateName(index));
+}
 
-  if(templateName != fCurrentTemplateName)
+//------------------------------------------------------------------------
+// SwitchViewContainer::switchToTemplate
+//------------------------------------------------------------------------
+void SwitchViewContainer::switchToTemplate(std::string const &iTemplateName)
+{
+  if(iTemplateName != fCurrentTemplateName)
   {
-    setCurrentView(templateName == "" || templateName == "_" ?
-                   nullptr :
-                   fUIDescription->createView(templateName, fUIController));
-    fCurrentTemplateName = templateName;
+    CView *view = nullptr;
+
+    if(!(iTemplateName.empty() || iTemplateName == "_"))
+    {
+      view = fetchCachedTemplate(iTemplateName);
+      if(!view)
+        view = createTemplateView(iTemplateName);
+    }
+
+    cacheCurrentView();
+    setCurrentView(view);
+    fCurrentTemplateName = iTemplateName;
     invalid();
   }
 }
 
+//------------------------------------------------------------------------
+// SwitchViewContainer::createTemplateView
+//------------------------------------------------------------------------
+CView *SwitchViewContainer::createTemplateView(std::string const &iTemplateName)
+{
+  return fUIDescription ? fUIDescription->createView(UTF8String(iTemplateName), fUIController) : nullptr;
+}
+
+//------------------------------------------------------------------------
+// SwitchViewContainer::fetchCachedTemplate
+//------------------------------------------------------------------------
+CView *SwitchViewContainer::fetchCachedTemplate(std::string const &iTemplateName)
+{
+  auto iter = std::find_if(fTemplateCache.begin(), fTemplateCache.end(),
+                           [&iTemplateName](auto const &t) { return t.fTemplateName == iTemplateName; });
+
+  if(iter == fTemplateCache.end())
+    return nullptr;
+
+  auto view = iter->fView;
+  fTemplateCache.erase(iter);
+
+  // catch up on whatever changed while hidden
+  suspendParameters(view, false);
+
+  return view;
+}
+
+//------------------------------------------------------------------------
+// SwitchViewContainer::cacheCurrentView
+//------------------------------------------------------------------------
+void SwitchViewContainer::cacheCurrentView()
+{
+  if(fTemplateCacheSize == 0 || !fCurrentView)
+    return;
+
+  // Implementation note: the view remains a (hidden) child of this container instead of being removed because
+  // removing a view from the frame disconnects its (vst) controls from the editor (VST3Editor) for good
+  suspendParameters(fCurrentView, true);
+  fCurrentView->setVisible(false);
+  fTemplateCache.emplace_back(CachedTemplate{fCurrentTemplateName, fCurrentView});
+  fCurrentView = nullptr;
+
+  trimTemplateCache();
+}
+
+//------------------------------------------------------------------------
+// SwitchViewContainer::trimTemplateCache
+//------------------------------------------------------------------------
+void SwitchViewContainer::trimTemplateCache()
+{
+  if(fTemplateCacheSize < 0)
+    return;
+
+  while(fTemplateCache.size() > static_cast<size_t>(fTemplateCacheSize))
+  {
+    removeView(fTemplateCache.front().fView);
+    fTemplateCache.erase(fTemplateCache.begin());
+  }
+}
+
+//------------------------------------------------------------------------
+// SwitchViewContainer::clearTemplateCache
+//------------------------------------------------------------------------
+void SwitchViewContainer::clearTemplateCache()
+{
+  for(auto &t: fTemplateCache)
+    removeView(t.fView);
+  fTemplateCache.clear();
+}
+
+//------------------------------------------------------------------------
+// SwitchViewContainer::suspendParameters
+//------------------------------------------------------------------------
+void SwitchViewContainer::suspendParameters(CView *iView, bool iSuspend)
+{
+  std::vector<ParamAware *> views{};
+
+  if(auto paramAware = dynamic_cast<ParamAware *>(iView))
+    views.emplace_back(paramAware);
+
+  if(auto container = iView->asViewContainer())
+    container->getChildViewsOfType<ParamAware>(views, true);
+
+  for(auto view: views)
+  {
+    if(iSuspend)
+      view->suspendAll();
+    else
+      view->resumeAll();
+  }
+}
+
 //------------------------------------------------------------------------
 // SwitchViewContainer::switchCurrentView
 //------------------------------------------------------------------------
@@ -103,7 +213,13 @@ void SwitchViewContainer::setCurrentView(CView *iCurrentView)
     fCurrentView = iCurrentView;
 
     if(fCurrentView)
-      addView(fCurrentView);
+    {
+      // a view coming from the cache is already a child
+      if(isChild(fCurrentView))
+        fCurrentView->setVisible(true);
+      else
+        addView(fCurrentView);
+    }
   }
 
   // when there is no current view, we make this view invisible to make sure that whatever is below
@@ -116,7 +232,10 @@ void SwitchViewContainer::setCurrentView(CView *iCurrentView)
 //------------------------------------------------------------------------
 void SwitchViewContainer::viewContainerViewAdded(CViewContainer * /* unused */, CView *iView)
 {
-  if(iView != fCurrentView)
+  auto cached = std::find_if(fTemplateCache.cbegin(), fTemplateCache.cend(),
+                             [iView](auto const &t) { return t.fView == iView; });
+
+  if(iView != fCurrentView && cached == fTemplateCache.cend())
   {
     DLOG_F(WARNING, "SwitchViewContainer has children...");
     removeView(iView);
@@ -42,6 +42,7 @@ namespace pongasoft::VST::GUI::Views {
  * ---------            | -----------
  * `switch-control-tag` | @copydoc getSwitchControlTag()
  * `template-names`     | @copydoc getTemplateNames()
+ * `template-cache-size`| @copydoc getTemplateCacheSize()
  */
 class SwitchViewContainer : public CustomViewAdapter<CViewContainer>, ViewContainerListenerAdapter
 {
@@ -64,7 +65,24 @@ public:
    * @note You can use `_` for a template name which means displays nothing (make sure you set the container to
    *       transparent in this case). Can be used for overlay for example. */
   const std::vector<std::string> &getTemplateNames() const { return fTemplateNames; }
-  void setTemplateNames(const std::vector<std::string> &iNames) { fTemplateNames = iNames; switchCurrentView(); }
+  void setTemplateNames(const std::vector<std::string> &iNames) { clearTemplateCache(); fTemplateNames = iNames; switchCurrentView(); }
+
+  /**
+   * Number of (previously displayed) templates kept in a cache so that switching back to them is instant (no view
+   * creation, no attribute parsing, no parameter registration). The least recently displayed template is discarded
+   * when the cache is full. `0` (default) disables the cache (the view is recreated on every switch) and `-1` keeps
+   * all of them.
+   *
+   * While in the cache, the views are hidden and their (Jamba) parameter connections are suspended. They catch up
+   * on any parameter change when displayed again. */
+  int32 getTemplateCacheSize() const { return fTemplateCacheSize; }
+
+  //! Attribute `template-cache-size`
+  void setTemplateCacheSize(int32 iSize) { fTemplateCacheSize = iSize; trimTemplateCache(); }
+
+  /**
+   * Discards all the cached templates */
+  void clearTemplateCache();
 
   // registerParameters
   void registerParameters() override;
@@ -98,6 +116,29 @@ protected:
    */
   virtual std::string computeTemplateName(int iIndex);
 
+  /**
+   * Switches to the template (from the cache if present, otherwise by creating it) */
+  void switchToTemplate(std::string const &iTemplateName);
+
+  /**
+   * Creates the view for the template (called when not in the cache). Can be overridden to implement different
+   * behavior. */
+  virtual CView *createTemplateView(std::string const &iTemplateName);
+
+  /**
+   * Removes the template from the cache (if present) and returns its view (suspended connections are resumed) */
+  CView *fetchCachedTemplate(std::string const &iTemplateName);
+
+  /**
+   * Hides the current view and adds it to the cache (or discards it when the cache is disabled) */
+  void cacheCurrentView();
+
+  // discards the least recently used templates until the cache fits its size
+  void trimTemplateCache();
+
+  // suspend/resume the parameter connections of all the ParamAware views of the tree
+  static void suspendParameters(CView *iView, bool iSuspend);
+
 protected:
   IUIDescription const *fUIDescription{};
   IController *fUIController{};
@@ -110,6 +151,17 @@ protected:
   CView *fCurrentView{};
   std::string fCurrentTemplateName{};
 
+  struct CachedTemplate
+  {
+    std::string fTemplateName;
+    CView *fView;
+  };
+
+  int32 fTemplateCacheSize{0};
+
+  // cached (hidden) views, still children of this container, least recently used first
+  std::vector<CachedTemplate> fTemplateCache{};
+
 public:
   class Creator : public CustomViewCreator<SwitchViewContainer, CustomViewAdapter<CViewContainer>>
   {
@@ -119,6 +171,7 @@ public:
     {
       registerTagAttribute("switch-control-tag", &SwitchViewContainer::getSwitchControlTag, &SwitchViewContainer::setSwitchControlTag);
       registerVectorStringAttribute("template-names", &SwitchViewContainer::getTemplateNames, &SwitchViewContainer::setTemplateNames);
+      registerIntegerAttribute<int32>("template-cache-size", &SwitchViewContainer::getTemplateCacheSize, &SwitchViewContainer::setTemplateCacheSize);
     }
   };
 };
@@ -18,6 +18,7 @@
 
 #include <vstgui4/vstgui/lib/cdrawcontext.h>
 #include "TextButtonView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 
 namespace pongasoft::VST::GUI::Views {
 
@@ -122,23 +123,23 @@ void TextButtonView::drawButtonText(CDrawContext *context)
 //------------------------------------------------------------------------
 void TextButtonView::drawButtonImage(CDrawContext *iContext)
 {
-  CCoord frameHeight;
+  int32 frameCount;
   int frameIndex;
 
   bool onState = BooleanParamConverter::toBoolean(value);
 
   if(fImageHasDisabledState)
   {
-    frameHeight = fImage->getHeight() / 3;
+    frameCount = 3;
     frameIndex = getMouseEnabled() ? (onState ? 2 : 1) : 0;
   }
   else
   {
-    frameHeight = fImage->getHeight() / 2;
+    frameCount = 2;
     frameIndex = onState ? 1 : 0;
   }
 
-  fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+  FilmStripCache::instance().drawFrame(iContext, fImage, frameCount, frameIndex, getViewSize());
 }
 
 //------------------------------------------------------------------------
@@ -16,6 +16,7 @@
  * @author Yan Pujante
  */
 #include "ToggleButtonView.h"
+#include <pongasoft/VST/GUI/FilmStripCache.h>
 
 #include <vstgui4/vstgui/lib/cdrawcontext.h>
 
@@ -48,7 +49,6 @@ void ToggleButtonView::draw(CDrawContext *iContext)
   if(fImage)
   {
     int frameIndex;
-    CCoord frameHeight = fImage->getHeight() / getFrames();
     if(getFrames() == 4)
     {
       frameIndex = on ? 2 : 0;
@@ -60,7 +60,7 @@ void ToggleButtonView::draw(CDrawContext *iContext)
       frameIndex = on ? 1 : 0;
     }
 
-    fImage->draw(iContext, getViewSize(), CPoint{0, frameIndex * frameHeight});
+    FilmStripCache::instance().drawFrame(iContext, fImage, getFrames(), frameIndex, getViewSize());
   }
   else
   {
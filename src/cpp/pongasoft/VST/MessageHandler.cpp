@@ -20,6 +20,8 @@
 
 #include "MessageHandler.h"
 
+#include <algorithm>
+
 namespace pongasoft {
 namespace VST {
 
@@ -28,12 +30,12 @@ namespace VST {
 //------------------------------------------------------------------------
 tresult MessageHandler::handleMessage(Message const &iMessage)
 {
-  auto iter = fHandlers.find(iMessage.getMessageID());
+  auto handler = findHandler(iMessage.getMessageID());
 
-  if(iter == fHandlers.cend())
+  if(!handler)
     return kResultFalse;
 
-  return iter->second->handleMessage(iMessage);
+  return handler->handleMessage(iMessage);
 }
 
 //------------------------------------------------------------------------
@@ -43,14 +45,53 @@ void MessageHandler::registerHandler(MessageID iMessageID, IMessageHandler *iMes
 {
   DCHECK_F(iMessageHandler != nullptr);
 
-  auto iter = fHandlers.find(iMessageID);
+  auto iter = std::lower_bound(fHandlers.begin(), fHandlers.end(), iMessageID,
+                               [](auto const &a, MessageID id) { return a.first < id; });
 
-  if(iter != fHandlers.cend())
+  if(iter != fHandlers.end() && iter->first == iMessageID)
   {
     DLOG_F(WARNING, "registering message handler for [%d] multiple time", iMessageID);
+    iter->second = iMessageHandler;
   }
+  else
+    fHandlers.insert(iter, {iMessageID, iMessageHandler});
+
+  buildDenseHandlers();
+}
+
+//------------------------------------------------------------------------
+// MessageHandler::findSparseHandler
+//------------------------------------------------------------------------
+IMessageHandler *MessageHandler::findSparseHandler(MessageID iMessageID) const
+{
+  auto iter = std::lower_bound(fHandlers.cbegin(), fHandlers.cend(), iMessageID,
+                               [](auto const &a, MessageID id) { return a.first < id; });
+  return (iter != fHandlers.cend() && iter->first == iMessageID) ? iter->second : nullptr;
+}
+
+//------------------------------------------------------------------------
+// MessageHandler::buildDenseHandlers
+//------------------------------------------------------------------------
+void MessageHandler::buildDenseHandlers()
+{
+  fDenseHandlers.clear();
+  fMinMessageID = 0;
+
+  if(fHandlers.empty())
+    return;
+
+  // fHandlers is sorted => min is first, max is last
+  auto const range = static_cast<int64>(fHandlers.back().first) - static_cast<int64>(fHandlers.front().first) + 1;
+
+  // same heuristic as NormalizedState::SaveOrder: direct addressing unless the ids are very sparse
+  if(range > std::max<int64>(4096, 4 * static_cast<int64>(fHandlers.size())))
+    return;
+
+  fMinMessageID = fHandlers.front().first;
+  fDenseHandlers.assign(static_cast<size_t>(range), nullptr);
+  for(auto const &h: fHandlers)
+    fDenseHandlers[h.first - fMinMessageID] = h.second;
+}
 
-  fHandlers[iMessageID] = iMessageHandler;
 }
 }
-}
\ No newline at end of file
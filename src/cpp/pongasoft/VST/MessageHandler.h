@@ -20,7 +20,8 @@
 
 #include "Messaging.h"
 
-#include <map>
+#include <utility>
+#include <vector>
 
 namespace pongasoft {
 namespace VST {
@@ -35,7 +36,12 @@ public:
 };
 
 /**
- * Simple implementation of IMessageHandler which will delegate the message handling based on MessageID */
+ * Simple implementation of IMessageHandler which will delegate the message handling based on MessageID: the message
+ * is dispatched to the handler registered for its id. Message ids are (jmb) param ids which are usually
+ * defined as an enum, so the handlers are stored in a table directly indexed by the id (constant time dispatch, no
+ * hashing). When the ids are too sparse for direct addressing, it falls back to a binary search in a sorted vector.
+ *
+ * Registration (which rebuilds the tables) is meant to happen once, during initialization. */
 class MessageHandler : public IMessageHandler
 {
 public:
@@ -45,9 +51,38 @@ public:
   // registerHandler
   void registerHandler(MessageID iMessageID, IMessageHandler *iMessageHandler);
 
+  /**
+   * @return the handler registered for the message id or `nullptr` if there is none */
+  inline IMessageHandler *findHandler(MessageID iMessageID) const
+  {
+    if(!fDenseHandlers.empty())
+    {
+      if(iMessageID < fMinMessageID)
+        return nullptr;
+      auto const offset = static_cast<size_t>(iMessageID - fMinMessageID);
+      return offset < fDenseHandlers.size() ? fDenseHandlers[offset] : nullptr;
+    }
+
+    return findSparseHandler(iMessageID);
+  }
+
+  // getHandlerCount
+  inline int getHandlerCount() const { return static_cast<int>(fHandlers.size()); }
+
 private:
-  // map of messageID to a handler
-  std::map<MessageID, IMessageHandler *> fHandlers{};
+  // binary search in fHandlers
+  IMessageHandler *findSparseHandler(MessageID iMessageID) const;
+
+  // rebuilds fDenseHandlers from fHandlers
+  void buildDenseHandlers();
+
+private:
+  // messageID -> handler (sorted by messageID)
+  std::vector<std::pair<MessageID, IMessageHandler *>> fHandlers{};
+
+  // direct addressing: fDenseHandlers[messageID - fMinMessageID] = handler or nullptr (empty when ids are too sparse)
+  MessageID fMinMessageID{0};
+  std::vector<IMessageHandler *> fDenseHandlers{};
 };
 
 }
@@ -38,6 +38,9 @@ static const auto ATTR_MSG_ID = "ATTR_MSG_ID";
 
 using MessageID = int;
 
+// message sent by `RTProcessor` to the controller when the latency changes (ids reserved by Jamba are negative)
+constexpr MessageID kLatencyChangedMessageID = -100;
+
 /**
  * Simple wrapper class with better api
  */
@@ -46,14 +49,24 @@ class Message
 public:
   explicit Message(IMessage *message) : fMessage(message) {}
 
+  /**
+   * @return the message id (`-1` if not set). The (string keyed) attribute is read from the host only once per
+   *         message: the value is then cached since every handler in the dispatch chain needs it */
   inline MessageID getMessageID() const
   {
-    return static_cast<MessageID>(getInt(ATTR_MSG_ID, -1));
+    if(!fMessageIDCached)
+    {
+      fMessageID = static_cast<MessageID>(getInt(ATTR_MSG_ID, -1));
+      fMessageIDCached = true;
+    }
+    return fMessageID;
   }
 
   inline void setMessageID(MessageID messageID)
   {
     fMessage->getAttributes()->setInt(ATTR_MSG_ID, messageID);
+    fMessageID = messageID;
+    fMessageIDCached = true;
   }
 
   inline int64 getInt(IAttributeList::AttrID id, int64 defaultValue) const
@@ -122,6 +135,10 @@ public:
 
 private:
   IMessage *fMessage;
+
+  // cache for getMessageID
+  mutable MessageID fMessageID{-1};
+  mutable bool fMessageIDCached{false};
 };
 
 //------------------------------------------------------------------------
@@ -18,10 +18,138 @@
 #include "NormalizedState.h"
 #include "Parameters.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace pongasoft::VST {
 
+namespace impl {
+
+// direct addressing is used as long as the table is not more than this factor bigger than the number of params...
+constexpr uint64 kDenseIndexMaxRatio = 4;
+
+// ... or this size (so that a handful of params with ids like 1000, 2000, 3000 still use direct addressing)
+constexpr uint64 kDenseIndexMinSize = 4096;
+
+inline bool useDenseIndex(uint64 iRange, int iCount)
+{
+  return iRange <= std::max(kDenseIndexMinSize, kDenseIndexMaxRatio * static_cast<uint64>(iCount));
+}
+
+}
+
+//------------------------------------------------------------------------
+// NormalizedState::SaveOrder::buildIndex
+//------------------------------------------------------------------------
+void NormalizedState::SaveOrder::buildIndex()
+{
+  fDenseIndex.clear();
+  fSparseIndex.clear();
+  fIndexMinParamID = 0;
+  fIndexedCount = 0;
+
+  if(fOrder.empty())
+    return;
+
+  auto const minmax = std::minmax_element(fOrder.cbegin(), fOrder.cend());
+  auto const range = static_cast<uint64>(*minmax.second) - static_cast<uint64>(*minmax.first) + 1;
+
+  if(impl::useDenseIndex(range, getCount()))
+  {
+    fIndexMinParamID = *minmax.first;
+    fDenseIndex.assign(static_cast<size_t>(range), -1);
+    for(int i = 0; i < getCount(); i++)
+    {
+      auto &idx = fDenseIndex[fOrder[i] - fIndexMinParamID];
+      // in case of duplicates, the first one wins (same as a linear search)
+      if(idx == -1)
+        idx = i;
+    }
+  }
+  else
+  {
+    fSparseIndex.reserve(fOrder.size());
+    for(int i = 0; i < getCount(); i++)
+      fSparseIndex.emplace_back(fOrder[i], i);
+
+    // stable sort + unique keeps the first one in case of duplicates (same as a linear search)
+    std::stable_sort(fSparseIndex.begin(), fSparseIndex.end(),
+                     [](auto const &a, auto const &b) { return a.first < b.first; });
+    fSparseIndex.erase(std::unique(fSparseIndex.begin(), fSparseIndex.end(),
+                                   [](auto const &a, auto const &b) { return a.first == b.first; }),
+                       fSparseIndex.end());
+  }
+
+  fIndexedCount = getCount();
+}
+
+//------------------------------------------------------------------------
+// NormalizedState::SaveOrder::addParamID
+//------------------------------------------------------------------------
+void NormalizedState::SaveOrder::addParamID(ParamID iParamID)
+{
+  bool const inSync = fIndexedCount == getCount();
+  auto const idx = getCount();
+
+  fOrder.emplace_back(iParamID);
+
+  if(inSync && idx > 0)
+  {
+    if(!fDenseIndex.empty())
+    {
+      if(iParamID >= fIndexMinParamID)
+      {
+        auto const offset = static_cast<uint64>(iParamID - fIndexMinParamID);
+        if(impl::useDenseIndex(offset + 1, getCount()))
+        {
+          if(offset >= fDenseIndex.size())
+            fDenseIndex.resize(static_cast<size_t>(offset + 1), -1);
+          if(fDenseIndex[offset] == -1)
+            fDenseIndex[offset] = idx;
+          fIndexedCount = getCount();
+          return;
+        }
+      }
+    }
+    else
+    {
+      auto iter = std::lower_bound(fSparseIndex.begin(), fSparseIndex.end(), iParamID,
+                                   [](auto const &a, ParamID id) { return a.first < id; });
+      if(iter == fSparseIndex.end() || iter->first != iParamID)
+        fSparseIndex.emplace(iter, iParamID, idx);
+      fIndexedCount = getCount();
+      return;
+    }
+  }
+
+  buildIndex();
+}
+
+//------------------------------------------------------------------------
+// NormalizedState::SaveOrder::findIndex
+//------------------------------------------------------------------------
+int NormalizedState::SaveOrder::findIndex(ParamID iParamID) const
+{
+  // index out of sync (fOrder modified directly) => linear search
+  if(fIndexedCount != getCount())
+  {
+    auto pos = std::find(std::begin(fOrder), std::end(fOrder), iParamID);
+    return pos == std::end(fOrder) ? -1 : static_cast<int>(std::distance(std::begin(fOrder), pos));
+  }
+
+  if(!fDenseIndex.empty())
+  {
+    if(iParamID < fIndexMinParamID)
+      return -1;
+    auto const offset = static_cast<size_t>(iParamID - fIndexMinParamID);
+    return offset < fDenseIndex.size() ? fDenseIndex[offset] : -1;
+  }
+
+  auto iter = std::lower_bound(fSparseIndex.cbegin(), fSparseIndex.cend(), iParamID,
+                               [](auto const &a, ParamID id) { return a.first < id; });
+  return (iter != fSparseIndex.cend() && iter->first == iParamID) ? iter->second : -1;
+}
+
 //------------------------------------------------------------------------
 // NormalizedState::NormalizedState
 //------------------------------------------------------------------------
@@ -81,6 +209,13 @@ NormalizedState &NormalizedState::operator=(const NormalizedState &other)
 //------------------------------------------------------------------------
 int NormalizedState::copyValuesTo(NormalizedState &oDestination) const
 {
+  // same order => no need to look anything up
+  if(oDestination.fSaveOrder == fSaveOrder)
+  {
+    std::copy(fValues, fValues + getCount(), oDestination.fValues);
+    return getCount();
+  }
+
   int count = 0;
   for(int i = 0; i < getCount(); i++)
   {
@@ -155,16 +290,6 @@ tresult NormalizedState::setNormalizedValue(ParamID iParamID, ParamValue iValue)
     return kResultFalse;
 }
 
-//------------------------------------------------------------------------
-// NormalizedState::findParamIndex
-//------------------------------------------------------------------------
-int NormalizedState::findParamIndex(ParamID iParamID) const
-{
-  auto pos = std::find(std::begin(fSaveOrder->fOrder), std::end(fSaveOrder->fOrder), iParamID);
-  auto distance = static_cast<int>(std::distance(std::begin(fSaveOrder->fOrder), pos));
-  return distance == getCount() ? -1 : distance;
-}
-
 //------------------------------------------------------------------------
 // NormalizedState::toString -- only for debug
 //------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 #include <pongasoft/logging/logging.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace pongasoft::VST {
@@ -45,6 +46,33 @@ public:
     int16 fVersion{0};
     std::vector<ParamID> fOrder{};
     inline int getCount() const { return static_cast<int>(fOrder.size()); }
+
+    /**
+     * Adds the param at the end of the order while keeping the lookup index in sync (amortized constant time
+     * when params are added in increasing id order, which is the norm) */
+    void addParamID(ParamID iParamID);
+
+    /**
+     * (Re)builds the `ParamID` -> index lookup table. Must be called whenever `fOrder` is modified directly (which
+     * `Parameters` takes care of). If the index is out of sync, `findIndex` falls back to a linear search. */
+    void buildIndex();
+
+    /**
+     * The index for the given param (constant time when the param ids are dense enough, which is the case when they
+     * are defined as an enum, logarithmic time otherwise)
+     *
+     * @return the index or `-1` if not found */
+    int findIndex(ParamID iParamID) const;
+
+    // lookup index (built by buildIndex) => direct addressing: fDenseIndex[paramID - fIndexMinParamID] = index or -1
+    ParamID fIndexMinParamID{0};
+    std::vector<int> fDenseIndex{};
+
+    // lookup index (built by buildIndex) => used when the ids are too sparse for direct addressing (sorted by ParamID)
+    std::vector<std::pair<ParamID, int>> fSparseIndex{};
+
+    // how many entries of fOrder are currently indexed (index is valid only when == getCount())
+    int fIndexedCount{0};
   };
 
   // Constructor
@@ -82,10 +110,10 @@ public:
   inline int16 getVersion() const { return fSaveOrder->fVersion; }
 
   /**
-   * The index for the given param
+   * The index for the given param (delegates to `SaveOrder::findIndex`)
    *
    * @return the index or `-1` if not found */
-  int findParamIndex(ParamID iParamID) const;
+  inline int findParamIndex(ParamID iParamID) const { return fSaveOrder->findIndex(iParamID); }
 
   //! Sets the param value
   inline void set(int iIdx, ParamValue iParamValue)
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "AudioBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace pongasoft {
+namespace VST {
+
+/**
+ * Oversampling (by a factor of 1, 2, 4 or 8) for `AudioBuffers` based processing: the input is upsampled, the kernel
+ * provided by the plugin runs at the higher rate (where the harmonics generated by a non linear process like
+ * saturation or clipping do not alias) and the result is downsampled back to the host rate.
+ *
+ * Each factor of 2 is a stage made of a half-band, linear phase, FIR filter (Kaiser windowed sinc) applied in its
+ * polyphase form: half the coefficients of a half-band filter are 0 and the center one is 0.5, so upsampling computes
+ * one FIR (with `(numTaps + 1) / 2` coefficients) per input sample (the other output sample is a delayed copy of the
+ * input) and downsampling computes one FIR per output sample. The FIR loops iterate over the samples in the inner loop
+ * (instead of the coefficients) so that the compiler vectorizes them (SIMD) without requiring `-ffast-math`.
+ *
+ * Usage:
+ *
+ * ```
+ * // processor
+ * Oversampler<Sample32> fOversampler{4};
+ *
+ * // setupProcessing (memory is allocated here, never during processing)
+ * fOversampler.setup(2, setup.maxSamplesPerBlock);
+ *
+ * // getLatencySamples (report the latency to the host)
+ * uint32 PLUGIN_API getLatencySamples() override { return fOversampler.getLatencySamples(); }
+ *
+ * // processKernel
+ * fOversampler.process(in, out, [](Sample32 iSample, int32 iChannel) { return std::tanh(3 * iSample); });
+ * ```
+ *
+ * @tparam SampleType `Sample32` or `Sample64` */
+template<typename SampleType>
+class Oversampler
+{
+public:
+  static constexpr int32 kMaxFactor = 8;
+  static constexpr int32 kDefaultNumTaps = 47;
+
+public:
+  /**
+   * @param iFactor 1 (no oversampling), 2, 4 or 8 (rounded up to the next power of 2, max 8)
+   * @param iNumTaps the number of taps of each half-band filter (more taps means a steeper filter but more latency and
+   *                 cpu). Rounded up to the next valid value (`4 * k - 1`, ex: 15, 31, 47, 63) */
+  explicit Oversampler(int32 iFactor = 2, int32 iNumTaps = kDefaultNumTaps)
+  {
+    fNumStages = 0;
+    while((1 << fNumStages) < std::clamp<int32>(iFactor, 1, kMaxFactor))
+      fNumStages++;
+
+    // N = 4K - 1 => center tap (2K - 1) is odd
+    fK = std::max<int32>((iNumTaps + 1 + 3) / 4, 2);
+    fM = 2 * fK;
+
+    computeCoefficients();
+  }
+
+  /**
+   * Allocates the buffers (should be called from `setupProcessing`, never from the processing thread) */
+  void setup(int32 iNumChannels, int32 iMaxSamplesPerBlock)
+  {
+    fNumChannels = std::max<int32>(iNumChannels, 0);
+    fMaxSamples = std::max<int32>(iMaxSamplesPerBlock, 0);
+
+    fStages.clear();
+    fStages.resize(static_cast<size_t>(fNumStages));
+
+    for(int32 s = 0; s < fNumStages; s++)
+    {
+      // number of (input) samples processed by this stage when upsampling
+      auto n = static_cast<size_t>(fMaxSamples) << s;
+      auto &stage = fStages[s];
+      stage.fChannels.resize(static_cast<size_t>(fNumChannels));
+      for(auto &c: stage.fChannels)
+      {
+        c.fUp.assign(fM - 1 + n, 0);
+        c.fDownEven.assign(fM - 1 + n, 0);
+        c.fDownOdd.assign(fK + n, 0);
+        c.fOutput.assign(2 * n, 0);
+      }
+      stage.fAccumulator.assign(n, 0);
+    }
+  }
+
+  /**
+   * Clears the state of the filters (ex: when the processing is reset) */
+  void reset()
+  {
+    for(auto &stage: fStages)
+    {
+      for(auto &c: stage.fChannels)
+      {
+        std::fill(c.fUp.begin(), c.fUp.end(), 0);
+        std::fill(c.fDownEven.begin(), c.fDownEven.end(), 0);
+        std::fill(c.fDownOdd.begin(), c.fDownOdd.end(), 0);
+      }
+    }
+  }
+
+  // getFactor
+  inline int32 getFactor() const { return 1 << fNumStages; }
+
+  // getNumTaps (of each half-band filter)
+  inline int32 getNumTaps() const { return 4 * fK - 1; }
+
+  /**
+   * @return the latency (in samples at the host rate) introduced by the filters (up + down), which may be fractional
+   *         for factors 4 and 8 */
+  inline double getLatency() const
+  {
+    // each stage s (running at rate 2^s) delays by 2 * center tap samples at this rate
+    double latency = 0;
+    for(int32 s = 1; s <= fNumStages; s++)
+      latency += 2.0 * (fM - 1) / (1 << s);
+    return latency;
+  }
+
+  /**
+   * @return the latency rounded to the closest sample (value to report to the host via
+   *         `IAudioProcessor::getLatencySamples`) */
+  inline uint32 getLatencySamples() const { return static_cast<uint32>(std::lround(getLatency())); }
+
+  /**
+   * Upsamples `iIn`, calls `iKernel(SampleType iSample, int32 iChannel) -> SampleType` for every sample at the higher
+   * rate and downsamples the result into `oOut` (`iIn` and `oOut` may share the same buffers).
+   *
+   * @return `false` if the block does not fit the buffers allocated by `setup` (in which case the kernel is called at
+   *         the host rate) */
+  template<typename Kernel>
+  bool process(AudioBuffers<SampleType> &iIn, AudioBuffers<SampleType> &oOut, Kernel &&iKernel)
+  {
+    return processBlock(iIn, oOut, [&iKernel](int32 iChannel, SampleType *ioSamples, int32 iNumSamples) {
+      for(int32 i = 0; i < iNumSamples; i++)
+        ioSamples[i] = iKernel(ioSamples[i], iChannel);
+    });
+  }
+
+  /**
+   * Same as `process` but the kernel processes (in place) a block of samples at the higher rate:
+   * `iKernel(int32 iChannel, SampleType *ioSamples, int32 iNumSamples)` */
+  template<typename Kernel>
+  bool processBlock(AudioBuffers<SampleType> &iIn, AudioBuffers<SampleType> &oOut, Kernel &&iKernel)
+  {
+    auto numSamples = std::min(iIn.getNumSamples(), oOut.getNumSamples());
+    auto numChannels = std::min(iIn.getNumChannels(), oOut.getNumChannels());
+
+    bool fits = numSamples <= fMaxSamples && numChannels <= fNumChannels;
+
+    for(int32 c = 0; c < numChannels; c++)
+    {
+      auto in = iIn.getAudioChannel(c).getBuffer();
+      auto out = oOut.getAudioChannel(c).getBuffer();
+      if(!in || !out)
+        continue;
+
+      if(fNumStages == 0 || !fits)
+      {
+        if(in != out)
+          std::copy(in, in + numSamples, out);
+        iKernel(c, out, numSamples);
+        continue;
+      }
+
+      // up
+      SampleType const *src = in;
+      int32 n = numSamples;
+      for(int32 s = 0; s < fNumStages; s++)
+      {
+        upsample(fStages[s], c, src, n);
+        src = fStages[s].fChannels[c].fOutput.data();
+        n *= 2;
+      }
+
+      // kernel at the higher rate
+      iKernel(c, fStages[fNumStages - 1].fChannels[c].fOutput.data(), n);
+
+      // down
+      for(int32 s = fNumStages - 1; s >= 0; s--)
+      {
+        auto dst = s == 0 ? out : fStages[s - 1].fChannels[c].fOutput.data();
+        downsample(fStages[s], c, fStages[s].fChannels[c].fOutput.data(), n, dst);
+        n /= 2;
+      }
+    }
+
+    oOut.clearSilentFlag();
+
+    return fits;
+  }
+
+private:
+  struct Channel
+  {
+    std::vector<SampleType> fUp{};       // [M - 1 samples of history | input]
+    std::vector<SampleType> fDownEven{}; // [M - 1 samples of history | even samples]
+    std::vector<SampleType> fDownOdd{};  // [K samples of history | odd samples]
+    std::vector<SampleType> fOutput{};   // output of the upsampling (2x the input)
+  };
+
+  struct Stage
+  {
+    std::vector<Channel> fChannels{};
+    std::vector<SampleType> fAccumulator{};
+  };
+
+  // computeCoefficients (Kaiser windowed sinc half-band filter: only the even taps are kept)
+  void computeCoefficients()
+  {
+    constexpr double kBeta = 8.0;
+    constexpr double kPi = 3.14159265358979323846;
+
+    auto bessel0 = [](double x) {
+      double sum = 1, term = 1;
+      for(int k = 1; k < 50; k++)
+      {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+      }
+      return sum;
+    };
+
+    auto numTaps = getNumTaps();
+    auto center = (numTaps - 1) / 2;
+
+    std::vector<double> even(static_cast<size_t>(fM));
+    double sum = 0;
+    for(int32 i = 0; i < fM; i++)
+    {
+      auto n = 2 * i;
+      double x = (n - center) / 2.0; // never 0 (center is odd)
+      double sinc = std::sin(kPi * x) / (kPi * x);
+      double r = static_cast<double>(n - center) / center;
+      double window = bessel0(kBeta * std::sqrt(std::max(0.0, 1.0 - r * r))) / bessel0(kBeta);
+      even[i] = 0.5 * sinc * window;
+      sum += even[i];
+    }
+
+    // normalize so that the DC gain is exactly 1 (sum of the even taps = 0.5)
+    fCoefficients.resize(static_cast<size_t>(fM));
+    for(int32 i = 0; i < fM; i++)
+      fCoefficients[i] = static_cast<SampleType>(even[i] * 0.5 / sum);
+  }
+
+  // upsample (n samples => 2n samples in fOutput)
+  void upsample(Stage &iStage, int32 iChannel, SampleType const *iIn, int32 n)
+  {
+    auto &c = iStage.fChannels[iChannel];
+    auto buf = c.fUp.data();
+    auto acc = iStage.fAccumulator.data();
+    auto g = fCoefficients.data();
+
+    std::memmove(buf + fM - 1, iIn, static_cast<size_t>(n) * sizeof(SampleType));
+
+    // even output samples: FIR (gain of 2 to compensate for the zero stuffing)
+    std::fill(acc, acc + n, 0);
+    for(int32 i = 0; i < fM; i++)
+    {
+      auto gi = 2 * g[i];
+      auto b = buf + i;
+      for(int32 k = 0; k < n; k++)
+        acc[k] += gi * b[k];
+    }
+
+    // odd output samples: delayed input (center tap)
+    auto out = c.fOutput.data();
+    for(int32 k = 0; k < n; k++)
+    {
+      out[2 * k] = acc[k];
+      out[2 * k + 1] = buf[k + fK];
+    }
+
+    // keep the history
+    std::memmove(buf, buf + n, static_cast<size_t>(fM - 1) * sizeof(SampleType));
+  }
+
+  // downsample (n samples => n / 2 samples in oOut)
+  void downsample(Stage &iStage, int32 iChannel, SampleType const *iIn, int32 n, SampleType *oOut)
+  {
+    auto &c = iStage.fChannels[iChannel];
+    auto even = c.fDownEven.data();
+    auto odd = c.fDownOdd.data();
+    auto g = fCoefficients.data();
+    auto half = n / 2;
+
+    for(int32 k = 0; k < half; k++)
+    {
+      even[fM - 1 + k] = iIn[2 * k];
+      odd[fK + k] = iIn[2 * k + 1];
+    }
+
+    // center tap (odd samples delayed by K)
+    for(int32 k = 0; k < half; k++)
+      oOut[k] = static_cast<SampleType>(0.5) * odd[k];
+
+    for(int32 i = 0; i < fM; i++)
+    {
+      auto gi = g[i];
+      auto b = even + i;
+      for(int32 k = 0; k < half; k++)
+        oOut[k] += gi * b[k];
+    }
+
+    // keep the history
+    std::memmove(even, even + half, static_cast<size_t>(fM - 1) * sizeof(SampleType));
+    std::memmove(odd, odd + half, static_cast<size_t>(fK) * sizeof(SampleType));
+  }
+
+private:
+  int32 fNumStages{};
+  int32 fK{}; // numTaps = 4K - 1
+  int32 fM{}; // number of (non zero, non center) even taps = 2K
+  std::vector<SampleType> fCoefficients{};
+
+  int32 fNumChannels{};
+  int32 fMaxSamples{};
+  std::vector<Stage> fStages{};
+};
+
+}
+}
@@ -219,9 +219,9 @@ tresult Parameters::addVstParamDef(std::shared_ptr<RawVstParamDef> iParamDef)
     if(!iParamDef->fTransient)
     {
       if(iParamDef->fOwner == IParamDef::Owner::kGUI)
-        fGUISaveStateOrder.fOrder.emplace_back(paramID);
+        fGUISaveStateOrder.addParamID(paramID);
       else
-        fRTSaveStateOrder.fOrder.emplace_back(paramID);
+        fRTSaveStateOrder.addParamID(paramID);
     }
   }
 
@@ -254,7 +254,7 @@ tresult Parameters::addJmbParamDef(std::shared_ptr<IJmbParamDef> iParamDef)
     fAllRegistrationOrder.emplace_back(paramID);
 
     if(!iParamDef->fTransient && iParamDef->fOwner == IParamDef::Owner::kGUI)
-      fGUISaveStateOrder.fOrder.emplace_back(paramID);
+      fGUISaveStateOrder.addParamID(paramID);
   }
 
   fJmbParams[paramID] = std::move(iParamDef);
@@ -322,20 +322,21 @@ tresult Parameters::setRTSaveStateOrder(NormalizedState::SaveOrder const &iSaveO
     res |= paramOk;
   }
 
+  fRTSaveStateOrder = {iSaveOrder.fVersion, newIds};
+  fRTSaveStateOrder.buildIndex();
+
   for(auto const &p : fVstParams)
   {
     auto param = p.second;
     if(param->fOwner == IParamDef::Owner::kRT && !param->fTransient && !param->isDeprecated())
     {
-      if(std::find(newIds.cbegin(), newIds.cend(), p.first) == newIds.cend())
+      if(fRTSaveStateOrder.findIndex(p.first) == -1)
       {
         DLOG_F(WARNING, "Param [%d] is not marked transient or deprecated. Either mark the parameter transient or deprecated or add it to RTSaveStateOrder", p.first);
       }
     }
   }
 
-  fRTSaveStateOrder = {iSaveOrder.fVersion, newIds};
-
   return res;
 }
 
@@ -401,7 +402,9 @@ tresult Parameters::setRTDeprecatedSaveStateOrder(NormalizedState::SaveOrder con
     DLOG_F(WARNING, "RTDeprecatedSaveStateOrder for version %d does not contain any deprecated parameter.",  iSaveOrder.fVersion);
   }
 
-  fRTDeprecatedSaveStateOrders[iSaveOrder.fVersion] = {iSaveOrder.fVersion, newIds};
+  auto &deprecatedSaveOrder = fRTDeprecatedSaveStateOrders[iSaveOrder.fVersion];
+  deprecatedSaveOrder = {iSaveOrder.fVersion, newIds};
+  deprecatedSaveOrder.buildIndex();
 
   return res;
 }
@@ -469,20 +472,21 @@ tresult Parameters::setGUISaveStateOrder(NormalizedState::SaveOrder const &iSave
 
   }
 
+  fGUISaveStateOrder = {iSaveOrder.fVersion, newIds};
+  fGUISaveStateOrder.buildIndex();
+
   for(auto &&p : allParams)
   {
     auto param = p.second;
     if(param->fOwner == IParamDef::Owner::kGUI && !param->fTransient)
     {
-      if(std::find(newIds.cbegin(), newIds.cend(), p.first) == newIds.cend())
+      if(fGUISaveStateOrder.findIndex(p.first) == -1)
       {
         DLOG_F(WARNING, "Param [%d] is not marked transient. Either mark the parameter transient or add it to GUISaveStateOrder", p.first);
       }
     }
   }
 
-  fGUISaveStateOrder = {iSaveOrder.fVersion, newIds};
-
   return res;
 }
 
@@ -561,7 +565,9 @@ tresult Parameters::setGUIDeprecatedSaveStateOrder(NormalizedState::SaveOrder co
     DLOG_F(WARNING, "RTDeprecatedSaveStateOrder for version %d does not contain any deprecated parameter.",  iSaveOrder.fVersion);
   }
 
-  fGUIDeprecatedSaveStateOrders[iSaveOrder.fVersion] = {iSaveOrder.fVersion, newIds};
+  auto &deprecatedSaveOrder = fGUIDeprecatedSaveStateOrders[iSaveOrder.fVersion];
+  deprecatedSaveOrder = {iSaveOrder.fVersion, newIds};
+  deprecatedSaveOrder.buildIndex();
 
   return res;
 }
@@ -286,6 +286,11 @@ public:
   template<typename... Args>
   tresult setRTDeprecatedSaveStateOrder(int16 iVersion, Args&& ...args);
 
+  /**
+   * Saves the order of a deprecated version (see other `setRTDeprecatedSaveStateOrder` for details). Useful when the
+   * list of parameters is computed rather than enumerated. */
+  tresult setRTDeprecatedSaveStateOrder(NormalizedState::SaveOrder const &iSaveOrder);
+
   /**
    * @return the order used when saving the GUI state (getState/setState in the controller)
    */
@@ -329,6 +334,11 @@ public:
    */
   tresult setGUISaveStateOrder(NormalizedState::SaveOrder const &iSaveOrder);
 
+  /**
+   * Saves the order of a deprecated version (see other `setGUIDeprecatedSaveStateOrder` for details). Useful when the
+   * list of parameters is computed rather than enumerated. */
+  tresult setGUIDeprecatedSaveStateOrder(NormalizedState::SaveOrder const &iSaveOrder);
+
   /**
    * @return the order used when saving the RT state (getState/setState in the processor, setComponentState in
    *         the controller)
@@ -506,14 +516,6 @@ private:
   {
     return buildParamIDs(iParamIDs, iParamDef->fParamID, std::forward<Args>(args)...);
   }
-
-  /**
-   * Called internally with the order for a deprecated version */
-  tresult setRTDeprecatedSaveStateOrder(NormalizedState::SaveOrder const &iSaveOrder);
-
-  /**
-   * Called internally with the order for a deprecated version */
-  tresult setGUIDeprecatedSaveStateOrder(NormalizedState::SaveOrder const &iSaveOrder);
 };
 
 //------------------------------------------------------------------------
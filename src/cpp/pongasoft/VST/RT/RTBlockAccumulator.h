@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pluginterfaces/vst/ivstaudioprocessor.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+/**
+ * Accumulates the (potentially small) blocks provided by the host into internal blocks of a fixed (larger) size
+ * before calling the processing, which amortizes the per block overhead (parameter smoothing setup, filter
+ * coefficients computation, FFT framing...). The output of an internal block is delivered while the next one is
+ * being accumulated, so this introduces a latency of exactly `getBlockSize()` samples.
+ *
+ * This is meant for offline processing (bounce/export) where latency does not matter (the host compensates for it),
+ * and since an internal block spans several host blocks, the processing is called without parameter changes and
+ * events (the parameter values being the ones of the last host block, see `RTProcessor::enableOfflineBlockAccumulation`).
+ *
+ * This class is used by `RTProcessor` and is not meant to be used directly. */
+class RTBlockAccumulator
+{
+public:
+  /**
+   * Allocates the buffers (must not be called from the processing thread). A block size of `0` disables the
+   * accumulation.
+   *
+   * @param iInputChannels the number of channels of each input bus
+   * @param iOutputChannels the number of channels of each output bus */
+  void setup(int32 iSymbolicSampleSize,
+             std::vector<int32> const &iInputChannels,
+             std::vector<int32> const &iOutputChannels,
+             int32 iBlockSize)
+  {
+    fBlockSize = std::max<int32>(iBlockSize, 0);
+    fPosition = 0;
+    fLane32.setup(iSymbolicSampleSize == kSample32 ? fBlockSize : 0, iInputChannels, iOutputChannels);
+    fLane64.setup(iSymbolicSampleSize == kSample64 ? fBlockSize : 0, iInputChannels, iOutputChannels);
+  }
+
+  // isEnabled
+  bool isEnabled() const { return fBlockSize > 0; }
+
+  // getBlockSize
+  int32 getBlockSize() const { return fBlockSize; }
+
+  // getProcessedBlockCount (number of internal blocks processed)
+  uint64 getProcessedBlockCount() const { return fProcessedBlockCount; }
+
+  /**
+   * Accumulates the host block and calls `iProcess(ProcessData &)` for every internal block which is complete. Blocks
+   * which do not match the buses provided in `setup` are processed directly.
+   *
+   * @return the result of the processing (`kResultOk` when no internal block was processed) */
+  template<typename Process>
+  tresult process(ProcessData &data, Process &&iProcess)
+  {
+    if(data.symbolicSampleSize == kSample32)
+      return process(fLane32, data, iProcess);
+    else
+      return process(fLane64, data, iProcess);
+  }
+
+private:
+  // Lane (buffers for one sample size)
+  template<typename SampleType>
+  struct Lane
+  {
+    void setup(int32 iBlockSize, std::vector<int32> const &iInputChannels, std::vector<int32> const &iOutputChannels)
+    {
+      fInputChannels = iBlockSize > 0 ? iInputChannels : std::vector<int32>{};
+      fOutputChannels = iBlockSize > 0 ? iOutputChannels : std::vector<int32>{};
+
+      int32 numChannels = 0;
+      for(auto c: fInputChannels)
+        numChannels += c;
+      for(auto c: fOutputChannels)
+        numChannels += c;
+
+      fSamples.assign(static_cast<size_t>(numChannels) * static_cast<size_t>(iBlockSize), 0);
+      fChannels.resize(static_cast<size_t>(numChannels));
+      for(int32 c = 0; c < numChannels; c++)
+        fChannels[c] = fSamples.data() + static_cast<size_t>(c) * iBlockSize;
+
+      auto ptr = fChannels.data();
+      auto initBuses = [&ptr](std::vector<AudioBusBuffers> &oBuses, std::vector<int32> const &iChannels) {
+        oBuses.assign(iChannels.size(), AudioBusBuffers{});
+        for(size_t i = 0; i < iChannels.size(); i++)
+        {
+          oBuses[i].numChannels = iChannels[i];
+          if constexpr(std::is_same_v<SampleType, Sample32>)
+            oBuses[i].channelBuffers32 = ptr;
+          else
+            oBuses[i].channelBuffers64 = ptr;
+          ptr += iChannels[i];
+        }
+      };
+      initBuses(fInputs, fInputChannels);
+      initBuses(fOutputs, fOutputChannels);
+    }
+
+    // whether the host buses match the internal ones
+    bool fits(ProcessData const &data) const
+    {
+      if(fSamples.empty() ||
+         data.numInputs != static_cast<int32>(fInputs.size()) ||
+         data.numOutputs != static_cast<int32>(fOutputs.size()))
+        return false;
+
+      for(int32 i = 0; i < data.numInputs; i++)
+        if(data.inputs[i].numChannels > fInputChannels[i])
+          return false;
+
+      for(int32 i = 0; i < data.numOutputs; i++)
+        if(data.outputs[i].numChannels > fOutputChannels[i])
+          return false;
+
+      return true;
+    }
+
+    std::vector<int32> fInputChannels{};
+    std::vector<int32> fOutputChannels{};
+    std::vector<SampleType> fSamples{};
+    std::vector<SampleType *> fChannels{};
+    std::vector<AudioBusBuffers> fInputs{};
+    std::vector<AudioBusBuffers> fOutputs{};
+  };
+
+  // getChannelBuffers
+  template<typename SampleType>
+  static inline SampleType **getChannelBuffers(AudioBusBuffers &iBus)
+  {
+    if constexpr(std::is_same_v<SampleType, Sample32>)
+      return iBus.channelBuffers32;
+    else
+      return iBus.channelBuffers64;
+  }
+
+  // process
+  template<typename SampleType, typename Process>
+  tresult process(Lane<SampleType> &iLane, ProcessData &data, Process &iProcess)
+  {
+    // no audio (ex: parameters flush) or buses not matching => direct
+    if(data.numSamples <= 0 || !iLane.fits(data))
+      return iProcess(data);
+
+    // the internal buses have (at least) as many channels as the host ones
+    for(int32 i = 0; i < data.numInputs; i++)
+      iLane.fInputs[i].numChannels = data.inputs[i].numChannels;
+    for(int32 i = 0; i < data.numOutputs; i++)
+      iLane.fOutputs[i].numChannels = data.outputs[i].numChannels;
+
+    tresult res = kResultOk;
+
+    int32 offset = 0;
+    while(offset < data.numSamples)
+    {
+      auto n = std::min(data.numSamples - offset, fBlockSize - fPosition);
+
+      // host inputs => internal inputs
+      for(int32 i = 0; i < data.numInputs; i++)
+      {
+        auto hostChannels = getChannelBuffers<SampleType>(data.inputs[i]);
+        auto channels = getChannelBuffers<SampleType>(iLane.fInputs[i]);
+        for(int32 c = 0; c < data.inputs[i].numChannels; c++)
+        {
+          auto to = channels[c] + fPosition;
+          if(hostChannels && hostChannels[c])
+            std::copy(hostChannels[c] + offset, hostChannels[c] + offset + n, to);
+          else
+            std::fill(to, to + n, 0);
+        }
+      }
+
+      // internal outputs (previous internal block) => host outputs
+      for(int32 i = 0; i < data.numOutputs; i++)
+      {
+        auto hostChannels = getChannelBuffers<SampleType>(data.outputs[i]);
+        auto channels = getChannelBuffers<SampleType>(iLane.fOutputs[i]);
+        for(int32 c = 0; hostChannels && c < data.outputs[i].numChannels; c++)
+        {
+          if(hostChannels[c])
+            std::copy(channels[c] + fPosition, channels[c] + fPosition + n, hostChannels[c] + offset);
+        }
+      }
+
+      fPosition += n;
+      offset += n;
+
+      // internal block complete => process (the outputs have been entirely delivered)
+      if(fPosition == fBlockSize)
+      {
+        ProcessData internalData = data;
+        internalData.numSamples = fBlockSize;
+        internalData.inputs = iLane.fInputs.data();
+        internalData.outputs = iLane.fOutputs.data();
+        internalData.inputParameterChanges = nullptr;
+        internalData.outputParameterChanges = nullptr;
+        internalData.inputEvents = nullptr;
+        internalData.outputEvents = nullptr;
+
+        for(auto &bus: iLane.fInputs)
+          bus.silenceFlags = 0;
+
+        // keeps the first error (tresult values are codes, not flags)
+        auto blockRes = iProcess(internalData);
+        if(res == kResultOk)
+          res = blockRes;
+
+        fProcessedBlockCount++;
+        fPosition = 0;
+      }
+    }
+
+    for(int32 i = 0; i < data.numOutputs; i++)
+      data.outputs[i].silenceFlags = 0;
+
+    return res;
+  }
+
+private:
+  Lane<Sample32> fLane32{};
+  Lane<Sample64> fLane64{};
+  int32 fBlockSize{};
+  int32 fPosition{}; // position in the current internal block
+  uint64 fProcessedBlockCount{};
+};
+
+}
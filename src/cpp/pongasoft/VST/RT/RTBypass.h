@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "RTDelayLine.h"
+
+#include <pluginterfaces/vst/ivstaudioprocessor.h>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+/**
+ * Implements a click free bypass of the main bus (input 0 => output 0): when the bypass state changes, the output of
+ * the processing (wet) and the input (dry) are crossfaded over a (configurable) number of samples, and the dry signal
+ * is delayed by the latency of the plugin (see `RTDelayLine`) so that both are aligned (no comb filtering during
+ * the crossfade, no jump in time when the bypass state changes).
+ *
+ * When fully bypassed, the processing is not called at all and the input is copied to the output (delayed by the
+ * latency if any), which is a no-op when the host provides the same buffers for input and output.
+ *
+ * This class is used by `RTProcessor` (see `RTProcessor::enableBypass`) and is not meant to be used directly. */
+class RTBypass
+{
+public:
+  /**
+   * Allocates the buffers (must not be called from the processing thread) */
+  void setup(int32 iSymbolicSampleSize, int32 iNumChannels, int32 iMaxLatency, int32 iMaxSamplesPerBlock)
+  {
+    fLane32.setup(iSymbolicSampleSize == kSample32 ? iNumChannels : 0, iMaxLatency, iMaxSamplesPerBlock);
+    fLane64.setup(iSymbolicSampleSize == kSample64 ? iNumChannels : 0, iMaxLatency, iMaxSamplesPerBlock);
+  }
+
+  // setCrossfadeSamples
+  void setCrossfadeSamples(int32 iCrossfadeSamples) { fCrossfadeSamples = std::max<int32>(iCrossfadeSamples, 0); }
+
+  // getCrossfadeSamples
+  int32 getCrossfadeSamples() const { return fCrossfadeSamples; }
+
+  /**
+   * Jumps to the given state (no crossfade) */
+  void reset(bool iBypassed)
+  {
+    fMix = iBypassed ? 1.0 : 0.0;
+    fMode = EMode::kNone;
+    fLane32.fLine.reset();
+    fLane64.fLine.reset();
+  }
+
+  /**
+   * @return `true` when fully bypassed (not crossfading) */
+  bool isFullyBypassed() const { return fMix == 1.0; }
+
+  /**
+   * @return the current amount of dry signal (`0` = processed, `1` = bypassed) */
+  double getMix() const { return fMix; }
+
+  /**
+   * Must be called before the processing.
+   *
+   * @return `false` if the block has been fully handled (bypassed) and the processing must not be called */
+  bool beginBlock(ProcessData &data, bool iBypassed, uint32 iLatency)
+  {
+    if(data.symbolicSampleSize == kSample32)
+      return beginBlock(fLane32, data, iBypassed, iLatency);
+    else
+      return beginBlock(fLane64, data, iBypassed, iLatency);
+  }
+
+  /**
+   * Must be called after the processing (when `beginBlock` returned `true`) */
+  void endBlock(ProcessData &data)
+  {
+    if(data.symbolicSampleSize == kSample32)
+      endBlock(fLane32, data);
+    else
+      endBlock(fLane64, data);
+  }
+
+private:
+  enum class EMode { kNone, kCrossfade };
+
+  // Lane (buffers for one sample size)
+  template<typename SampleType>
+  struct Lane
+  {
+    void setup(int32 iNumChannels, int32 iMaxLatency, int32 iMaxSamplesPerBlock)
+    {
+      fNumChannels = std::max<int32>(iNumChannels, 0);
+      fMaxSamples = std::max<int32>(iMaxSamplesPerBlock, 0);
+      fLine.setup(fNumChannels, iMaxLatency, fMaxSamples);
+      fDrySamples.assign(static_cast<size_t>(fNumChannels) * static_cast<size_t>(fMaxSamples), 0);
+      fDryChannels.resize(static_cast<size_t>(fNumChannels));
+      for(int32 c = 0; c < fNumChannels; c++)
+        fDryChannels[c] = fDrySamples.data() + static_cast<size_t>(c) * fMaxSamples;
+      fDryBus.numChannels = fNumChannels;
+      if constexpr(std::is_same_v<SampleType, Sample32>)
+        fDryBus.channelBuffers32 = fDryChannels.data();
+      else
+        fDryBus.channelBuffers64 = fDryChannels.data();
+    }
+
+    // whether the dry signal of a block fits in the buffers
+    bool fits(int32 iNumChannels, int32 iNumSamples) const
+    {
+      return iNumChannels <= fNumChannels && iNumSamples <= fMaxSamples;
+    }
+
+    RTDelayLine<SampleType> fLine{};
+    std::vector<SampleType> fDrySamples{};
+    std::vector<SampleType *> fDryChannels{};
+    AudioBusBuffers fDryBus{};
+    int32 fNumChannels{};
+    int32 fMaxSamples{};
+  };
+
+  // beginBlock
+  template<typename SampleType>
+  bool beginBlock(Lane<SampleType> &iLane, ProcessData &data, bool iBypassed, uint32 iLatency)
+  {
+    fMode = EMode::kNone;
+    fTarget = iBypassed ? 1.0 : 0.0;
+    auto target = fTarget;
+
+    // no audio (ex: parameters flush)
+    if(data.numSamples <= 0 || data.numInputs <= 0 || data.numOutputs <= 0)
+    {
+      fMix = target;
+      return true;
+    }
+
+    AudioBuffers<SampleType> in{data.inputs[0], data.numSamples};
+    AudioBuffers<SampleType> out{data.outputs[0], data.numSamples};
+
+    auto numChannels = std::min(in.getNumChannels(), out.getNumChannels());
+    auto latency = static_cast<int32>(std::min<uint32>(iLatency, static_cast<uint32>(iLane.fLine.getMaxDelay())));
+    iLane.fLine.setDelay(latency);
+
+    // crossfade not possible (should not happen) => hard switch
+    if(fMix != target && (fCrossfadeSamples == 0 || !iLane.fits(numChannels, data.numSamples)))
+      fMix = target;
+
+    // processing
+    if(fMix == 0.0 && !iBypassed)
+    {
+      // keeps the history of the dry path for the next crossfade
+      if(latency > 0)
+        iLane.fLine.push(in);
+      return true;
+    }
+
+    // fully bypassed
+    if(fMix == 1.0 && iBypassed)
+    {
+      if(latency > 0 && numChannels <= iLane.fLine.getNumChannels())
+        iLane.fLine.process(in, out);
+      else
+        out.copyFrom(in);
+
+      // other output buses are cleared
+      for(int32 i = 1; i < data.numOutputs; i++)
+        AudioBuffers<SampleType>{data.outputs[i], data.numSamples}.clear();
+
+      return false;
+    }
+
+    // crossfade => the dry signal is saved before the processing (which may process in place)
+    AudioBuffers<SampleType> dry{iLane.fDryBus, data.numSamples};
+    if(latency > 0)
+      iLane.fLine.process(in, dry);
+    else
+      dry.copyFrom(in);
+
+    fMode = EMode::kCrossfade;
+    return true;
+  }
+
+  // endBlock
+  template<typename SampleType>
+  void endBlock(Lane<SampleType> &iLane, ProcessData &data)
+  {
+    if(fMode != EMode::kCrossfade)
+      return;
+
+    fMode = EMode::kNone;
+
+    AudioBuffers<SampleType> dry{iLane.fDryBus, data.numSamples};
+    AudioBuffers<SampleType> out{data.outputs[0], data.numSamples};
+
+    auto numChannels = std::min(dry.getNumChannels(), out.getNumChannels());
+
+    // mix for the sample i of this block
+    auto step = fTarget > fMix ? 1.0 / fCrossfadeSamples : -1.0 / fCrossfadeSamples;
+    auto mixAt = [this, step](int32 i) { return std::clamp(fMix + step * (i + 1), 0.0, 1.0); };
+
+    for(int32 c = 0; c < numChannels; c++)
+    {
+      auto dryBuffer = dry.getBuffer()[c];
+      auto outBuffer = out.getBuffer()[c];
+      if(!dryBuffer || !outBuffer)
+        continue;
+
+      for(int32 i = 0; i < data.numSamples; i++)
+        outBuffer[i] += static_cast<SampleType>(mixAt(i)) * (dryBuffer[i] - outBuffer[i]);
+    }
+
+    fMix = mixAt(data.numSamples - 1);
+
+    // rounding errors
+    if(std::abs(fMix - fTarget) < 1e-9)
+      fMix = fTarget;
+    out.clearSilentFlag();
+  }
+
+private:
+  Lane<Sample32> fLane32{};
+  Lane<Sample64> fLane64{};
+  int32 fCrossfadeSamples{256};
+  double fMix{}; // 0 = processed, 1 = bypassed
+  double fTarget{};
+  EMode fMode{EMode::kNone};
+};
+
+}
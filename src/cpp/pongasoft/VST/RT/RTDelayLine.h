@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pongasoft/Utils/Collection/CircularBuffer.h>
+#include <pongasoft/VST/AudioBuffer.h>
+
+#include <memory>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+/**
+ * A multichannel delay line whose main use is to compensate for the latency of the processing on a parallel path (ex:
+ * the dry signal of a dry/wet mix when the wet path introduces latency) so that both paths stay sample aligned.
+ *
+ * Memory is allocated in `setup` (called from `setupProcessing`) and processing is done by block (one circular buffer
+ * per channel, accessed as contiguous spans, see `Utils::Collection::CircularBuffer`):
+ *
+ * ```
+ * // setupProcessing
+ * fDryLine.setup(2, kMaxLatency, setup.maxSamplesPerBlock);
+ *
+ * // processInputs32Bits
+ * fDryLine.setDelay(getLatencySamples());
+ * fDryLine.process(in, dry); // dry = in delayed by the latency of the wet path
+ * ```
+ *
+ * @tparam SampleType `Sample32` or `Sample64` */
+template<typename SampleType>
+class RTDelayLine
+{
+public:
+  /**
+   * Allocates the buffers (must not be called from the processing thread). The delay is reset to 0.
+   *
+   * @param iMaxDelay the maximum delay (in samples) that `setDelay` accepts
+   * @param iMaxSamplesPerBlock the (usual) maximum block size (bigger blocks are supported but processed in chunks) */
+  void setup(int32 iNumChannels, int32 iMaxDelay, int32 iMaxSamplesPerBlock)
+  {
+    using Buffer = Utils::Collection::CircularBuffer<SampleType>;
+
+    fMaxDelay = std::max<int32>(iMaxDelay, 0);
+    fDelay = 0;
+
+    auto size = Buffer::nextPowerOfTwo(fMaxDelay + std::max<int32>(iMaxSamplesPerBlock, 1));
+
+    fChannels.clear();
+    for(int32 c = 0; c < iNumChannels; c++)
+    {
+      fChannels.emplace_back(std::make_unique<Buffer>(size));
+      fChannels.back()->init(0);
+    }
+  }
+
+  /**
+   * Sets the delay (clamped to `[0, maxDelay]`). Changing the delay is not smoothed (the output jumps). */
+  void setDelay(int32 iDelay) { fDelay = std::clamp<int32>(iDelay, 0, fMaxDelay); }
+
+  // getDelay
+  int32 getDelay() const { return fDelay; }
+
+  // getMaxDelay
+  int32 getMaxDelay() const { return fMaxDelay; }
+
+  // getNumChannels
+  int32 getNumChannels() const { return static_cast<int32>(fChannels.size()); }
+
+  /**
+   * Clears the content of the line (silence) */
+  void reset()
+  {
+    for(auto &c: fChannels)
+      c->init(0);
+  }
+
+  /**
+   * Copies `iIn` delayed by `getDelay()` samples into `oOut` (which can be the same buffers as `iIn`). Output channels
+   * beyond the number of channels of the line are left untouched. */
+  void process(AudioBuffers<SampleType> const &iIn, AudioBuffers<SampleType> &oOut)
+  {
+    auto numSamples = std::min(iIn.getNumSamples(), oOut.getNumSamples());
+    auto numChannels = std::min({iIn.getNumChannels(), oOut.getNumChannels(), getNumChannels()});
+
+    for(int32 c = 0; c < numChannels; c++)
+    {
+      auto in = iIn.getAudioChannel(c).getBuffer();
+      auto out = oOut.getAudioChannel(c).getBuffer();
+      if(in && out)
+        process(c, in, out, numSamples);
+    }
+
+    // the content of the line is not tracked => output is not flagged silent
+    oOut.clearSilentFlag();
+  }
+
+  /**
+   * Feeds the line without reading it (keeps the history of a path which is not used at the moment) */
+  void push(AudioBuffers<SampleType> const &iIn)
+  {
+    auto numChannels = std::min(iIn.getNumChannels(), getNumChannels());
+
+    for(int32 c = 0; c < numChannels; c++)
+    {
+      auto in = iIn.getAudioChannel(c).getBuffer();
+      if(in)
+        fChannels[c]->pushBlock(in, iIn.getNumSamples());
+    }
+  }
+
+  /**
+   * Processes one channel (`iIn` and `oOut` can be the same buffer) */
+  void process(int32 iChannel, SampleType const *iIn, SampleType *oOut, int32 iNumSamples)
+  {
+    auto &buffer = *fChannels[iChannel];
+
+    // the chunk (pushed first) plus the delay must fit in the buffer
+    auto maxChunk = buffer.getSize() - fDelay;
+
+    while(iNumSamples > 0)
+    {
+      auto n = std::min(iNumSamples, maxChunk);
+
+      buffer.pushBlock(iIn, n);
+
+      // in[k - delay] is at offset -n + k - delay (the last pushed sample being at offset -1)
+      auto spans = buffer.getSpans(-n - fDelay, n);
+      std::copy(spans.fFirst, spans.fFirst + spans.fFirstSize, oOut);
+      std::copy(spans.fSecond, spans.fSecond + spans.fSecondSize, oOut + spans.fFirstSize);
+
+      iIn += n;
+      oOut += n;
+      iNumSamples -= n;
+    }
+  }
+
+private:
+  std::vector<std::unique_ptr<Utils::Collection::CircularBuffer<SampleType>>> fChannels{};
+  int32 fMaxDelay{};
+  int32 fDelay{};
+};
+
+}
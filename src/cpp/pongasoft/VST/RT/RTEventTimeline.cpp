@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "RTEventTimeline.h"
+
+namespace pongasoft::VST::RT {
+
+//------------------------------------------------------------------------
+// RTEventTimeline::add
+//------------------------------------------------------------------------
+void RTEventTimeline::add(Item &iItem)
+{
+  iItem.fSequence = static_cast<int32>(fItems.size());
+  fItems.emplace_back(iItem);
+}
+
+//------------------------------------------------------------------------
+// RTEventTimeline::build
+//------------------------------------------------------------------------
+void RTEventTimeline::build(IParameterChanges *iParameterChanges, IEventList *iEvents, int32 iNumSamples)
+{
+  auto capacity = fItems.capacity();
+
+  fItems.clear();
+
+  auto clamp = [iNumSamples](int32 iSampleOffset) {
+    return iNumSamples > 0 ? std::clamp<int32>(iSampleOffset, 0, iNumSamples - 1) : std::max<int32>(iSampleOffset, 0);
+  };
+
+  Item item{};
+
+  // 1. all the points of all the parameters
+  if(iParameterChanges)
+  {
+    item.fType = Item::Type::kParamChange;
+
+    auto numParams = iParameterChanges->getParameterCount();
+    for(int32 i = 0; i < numParams; i++)
+    {
+      auto queue = iParameterChanges->getParameterData(i);
+      if(!queue)
+        continue;
+
+      item.fParamID = queue->getParameterId();
+
+      auto numPoints = queue->getPointCount();
+      for(int32 j = 0; j < numPoints; j++)
+      {
+        int32 sampleOffset;
+        if(queue->getPoint(j, sampleOffset, item.fValue) == kResultOk)
+        {
+          item.fSampleOffset = clamp(sampleOffset);
+          add(item);
+        }
+      }
+    }
+  }
+
+  // 2. all the events
+  if(iEvents)
+  {
+    item = {};
+    item.fType = Item::Type::kEvent;
+
+    auto numEvents = iEvents->getEventCount();
+    for(int32 i = 0; i < numEvents; i++)
+    {
+      if(iEvents->getEvent(i, item.fEvent) == kResultOk)
+      {
+        item.fSampleOffset = clamp(item.fEvent.sampleOffset);
+        add(item);
+      }
+    }
+  }
+
+  if(fItems.capacity() != capacity)
+    fOverflowCount++;
+
+  // 3. sort by sample offset (parameters first, then events, then host order). Implementation note: std::stable_sort
+  // may allocate memory, hence the explicit sequence number. Each source is (normally) already sorted, so this is
+  // mostly a merge of a few sorted runs.
+  auto compare = [](Item const &iLeft, Item const &iRight) {
+    if(iLeft.fSampleOffset != iRight.fSampleOffset)
+      return iLeft.fSampleOffset < iRight.fSampleOffset;
+    return iLeft.fSequence < iRight.fSequence;
+  };
+
+  if(!std::is_sorted(fItems.begin(), fItems.end(), compare))
+    std::sort(fItems.begin(), fItems.end(), compare);
+}
+
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pluginterfaces/vst/ivstaudioprocessor.h>
+#include <pluginterfaces/vst/ivstevents.h>
+#include <pluginterfaces/vst/ivstparameterchanges.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+/**
+ * Merges, for one processing block, all the parameter change points (`ProcessData::inputParameterChanges`, every
+ * point of every queue, not only the last one) and all the events (`ProcessData::inputEvents`, notes...) in a single
+ * list sorted by sample offset. When a parameter change and an event happen at the same sample offset, the parameter
+ * change comes first (so that a note starting at this offset uses the new value), otherwise the order in which the
+ * host provided them is preserved.
+ *
+ * The items are copied into a buffer allocated ahead of time (see `RTProcessor::enableEventTimeline`) so building the
+ * timeline does not allocate memory (unless there are more items in a block than the capacity, see
+ * `getOverflowCount()`) and iterating over it involves no virtual call (unlike `IEventList` / `IParamValueQueue`).
+ *
+ * ```
+ * // in processInputs32Bits (RTProcessor subclass)
+ * getEventTimeline().forEachSubBlock(data.numSamples,
+ *                                    [&](int32 iStart, int32 iNumSamples) { render(iStart, iNumSamples); },
+ *                                    [&](RTEventTimeline::Item const &iItem) {
+ *                                      if(iItem.isEvent() && iItem.fEvent.type == Event::kNoteOnEvent)
+ *                                        noteOn(iItem.fEvent.noteOn);
+ *                                      else if(iItem.isParamChange())
+ *                                        setParam(iItem.fParamID, iItem.fValue);
+ *                                    });
+ * ```
+ *
+ * \note the data pointed to by some events (ex: `DataEvent::bytes`) is owned by the host and only valid during the
+ *       `process` call. */
+class RTEventTimeline
+{
+public:
+  struct Item
+  {
+    enum class Type : int32
+    {
+      kParamChange,
+      kEvent
+    };
+
+    int32 fSampleOffset{};
+    Type fType{Type::kEvent};
+
+    // Type::kParamChange
+    ParamID fParamID{};
+    ParamValue fValue{};
+
+    // Type::kEvent
+    Event fEvent{};
+
+    // isParamChange
+    inline bool isParamChange() const { return fType == Type::kParamChange; }
+
+    // isEvent
+    inline bool isEvent() const { return fType == Type::kEvent; }
+
+  private:
+    friend class RTEventTimeline;
+
+    // order in which the item was added (to keep the sort stable without allocating)
+    int32 fSequence{};
+  };
+
+  using const_iterator = std::vector<Item>::const_iterator;
+
+public:
+  // Constructor
+  explicit RTEventTimeline(int32 iCapacity = 0) { reserve(iCapacity); }
+
+  /**
+   * Allocates memory for `iCapacity` items (should not be called from the RT thread) */
+  void reserve(int32 iCapacity) { fItems.reserve(static_cast<size_t>(std::max<int32>(iCapacity, 0))); }
+
+  // getCapacity
+  inline int32 getCapacity() const { return static_cast<int32>(fItems.capacity()); }
+
+  /**
+   * Rebuilds the timeline from the parameter changes and events of the provided block (called by `RTProcessor`) */
+  void build(ProcessData const &iData) { build(iData.inputParameterChanges, iData.inputEvents, iData.numSamples); }
+
+  /**
+   * Rebuilds the timeline (any of the inputs can be `nullptr`). The sample offsets are clamped to
+   * `[0, iNumSamples - 1]` (when `iNumSamples > 0`). */
+  void build(IParameterChanges *iParameterChanges, IEventList *iEvents, int32 iNumSamples);
+
+  /**
+   * Removes all the items (keeps the memory) */
+  inline void clear() { fItems.clear(); }
+
+  // size
+  inline int32 size() const { return static_cast<int32>(fItems.size()); }
+
+  // empty
+  inline bool empty() const { return fItems.empty(); }
+
+  // operator[]
+  inline Item const &operator[](int32 iIndex) const { return fItems[static_cast<size_t>(iIndex)]; }
+
+  // begin
+  inline const_iterator begin() const { return fItems.cbegin(); }
+
+  // end
+  inline const_iterator end() const { return fItems.cend(); }
+
+  /**
+   * Splits the block into sub blocks delimited by the sample offsets of the items: for each distinct sample offset,
+   * calls `iRenderCallback(start, numSamples)` for the samples up to this offset (if any), then `iItemCallback(item)`
+   * for all the items at this offset. Finally calls `iRenderCallback` for the remaining samples (if any).
+   *
+   * @tparam RenderCallback `void(int32 iStartSample, int32 iNumSamples)`
+   * @tparam ItemCallback `void(Item const &iItem)` */
+  template<typename RenderCallback, typename ItemCallback>
+  void forEachSubBlock(int32 iNumSamples, RenderCallback &&iRenderCallback, ItemCallback &&iItemCallback) const
+  {
+    int32 start = 0;
+
+    for(auto const &item: fItems)
+    {
+      auto offset = std::min(item.fSampleOffset, iNumSamples);
+      if(offset > start)
+      {
+        iRenderCallback(start, offset - start);
+        start = offset;
+      }
+      iItemCallback(item);
+    }
+
+    if(iNumSamples > start)
+      iRenderCallback(start, iNumSamples - start);
+  }
+
+  /**
+   * @return the number of blocks for which the capacity was not enough (and memory had to be allocated on the RT
+   *         thread). If not 0, the capacity should be increased. */
+  inline uint32 getOverflowCount() const { return fOverflowCount; }
+
+private:
+  // add
+  void add(Item &iItem);
+
+private:
+  std::vector<Item> fItems{};
+  uint32 fOverflowCount{};
+};
+
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "RTProcessor.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+/**
+ * Use this class (instead of `RTProcessor`) as the base class of your processor to implement a single (templated)
+ * kernel for both 32 and 64 bits processing (using the "Curiously Recurring Template Pattern"). Instead of
+ * implementing `processInputs32Bits` and `processInputs64Bits`, the processor implements:
+ *
+ * ```
+ * class MyProcessor : public RTKernelProcessor<MyProcessor>
+ * {
+ * public:
+ *   // called with SampleType = Sample32 or Sample64 (must be accessible by the base class)
+ *   template<typename SampleType>
+ *   tresult processKernel(ProcessData &data);
+ * };
+ * ```
+ *
+ * The call to the kernel is resolved at compile time (no virtual call).
+ *
+ * Internal precision: when `TInternalSample` is provided (`Sample32` or `Sample64`), the kernel is only ever called
+ * with this sample type. For the other sample type, the input buses are converted into internal (preallocated) buffers
+ * prior to calling the kernel, and the output buses are converted back afterwards (simple loops which the compiler
+ * vectorizes). This allows for example to run a `float` only kernel when the host requests 64 bits processing:
+ *
+ * ```
+ * class MyProcessor : public RTKernelProcessor<MyProcessor, Sample32> { ... };
+ * ```
+ *
+ * The internal buffers are allocated in `setActive` (based on the bus arrangements and the maximum number of samples
+ * provided in `setupProcessing`), so make sure to call the base class method if you override it. If the buffers are
+ * not large enough for a block (which should not happen), the kernel is called with the host sample type instead.
+ *
+ * @tparam TProcessor the class of the processor (inheriting from this class)
+ * @tparam TInternalSample `void` (default) to process with the sample type requested by the host, or `Sample32` /
+ *                         `Sample64` to always process with this sample type */
+template<typename TProcessor, typename TInternalSample = void>
+class RTKernelProcessor : public RTProcessor
+{
+  static_assert(std::is_void_v<TInternalSample> ||
+                std::is_same_v<TInternalSample, Sample32> ||
+                std::is_same_v<TInternalSample, Sample64>,
+                "TInternalSample must be void, Sample32 or Sample64");
+
+public:
+  // Constructor
+  explicit RTKernelProcessor(Steinberg::FUID const &iControllerUID) : RTProcessor(iControllerUID) {}
+
+  /** Switch the Plug-in on/off (allocates the internal buffers if necessary) */
+  tresult PLUGIN_API setActive(TBool iState) override
+  {
+    if constexpr(!std::is_void_v<TInternalSample>)
+    {
+      if(iState)
+        allocateInternalBuffers();
+    }
+
+    return RTProcessor::setActive(iState);
+  }
+
+protected:
+  // processInputs32Bits
+  tresult processInputs32Bits(ProcessData &data) override { return dispatch<Sample32>(data); }
+
+  // processInputs64Bits
+  tresult processInputs64Bits(ProcessData &data) override { return dispatch<Sample64>(data); }
+
+private:
+  // dispatch
+  template<typename SampleType>
+  inline tresult dispatch(ProcessData &data)
+  {
+    if constexpr(std::is_void_v<TInternalSample> || std::is_same_v<TInternalSample, SampleType>)
+    {
+      return static_cast<TProcessor *>(this)->template processKernel<SampleType>(data);
+    }
+    else
+    {
+      if(!canUseInternalBuffers(data))
+        return static_cast<TProcessor *>(this)->template processKernel<SampleType>(data);
+
+      ProcessData internalData = data;
+      internalData.symbolicSampleSize = std::is_same_v<TInternalSample, Sample32> ? kSample32 : kSample64;
+      internalData.inputs = fInternalInputs.data();
+      internalData.outputs = fInternalOutputs.data();
+
+      auto ptr = fInternalChannels.data();
+
+      // inputs: host => internal
+      for(int32 i = 0; i < data.numInputs; i++)
+      {
+        auto &bus = data.inputs[i];
+        auto &internalBus = fInternalInputs[i];
+        internalBus.numChannels = bus.numChannels;
+        internalBus.silenceFlags = bus.silenceFlags;
+        setChannelBuffers(internalBus, ptr);
+        auto hostChannels = getChannelBuffers<SampleType>(bus);
+        for(int32 c = 0; c < bus.numChannels; c++, ptr++)
+          convert(hostChannels[c], *ptr, data.numSamples);
+      }
+
+      // outputs (the kernel writes into the internal buffers)
+      auto outputPtr = ptr;
+      for(int32 i = 0; i < data.numOutputs; i++)
+      {
+        auto &internalBus = fInternalOutputs[i];
+        internalBus.numChannels = data.outputs[i].numChannels;
+        internalBus.silenceFlags = 0;
+        setChannelBuffers(internalBus, ptr);
+        ptr += internalBus.numChannels;
+      }
+
+      auto res = static_cast<TProcessor *>(this)->template processKernel<TInternalSample>(internalData);
+
+      // outputs: internal => host
+      ptr = outputPtr;
+      for(int32 i = 0; i < data.numOutputs; i++)
+      {
+        auto &bus = data.outputs[i];
+        bus.silenceFlags = fInternalOutputs[i].silenceFlags;
+        auto hostChannels = getChannelBuffers<SampleType>(bus);
+        for(int32 c = 0; c < bus.numChannels; c++, ptr++)
+          convert(*ptr, hostChannels[c], data.numSamples);
+      }
+
+      return res;
+    }
+  }
+
+  // canUseInternalBuffers (all the channels fit in the preallocated buffers)
+  bool canUseInternalBuffers(ProcessData const &data) const
+  {
+    if(data.numSamples > fInternalMaxSamples ||
+       data.numInputs > static_cast<int32>(fInternalInputs.size()) ||
+       data.numOutputs > static_cast<int32>(fInternalOutputs.size()))
+      return false;
+
+    size_t numChannels = 0;
+    for(int32 i = 0; i < data.numInputs; i++)
+      numChannels += static_cast<size_t>(data.inputs[i].numChannels);
+    for(int32 i = 0; i < data.numOutputs; i++)
+      numChannels += static_cast<size_t>(data.outputs[i].numChannels);
+    return numChannels <= fInternalChannels.size();
+  }
+
+  // allocateInternalBuffers
+  void allocateInternalBuffers()
+  {
+    auto countChannels = [](BusList &iBuses) {
+      int32 numChannels = 0;
+      for(auto &bus: iBuses)
+        numChannels += SpeakerArr::getChannelCount(static_cast<AudioBus *>(bus.get())->getArrangement());
+      return numChannels;
+    };
+
+    auto numChannels = countChannels(audioInputs) + countChannels(audioOutputs);
+
+    fInternalMaxSamples = std::max<int32>(processSetup.maxSamplesPerBlock, 0);
+    fInternalSamples.assign(static_cast<size_t>(numChannels) * static_cast<size_t>(fInternalMaxSamples), 0);
+    fInternalChannels.resize(static_cast<size_t>(numChannels));
+    for(int32 c = 0; c < numChannels; c++)
+      fInternalChannels[c] = fInternalSamples.data() + static_cast<size_t>(c) * fInternalMaxSamples;
+    fInternalInputs.assign(audioInputs.size(), AudioBusBuffers{});
+    fInternalOutputs.assign(audioOutputs.size(), AudioBusBuffers{});
+  }
+
+  // getChannelBuffers
+  template<typename SampleType>
+  static inline SampleType **getChannelBuffers(AudioBusBuffers &iBus)
+  {
+    if constexpr(std::is_same_v<SampleType, Sample32>)
+      return iBus.channelBuffers32;
+    else
+      return iBus.channelBuffers64;
+  }
+
+  // setChannelBuffers
+  template<typename SampleType>
+  static inline void setChannelBuffers(AudioBusBuffers &iBus, SampleType **iChannels)
+  {
+    if constexpr(std::is_same_v<SampleType, Sample32>)
+      iBus.channelBuffers32 = iChannels;
+    else
+      iBus.channelBuffers64 = iChannels;
+  }
+
+  // convert (vectorized by the compiler)
+  template<typename From, typename To>
+  static inline void convert(From const *iFrom, To *oTo, int32 iNumSamples)
+  {
+    if(!iFrom || !oTo)
+      return;
+    for(int32 i = 0; i < iNumSamples; i++)
+      oTo[i] = static_cast<To>(iFrom[i]);
+  }
+
+private:
+  // only used when TInternalSample is not void
+  using InternalSample = std::conditional_t<std::is_void_v<TInternalSample>, Sample32, TInternalSample>;
+
+  int32 fInternalMaxSamples{};
+  std::vector<InternalSample> fInternalSamples{};
+  std::vector<InternalSample *> fInternalChannels{};
+  std::vector<AudioBusBuffers> fInternalInputs{};
+  std::vector<AudioBusBuffers> fInternalOutputs{};
+};
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pluginterfaces/base/ftypes.h>
+
+#include <atomic>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+
+/**
+ * Keeps track of the latency of each component of a plugin introducing one (lookahead limiter, linear phase filter,
+ * oversampling...) and of the total (sum) which is the latency reported to the host.
+ *
+ * Components are added (which allocates memory) in the constructor or `setupProcessing`, and their latency can then be
+ * changed at any time, including from the processing thread. The total can be read from any thread.
+ *
+ * This class is used by `RTProcessor` (see `RTProcessor::addLatencyComponent`) and is not meant to be used directly. */
+class RTLatency
+{
+public:
+  using ComponentID = int32;
+
+  /**
+   * Adds a component (must not be called from the processing thread)
+   *
+   * @return the id of the component (to use with `setLatencySamples`) */
+  ComponentID addComponent(uint32 iLatencySamples = 0)
+  {
+    fComponents.emplace_back(iLatencySamples);
+    updateTotal();
+    return static_cast<ComponentID>(fComponents.size() - 1);
+  }
+
+  /**
+   * Changes the latency of a component (does nothing if the id is invalid) */
+  void setLatencySamples(ComponentID iComponent, uint32 iLatencySamples)
+  {
+    if(iComponent < 0 || iComponent >= static_cast<ComponentID>(fComponents.size()))
+      return;
+
+    if(fComponents[iComponent] != iLatencySamples)
+    {
+      fComponents[iComponent] = iLatencySamples;
+      updateTotal();
+    }
+  }
+
+  // getLatencySamples (for one component)
+  uint32 getLatencySamples(ComponentID iComponent) const
+  {
+    return iComponent >= 0 && iComponent < static_cast<ComponentID>(fComponents.size()) ? fComponents[iComponent] : 0;
+  }
+
+  /**
+   * @return the total latency (sum of all the components) */
+  uint32 getLatencySamples() const { return fTotal.load(std::memory_order_acquire); }
+
+  // hasComponents
+  bool hasComponents() const { return !fComponents.empty(); }
+
+private:
+  void updateTotal()
+  {
+    uint32 total = 0;
+    for(auto l: fComponents)
+      total += l;
+    fTotal.store(total, std::memory_order_release);
+  }
+
+private:
+  std::vector<uint32> fComponents{};
+  std::atomic<uint32> fTotal{0};
+};
+
+}
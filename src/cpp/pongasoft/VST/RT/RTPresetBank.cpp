@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "RTPresetBank.h"
+
+#include <pluginterfaces/base/ibstream.h>
+#include <pongasoft/VST/VstUtils/ReadOnlyMemoryStream.h>
+
+namespace pongasoft::VST::RT {
+
+//------------------------------------------------------------------------
+// RTPresetBank::RTPresetBank
+//------------------------------------------------------------------------
+RTPresetBank::RTPresetBank(Parameters const &iParameters, int iNumPresets) :
+  fPluginParameters{iParameters}
+{
+  DCHECK_F(iNumPresets >= 0);
+  fPresets.reserve(static_cast<size_t>(iNumPresets));
+  for(int i = 0; i < iNumPresets; i++)
+    fPresets.emplace_back(std::make_unique<Preset>(fPluginParameters.newRTState()));
+}
+
+//------------------------------------------------------------------------
+// RTPresetBank::~RTPresetBank
+//------------------------------------------------------------------------
+RTPresetBank::~RTPresetBank()
+{
+  // the jobs reference this object so they must complete first
+  fWorker.stop();
+}
+
+//------------------------------------------------------------------------
+// RTPresetBank::decodePreset
+//------------------------------------------------------------------------
+tresult RTPresetBank::decodePreset(int iPresetIndex, IBStreamer &iStreamer)
+{
+  if(iPresetIndex < 0 || iPresetIndex >= getNumPresets())
+  {
+    DLOG_F(ERROR, "RTPresetBank::decodePreset - invalid preset index [%d]", iPresetIndex);
+    return kInvalidArgument;
+  }
+
+  auto &preset = fPresets[iPresetIndex];
+
+  std::lock_guard<std::mutex> lock{fDecodeMutex};
+
+  bool res = preset->fState.updateIf([this, &iStreamer](auto oNormalizedState) -> bool {
+    return fPluginParameters.readRTState(iStreamer, oNormalizedState) == kResultOk;
+  });
+
+  if(res)
+    preset->fReady = true;
+  else
+    DLOG_F(WARNING, "RTPresetBank::decodePreset - could not decode preset [%d]", iPresetIndex);
+
+  return res ? kResultOk : kResultFalse;
+}
+
+//------------------------------------------------------------------------
+// RTPresetBank::decodePresetAsync
+//------------------------------------------------------------------------
+void RTPresetBank::decodePresetAsync(int iPresetIndex, std::vector<int8> iPresetData)
+{
+  fWorker.submit([this, iPresetIndex, data = std::move(iPresetData)]() {
+    VstUtils::ReadOnlyMemoryStream stream{reinterpret_cast<char const *>(data.data()),
+                                          static_cast<TSize>(data.size())};
+    IBStreamer streamer(&stream, kLittleEndian);
+    decodePreset(iPresetIndex, streamer);
+  });
+}
+
+//------------------------------------------------------------------------
+// RTPresetBank::isPresetReady
+//------------------------------------------------------------------------
+bool RTPresetBank::isPresetReady(int iPresetIndex) const
+{
+  if(iPresetIndex < 0 || iPresetIndex >= getNumPresets())
+    return false;
+
+  return fPresets[iPresetIndex]->fReady.load();
+}
+
+//------------------------------------------------------------------------
+// RTPresetBank::requestPresetChange
+//------------------------------------------------------------------------
+bool RTPresetBank::requestPresetChange(int iPresetIndex)
+{
+  if(iPresetIndex < 0 || iPresetIndex >= getNumPresets())
+    return false;
+
+  fRequestBlockCount = fBlockCount.load();
+  fRequestedPresetIndex = iPresetIndex;
+  return true;
+}
+
+//------------------------------------------------------------------------
+// RTPresetBank::beforeProcessing
+//------------------------------------------------------------------------
+NormalizedState const *RTPresetBank::beforeProcessing()
+{
+  auto blockCount = fBlockCount.load();
+  fBlockCount = blockCount + 1;
+
+  auto presetIndex = fRequestedPresetIndex.load();
+
+  if(presetIndex == kNoRequest)
+    return nullptr;
+
+  auto &preset = fPresets[presetIndex];
+
+  // not decoded yet => we try again next block
+  if(!preset->fReady.load())
+    return nullptr;
+
+  // only clear the request if it has not been changed in the meantime
+  if(!fRequestedPresetIndex.compare_exchange_strong(presetIndex, kNoRequest))
+    return nullptr;
+
+  fLastSwitchInfo.fPreviousPresetIndex = fLastSwitchInfo.fCurrentPresetIndex;
+  fLastSwitchInfo.fCurrentPresetIndex = presetIndex;
+  fLastSwitchInfo.fLatencyInBlocks = blockCount - fRequestBlockCount.load();
+
+  return preset->fState.get();
+}
+
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pongasoft/Utils/Concurrent/Concurrent.h>
+#include <pongasoft/Utils/Concurrent/WorkerThread.h>
+#include <pongasoft/VST/Parameters.h>
+#include <pongasoft/VST/NormalizedState.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+/**
+ * A bank of presets which are decoded ahead of time (from the UI thread or on a background thread) into
+ * `NormalizedState` objects so that switching from one preset to another is instantaneous on the RT thread: no
+ * stream reading, no memory allocation, only a copy of the normalized values into the RT parameters.
+ *
+ * Usage:
+ *
+ * ```
+ * // in the processor (RTProcessor subclass) constructor
+ * fPresetBank = std::make_unique<RTPresetBank>(fParams, 16);
+ * fState.setPresetBank(fPresetBank.get());
+ *
+ * // anywhere outside the RT thread (ex: setupProcessing, a message from the UI...)
+ * fPresetBank->decodePresetAsync(3, std::move(bytes)); // bytes = content of a previously saved RT state
+ *
+ * // any thread (including RT, for example on a program change parameter)
+ * fPresetBank->requestPresetChange(3);
+ * ```
+ *
+ * The switch then happens in `RTState::beforeProcessing` (the same step where a state set by `setState` is applied).
+ * As a result, for the block in which the switch happens, every `RTVstParam` has its previous value set to the value
+ * from the old preset and its current value set to the value from the new preset, which a plugin can use to crossfade
+ * (`RTVstParameter::hasChanged`, `getPreviousValue`, `getValue`).
+ *
+ * Thread safety: `decodePreset`/`decodePresetAsync` can be called from any non RT thread. `requestPresetChange` is
+ * lock free and can be called from any thread. `beforeProcessing` must be called from the RT thread only (which
+ * `RTState` does). Note that the bank uses its own lock free hand-off (one `AtomicValue` per preset) instead of
+ * `RTState::fStateUpdate` because the latter only supports a single producer (the thread calling `setState`). */
+class RTPresetBank
+{
+public:
+  /**
+   * Information about the last preset switch (RT thread only) */
+  struct SwitchInfo
+  {
+    int fPreviousPresetIndex{-1};
+    int fCurrentPresetIndex{-1};
+
+    // number of blocks (calls to `beforeProcessing`) between the request and the actual switch (0 means the
+    // switch happened in the first block following the request)
+    int32 fLatencyInBlocks{-1};
+  };
+
+public:
+  // Constructor => preallocates all the states (uses the RT save state order)
+  RTPresetBank(Parameters const &iParameters, int iNumPresets);
+
+  // Destructor => waits for pending decoding jobs
+  ~RTPresetBank();
+
+  // getNumPresets
+  inline int getNumPresets() const { return static_cast<int>(fPresets.size()); }
+
+  /**
+   * Decodes the preset synchronously (same format as `RTProcessor::setState`, deprecated versions included).
+   * Must NOT be called from the RT thread.
+   *
+   * @return `kResultOk` if the preset was decoded and is ready to be switched to */
+  tresult decodePreset(int iPresetIndex, IBStreamer &iStreamer);
+
+  /**
+   * Same as `decodePreset` but the decoding happens on a background thread (`iPresetData` is the content of the
+   * stream). Must NOT be called from the RT thread. */
+  void decodePresetAsync(int iPresetIndex, std::vector<int8> iPresetData);
+
+  /**
+   * Blocks until all the presets submitted with `decodePresetAsync` have been decoded */
+  void waitForDecoding() { fWorker.waitForIdle(); }
+
+  /**
+   * @return `true` if the preset has been decoded (thread safe) */
+  bool isPresetReady(int iPresetIndex) const;
+
+  /**
+   * Requests a switch to the given preset which will happen at the beginning of the next block (or as soon as the
+   * preset is ready if it is still being decoded). Lock free: can be called from any thread including the RT thread.
+   * If called multiple times before the switch happens, only the last request is honored.
+   *
+   * @return `false` if the index is out of range */
+  bool requestPresetChange(int iPresetIndex);
+
+  /**
+   * Called from the RT thread (by `RTState::beforeProcessing`) at the beginning of each block.
+   *
+   * @return the state to switch to or `nullptr` if there is no switch to do */
+  NormalizedState const *beforeProcessing();
+
+  /**
+   * @return information about the last switch (RT thread only) */
+  inline SwitchInfo const &getLastSwitchInfo() const { return fLastSwitchInfo; }
+
+  /**
+   * @return the number of blocks processed so far (RT thread only) */
+  inline int32 getBlockCount() const { return fBlockCount; }
+
+private:
+  // Special value when there is no pending request
+  static constexpr int kNoRequest = -1;
+
+  struct Preset
+  {
+    explicit Preset(std::unique_ptr<NormalizedState> iState) : fState{std::move(iState)} {}
+
+    // written by the decoding threads (serialized by fDecodeMutex), read by the RT thread
+    Utils::Concurrent::LockFree::AtomicValue<NormalizedState> fState;
+    std::atomic<bool> fReady{false};
+  };
+
+private:
+  Parameters const &fPluginParameters;
+  std::vector<std::unique_ptr<Preset>> fPresets{};
+
+  // serializes the "set" side of the presets (there can be multiple decoding threads)
+  std::mutex fDecodeMutex{};
+
+  // background thread used by decodePresetAsync
+  Utils::Concurrent::WorkerThread fWorker{};
+
+  // pending request (preset index and block count at the time of the request)
+  std::atomic<int> fRequestedPresetIndex{kNoRequest};
+  std::atomic<int32> fRequestBlockCount{0};
+
+  // written by the RT thread only (atomic because read by requestPresetChange)
+  std::atomic<int32> fBlockCount{0};
+
+  // RT only
+  SwitchInfo fLastSwitchInfo{};
+};
+
+}
@@ -17,6 +17,10 @@
  */
 #include "RTProcessor.h"
 
+#include <pongasoft/logging/rt_logging.h>
+#include <pongasoft/VST/AudioBuffer.h>
+#include <pongasoft/Utils/Denormals.h>
+
 namespace pongasoft {
 namespace VST {
 namespace RT {
@@ -41,9 +45,17 @@ RTProcessor::RTProcessor(Steinberg::FUID const &iControllerUID) :
 tresult RTProcessor::setActive(TBool iState)
 {
   fActive = iState;
+  fSilentSampleCount = 0;
   fGUITimer = nullptr;
   fGUIMessageTimer = nullptr;
 
+  // allocates the buffers (depend on the bus arrangements and the setup)
+  if(fActive)
+  {
+    setupBypass();
+    setupBlockAccumulator();
+  }
+
   // when the processor is activated, start the GUI timer(s)
   if(fActive)
   {
@@ -55,7 +67,8 @@ tresult RTProcessor::setActive(TBool iState)
       fGUITimer = AutoReleaseTimer::create(&fGUITimerCallback, fGUITimerIntervalMs);
     }
 
-    if(getRTState()->isMessagingEnabled())
+    // the messaging timer is also used to notify latency changes
+    if(getRTState()->isMessagingEnabled() || fLatency.hasComponents())
     {
 #ifdef JAMBA_DEBUG_LOGGING
       DLOG_F(INFO, "RTProcessor::setActive - Enabling GUI messaging timer - interval [%d]", fGUIMessageTimerIntervalMs);
@@ -80,6 +93,63 @@ tresult RTProcessor::notify(IMessage *message)
   return getRTState()->handleMessage(m);
 }
 
+//------------------------------------------------------------------------
+// RTProcessor::onGUIMessageTimer
+//------------------------------------------------------------------------
+void RTProcessor::onGUIMessageTimer()
+{
+  notifyLatencyChange();
+
+  if(getRTState()->isMessagingEnabled())
+    sendPendingMessages();
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::addLatencyComponent
+//------------------------------------------------------------------------
+RTLatency::ComponentID RTProcessor::addLatencyComponent(uint32 iLatencySamples)
+{
+  return fLatency.addComponent(iLatencySamples);
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::getLatencySamples
+//------------------------------------------------------------------------
+uint32 RTProcessor::getLatencySamples()
+{
+  auto latency = fLatency.getLatencySamples();
+  fReportedLatency = latency;
+  return latency;
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::notifyLatencyChange
+//------------------------------------------------------------------------
+void RTProcessor::notifyLatencyChange()
+{
+  auto latency = fLatency.getLatencySamples();
+
+  // the host already knows this latency
+  if(latency == fReportedLatency)
+  {
+    fNotifiedLatency = latency;
+    return;
+  }
+
+  // already notified (the host may not query the latency right away)
+  if(latency == fNotifiedLatency)
+    return;
+
+  auto message = allocateMessage();
+  if(message)
+  {
+    Message m{message.get()};
+    m.setMessageID(kLatencyChangedMessageID);
+    if(sendMessage(message) == kResultOk)
+      fNotifiedLatency = latency;
+  }
+}
+
 //------------------------------------------------------------------------
 // RTProcessor::process
 //------------------------------------------------------------------------
@@ -96,8 +166,26 @@ tresult RTProcessor::process(ProcessData &data)
     state->applyParameterChanges(*data.inputParameterChanges);
   }
 
-  // 3. process inputs
-  tresult res = processInputs(data);
+  // 2a. report the values of a preset switched to in step 1. to the host/controller
+  state->addPresetChangesToOutput(data);
+
+  // 2b. merge parameter changes and events (if enabled)
+  if(fEventTimelineEnabled)
+    fEventTimeline.build(data);
+
+  // 3. process inputs (unless bypassed or silent and can be skipped)
+  tresult res;
+  if(fBypassParam)
+  {
+    res = kResultOk;
+    if(fBypass.beginBlock(data, fBypassParam->value(), fLatency.getLatencySamples()))
+    {
+      res = processInputsOrSkip(data);
+      fBypass.endBlock(data);
+    }
+  }
+  else
+    res = processInputsOrSkip(data);
 
   // 4. update the previous state
   state->afterProcessing();
@@ -105,6 +193,90 @@ tresult RTProcessor::process(ProcessData &data)
   return res;
 }
 
+//------------------------------------------------------------------------
+// RTProcessor::processInputsOrSkip
+//------------------------------------------------------------------------
+tresult RTProcessor::processInputsOrSkip(ProcessData &data)
+{
+  // the accumulated blocks are not aligned with the host blocks => never skipped
+  if(!fBlockAccumulator.isEnabled() && canSkipProcessInputs(data))
+  {
+    clearOutputs(data);
+    fSkippedBlockCount++;
+    return kResultOk;
+  }
+
+  if(fNoDenormalsEnabled)
+  {
+    Utils::ScopedNoDenormals noDenormals{};
+    return processInputsOrAccumulate(data);
+  }
+
+  return processInputsOrAccumulate(data);
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::processInputsOrAccumulate
+//------------------------------------------------------------------------
+tresult RTProcessor::processInputsOrAccumulate(ProcessData &data)
+{
+  if(fBlockAccumulator.isEnabled())
+    return fBlockAccumulator.process(data, [this](ProcessData &iData) { return processInputs(iData); });
+
+  return processInputs(data);
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::canSkipProcessInputs
+//------------------------------------------------------------------------
+bool RTProcessor::canSkipProcessInputs(ProcessData &data)
+{
+  // no audio (ex: parameters flush) or no input bus => never skipped
+  if(!fSilenceSkipEnabled || data.numSamples <= 0 || data.numInputs <= 0)
+    return false;
+
+  bool silent = data.inputEvents == nullptr || data.inputEvents->getEventCount() == 0;
+
+  for(int32 i = 0; silent && i < data.numInputs; i++)
+  {
+    // the silence flags do not depend on the sample size
+    silent = AudioBuffers32{data.inputs[i], data.numSamples}.isSilent();
+  }
+
+  if(!silent)
+  {
+    fSilentSampleCount = 0;
+    return false;
+  }
+
+  auto tailSamples = getTailSamples();
+
+  if(tailSamples == kInfiniteTail)
+    return false;
+
+  // tail has elapsed => skip
+  if(fSilentSampleCount >= tailSamples)
+    return true;
+
+  // still in the tail => process
+  fSilentSampleCount += static_cast<uint64>(data.numSamples);
+  return false;
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::clearOutputs
+//------------------------------------------------------------------------
+void RTProcessor::clearOutputs(ProcessData &data)
+{
+  for(int32 i = 0; i < data.numOutputs; i++)
+  {
+    if(data.symbolicSampleSize == kSample32)
+      AudioBuffers32{data.outputs[i], data.numSamples}.clear();
+    else
+      AudioBuffers64{data.outputs[i], data.numSamples}.clear();
+  }
+}
+
 //------------------------------------------------------------------------
 // RTProcessor::processInputs
 //------------------------------------------------------------------------
@@ -116,7 +288,7 @@ tresult RTProcessor::processInputs(ProcessData &data)
     if(fSymbolicSampleSize != data.symbolicSampleSize)
     {
       fSymbolicSampleSize = data.symbolicSampleSize;
-      DLOG_F(INFO, "RTProcessor::processInputs - Using 32 bits processing");
+      DRTLOG_F(INFO, "RTProcessor::processInputs - Using 32 bits processing");
     }
 #endif
     return processInputs32Bits(data);
@@ -128,7 +300,7 @@ tresult RTProcessor::processInputs(ProcessData &data)
     if(fSymbolicSampleSize != data.symbolicSampleSize)
     {
       fSymbolicSampleSize = data.symbolicSampleSize;
-      DLOG_F(INFO, "RTProcessor::processInputs - Using 64 bits processing");
+      DRTLOG_F(INFO, "RTProcessor::processInputs - Using 64 bits processing");
     }
 #endif
     return processInputs64Bits(data);
@@ -160,6 +332,97 @@ void RTProcessor::enableGUITimer(uint32 iUIFrameRateMs)
   fGUITimerIntervalMs = iUIFrameRateMs;
 }
 
+//------------------------------------------------------------------------
+// RTProcessor::enableEventTimeline
+//------------------------------------------------------------------------
+void RTProcessor::enableEventTimeline(int32 iCapacity)
+{
+  fEventTimelineEnabled = true;
+  fEventTimeline.reserve(iCapacity);
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::enableBypass
+//------------------------------------------------------------------------
+void RTProcessor::enableBypass(RTVstParam<bool> iBypassParam, int32 iCrossfadeSamples, int32 iMaxLatencySamples)
+{
+  fBypassParam = iBypassParam;
+  fBypass.setCrossfadeSamples(iCrossfadeSamples);
+  fBypassMaxLatency = std::max<int32>(iMaxLatencySamples, 0);
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::setupBypass
+//------------------------------------------------------------------------
+void RTProcessor::setupBypass()
+{
+  if(!fBypassParam)
+    return;
+
+  int32 numChannels = 0;
+  if(!audioOutputs.empty())
+    numChannels = SpeakerArr::getChannelCount(static_cast<AudioBus *>(audioOutputs[0].get())->getArrangement());
+
+  auto maxLatency = std::max<int32>(fBypassMaxLatency, static_cast<int32>(fLatency.getLatencySamples()));
+
+  fBypass.setup(processSetup.symbolicSampleSize, numChannels, maxLatency, processSetup.maxSamplesPerBlock);
+  fBypass.reset(fBypassParam->value());
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::setupProcessing
+//------------------------------------------------------------------------
+tresult RTProcessor::setupProcessing(ProcessSetup &setup)
+{
+  tresult result = AudioEffect::setupProcessing(setup);
+
+  if(result != kResultOk)
+    return result;
+
+  auto state = getRTState();
+  auto previousProcessMode = state->getProcessMode();
+  state->setProcessMode(setup.processMode);
+
+  // the accumulation (and its latency) only applies offline
+  if(fOfflineBlockLatency >= 0)
+    fLatency.setLatencySamples(fOfflineBlockLatency, setup.processMode == kOffline ? fOfflineBlockSize : 0);
+
+  if(previousProcessMode != setup.processMode)
+    onProcessModeChanged(setup.processMode, previousProcessMode);
+
+  return result;
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::enableOfflineBlockAccumulation
+//------------------------------------------------------------------------
+void RTProcessor::enableOfflineBlockAccumulation(int32 iBlockSize)
+{
+  fOfflineBlockSize = std::max<int32>(iBlockSize, 0);
+  if(fOfflineBlockLatency < 0)
+    fOfflineBlockLatency = fLatency.addComponent(0);
+}
+
+//------------------------------------------------------------------------
+// RTProcessor::setupBlockAccumulator
+//------------------------------------------------------------------------
+void RTProcessor::setupBlockAccumulator()
+{
+  if(fOfflineBlockLatency < 0)
+    return;
+
+  auto channels = [](BusList &iBuses) {
+    std::vector<int32> res{};
+    for(auto &bus: iBuses)
+      res.emplace_back(SpeakerArr::getChannelCount(static_cast<AudioBus *>(bus.get())->getArrangement()));
+    return res;
+  };
+
+  auto blockSize = processSetup.processMode == kOffline ? fOfflineBlockSize : 0;
+
+  fBlockAccumulator.setup(processSetup.symbolicSampleSize, channels(audioInputs), channels(audioOutputs), blockSize);
+}
+
 //------------------------------------------------------------------------
 // RTProcessor::setState
 //------------------------------------------------------------------------
@@ -194,9 +457,35 @@ tresult RTProcessor::initialize(FUnknown *context)
   if(result != kResultOk)
     return result;
 
+#ifdef JAMBA_DEBUG_LOGGING
+  // the processing code (processInputs) uses RT safe logging (the background thread is shared by all the instances
+  // and stopped when the last one terminates)
+  if(!fRTLoggerAcquired)
+  {
+    pongasoft::logging::RTLogger::instance().acquire();
+    fRTLoggerAcquired = true;
+  }
+#endif
+
   return getRTState()->init();
 }
 
+//------------------------------------------------------------------------
+// RTProcessor::terminate
+//------------------------------------------------------------------------
+tresult RTProcessor::terminate()
+{
+#ifdef JAMBA_DEBUG_LOGGING
+  if(fRTLoggerAcquired)
+  {
+    pongasoft::logging::RTLogger::instance().release();
+    fRTLoggerAcquired = false;
+  }
+#endif
+
+  return AudioEffect::terminate();
+}
+
 //------------------------------------------------------------------------
 // RTProcessor::allocateMessage
 //------------------------------------------------------------------------
@@ -21,6 +21,12 @@
 #include <public.sdk/source/vst/vstaudioeffect.h>
 #include <pongasoft/VST/Timer.h>
 #include "RTState.h"
+#include "RTEventTimeline.h"
+#include "RTLatency.h"
+#include "RTBypass.h"
+#include "RTBlockAccumulator.h"
+
+#include <optional>
 
 namespace pongasoft {
 namespace VST {
@@ -49,6 +55,9 @@ public:
   /** Called at first after constructor (setup input/output) */
   tresult PLUGIN_API initialize(FUnknown *context) override;
 
+  /** Called at the end before destructor */
+  tresult PLUGIN_API terminate() override;
+
   /** Switch the Plug-in on/off */
   tresult PLUGIN_API setActive(TBool state) override;
 
@@ -67,6 +76,12 @@ public:
   /** Called to handle a message (coming from GUI) */
   tresult PLUGIN_API notify(IMessage *message) SMTG_OVERRIDE;
 
+  /** Stores the process mode in the state (and calls `onProcessModeChanged` when it changes) */
+  tresult PLUGIN_API setupProcessing(ProcessSetup &setup) SMTG_OVERRIDE;
+
+  /** Returns the latency (sum of the latency of all the components, see `addLatencyComponent`) */
+  uint32 PLUGIN_API getLatencySamples() SMTG_OVERRIDE;
+
 protected:
   /**
    * @return true if you can handle 32 bits (true buy default) */
@@ -110,6 +125,123 @@ protected:
    * Called (from a GUI timer) to send the messages to the GUI (JmbParam for the moment) */
    virtual void sendPendingMessages() { getRTState()->sendPendingMessages(this); }
 
+  /**
+   * Call this method to enable skipping the processing (`processInputs`) when all the input buses are silent (and
+   * there is no input event) and the tail (as returned by `getTailSamples()`, which is also what is reported to the
+   * host) has elapsed since the last non silent input. Instead, the outputs are cleared (and flagged silent).
+   * Parameter changes are still applied and the state still updated.
+   *
+   * Plugins producing sound without input (generators, instruments...) or whose output depends on something other
+   * than the inputs (ex: an LFO driven parameter sent to the GUI) should not enable this mode, or should return
+   * `kInfiniteTail` from `getTailSamples()` while this is the case.
+   *
+   * Should be called in the constructor or setupProcessing method (disabled by default). */
+  void enableSilenceSkip(bool iEnabled = true) { fSilenceSkipEnabled = iEnabled; }
+
+  // isSilenceSkipEnabled
+  bool isSilenceSkipEnabled() const { return fSilenceSkipEnabled; }
+
+  /**
+   * By default, denormals are flushed to 0 while `processInputs` is running (see `Utils::ScopedNoDenormals`) and the
+   * host's floating point mode is restored afterwards. Call this method with `false` to disable this behavior (for
+   * example if the plugin manages the floating point mode itself). */
+  void enableNoDenormals(bool iEnabled = true) { fNoDenormalsEnabled = iEnabled; }
+
+  // isNoDenormalsEnabled
+  bool isNoDenormalsEnabled() const { return fNoDenormalsEnabled; }
+
+  /**
+   * Call this method to have `process` build (before calling `processInputs`) the timeline merging all the parameter
+   * change points and input events of the block, sorted by sample offset (see `RTEventTimeline`), accessible with
+   * `getEventTimeline()`. `iCapacity` is the maximum number of items (parameter points + events) expected in a block
+   * (memory is allocated by this call, not during processing).
+   *
+   * Should be called in the constructor or setupProcessing method (disabled by default). */
+  void enableEventTimeline(int32 iCapacity = 1024);
+
+  /**
+   * @return the timeline for the current block (empty unless `enableEventTimeline` was called) */
+  RTEventTimeline const &getEventTimeline() const { return fEventTimeline; }
+
+  /**
+   * Declares a component of the plugin introducing latency (lookahead, linear phase filter, oversampling...). The
+   * latency reported to the host (`getLatencySamples`) is the sum of the latency of all the components. When it
+   * changes (`setLatencySamples`), the controller is notified (from the GUI messaging timer, not the processing thread)
+   * and `GUIController` asks the host to restart the component (`kLatencyChanged`), so that it queries the new
+   * latency. Use `RTDelayLine` to keep a parallel (dry) path aligned.
+   *
+   * Should be called in the constructor or setupProcessing method.
+   *
+   * @return the id of the component (to use with `setLatencySamples`) */
+  RTLatency::ComponentID addLatencyComponent(uint32 iLatencySamples = 0);
+
+  /**
+   * Changes the latency of a component (declared with `addLatencyComponent`). Can be called from any method, including
+   * `processInputs`. */
+  void setLatencySamples(RTLatency::ComponentID iComponent, uint32 iLatencySamples)
+  {
+    fLatency.setLatencySamples(iComponent, iLatencySamples);
+  }
+
+  /**
+   * @return the latency of a component (declared with `addLatencyComponent`) */
+  uint32 getLatencySamples(RTLatency::ComponentID iComponent) const { return fLatency.getLatencySamples(iComponent); }
+
+  /**
+   * Call this method to have the framework handle the bypass parameter (the one flagged `ParameterInfo::kIsBypass`):
+   *
+   * - when the value changes, the output of the processing and the input are crossfaded over `iCrossfadeSamples`
+   *   samples (no click)
+   * - the input is delayed by the latency of the plugin (see `addLatencyComponent`, `iMaxLatencySamples` being the
+   *   maximum latency to compensate, when not known yet) so that the bypassed signal stays aligned
+   * - when fully bypassed, `processInputs` is not called and the input is copied to the output (which is a no-op
+   *   when the host uses the same buffers)
+   *
+   * Only the main bus (input 0 => output 0) is bypassed (other output buses are cleared). The buffers are allocated in
+   * `setActive`. Should be called in the constructor or setupProcessing method (disabled by default). */
+  void enableBypass(RTVstParam<bool> iBypassParam, int32 iCrossfadeSamples = 256, int32 iMaxLatencySamples = 0);
+
+  /**
+   * @return `true` when fully bypassed (see `enableBypass`) */
+  bool isFullyBypassed() const { return fBypassParam && fBypass.isFullyBypassed(); }
+
+  /**
+   * Called from `setupProcessing` when the process mode (`kRealtime`, `kPrefetch` or `kOffline`) changes. Since the
+   * processor is not active at this time, this is the place to safely switch quality settings (ex: a higher
+   * oversampling factor, longer filters...) and allocate memory accordingly, for example:
+   *
+   * ```
+   * void onProcessModeChanged(int32 iProcessMode, int32 iPreviousProcessMode) override
+   * {
+   *   fOversampler = Oversampler<Sample32>{iProcessMode == kOffline ? 8 : 2};
+   * }
+   * ```
+   *
+   * The current mode is also available from the state (`RTState::getProcessMode`). */
+  virtual void onProcessModeChanged(int32 iProcessMode, int32 iPreviousProcessMode) {}
+
+  /**
+   * Call this method to have the framework accumulate the blocks provided by the host, when rendering offline, into
+   * internal blocks of `iBlockSize` samples before calling `processInputs` (see `RTBlockAccumulator`). This amortizes
+   * the per block overhead when the host uses small blocks during a bounce. The added latency (`iBlockSize` samples,
+   * offline only) is reported to the host.
+   *
+   * Since an internal block spans several host blocks, `processInputs` is then called without parameter changes and
+   * events (`RTState` parameters still have the value of the last host block). This is meant for effects which do not
+   * require sample accurate automation or events.
+   *
+   * Should be called in the constructor (disabled by default). */
+  void enableOfflineBlockAccumulation(int32 iBlockSize = 4096);
+
+public:
+  /**
+   * @return the number of blocks for which the processing was skipped (see `enableSilenceSkip`). This counter is
+   *         updated by the processing thread and is meant for statistics/debugging only. */
+  uint64 getSkippedBlockCount() const { return fSkippedBlockCount; }
+
+  // resetSkippedBlockCount
+  void resetSkippedBlockCount() { fSkippedBlockCount = 0; }
+
 protected:
   // interval for gui message timer (can be changed by subclass BEFORE calling initialize)
   uint32 fGUIMessageTimerIntervalMs;
@@ -121,6 +253,31 @@ public:
   // sendMessage
   tresult sendMessage(IPtr<IMessage> iMessage) override;
 
+private:
+  // returns true if processInputs can be skipped (updates the tail tracking)
+  bool canSkipProcessInputs(ProcessData &data);
+
+  // clears all the outputs (and sets the silence flags)
+  static void clearOutputs(ProcessData &data);
+
+  // processInputs unless it can be skipped (see enableSilenceSkip)
+  tresult processInputsOrSkip(ProcessData &data);
+
+  // processInputs directly or through the block accumulator (see enableOfflineBlockAccumulation)
+  tresult processInputsOrAccumulate(ProcessData &data);
+
+  // allocates the buffers used by the block accumulator
+  void setupBlockAccumulator();
+
+  // allocates the buffers used by the bypass
+  void setupBypass();
+
+  // called by the GUI messaging timer
+  void onGUIMessageTimer();
+
+  // sends a message to the controller if the latency has changed since the host queried it
+  void notifyLatencyChange();
+
 private:
   using RTProcessorCallback = void (RTProcessor::*)();
 
@@ -149,13 +306,43 @@ private:
   std::unique_ptr<AutoReleaseTimer> fGUITimer;
 
   // the timer that will handle sending messages (enabled when there are messages to handle)
-  GUITimerCallback fGUIMessageTimerCallback{this, &RTProcessor::sendPendingMessages};
+  GUITimerCallback fGUIMessageTimerCallback{this, &RTProcessor::onGUIMessageTimer};
   std::unique_ptr<AutoReleaseTimer> fGUIMessageTimer;
 
   bool fActive;
 
+  // flush denormals to 0 during processInputs (disabled with enableNoDenormals(false))
+  bool fNoDenormalsEnabled{true};
+
+  // merged timeline of parameter changes and events (enabled with enableEventTimeline)
+  bool fEventTimelineEnabled{false};
+  RTEventTimeline fEventTimeline{};
+
+  // silence skip (enabled with enableSilenceSkip)
+  bool fSilenceSkipEnabled{false};
+  uint64 fSilentSampleCount{}; // number of (contiguous) silent input samples processed
+  uint64 fSkippedBlockCount{};
+
+  // latency (see addLatencyComponent)
+  RTLatency fLatency{};
+  std::atomic<uint32> fReportedLatency{0}; // last value returned to the host
+  uint32 fNotifiedLatency{0}; // last value notified to the controller (UI thread only)
+
+  // bypass (enabled with enableBypass)
+  std::optional<RTVstParam<bool>> fBypassParam{};
+  RTBypass fBypass{};
+  int32 fBypassMaxLatency{};
+
+  // offline block accumulation (enabled with enableOfflineBlockAccumulation)
+  int32 fOfflineBlockSize{};
+  RTLatency::ComponentID fOfflineBlockLatency{-1};
+  RTBlockAccumulator fBlockAccumulator{};
+
 #ifdef JAMBA_DEBUG_LOGGING
   int32 fSymbolicSampleSize = -1;
+
+  // whether this processor holds a reference on the RT logger background thread (see initialize/terminate)
+  bool fRTLoggerAcquired{false};
 #endif
 };
 
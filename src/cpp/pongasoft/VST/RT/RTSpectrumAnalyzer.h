@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pongasoft/Utils/Collection/SPSCRingBuffer.h>
+#include <pongasoft/Utils/FFT.h>
+#include <pongasoft/VST/AudioBuffer.h>
+#include <pongasoft/VST/Spectrum.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+/**
+ * Computes the spectrum of the audio processed by the plugin in order to display it in the UI, without ever running
+ * an FFT on the RT thread:
+ *
+ * - the RT thread only copies the samples into a lock free ring buffer per channel (`push`, see
+ *   `Utils::Collection::SPSCRingBuffer`), which never blocks nor allocates
+ * - a background thread (`start` / `stop`) wakes up `Config::fFramesPerSecond` times per second, computes one
+ *   (Hann windowed) FFT every `Config::fHopSize` samples (see `Utils::RealFFT`), smooths the magnitudes and hands the
+ *   resulting `Spectrum` to the callback (a tick during which nothing was pushed, ex: transport stopped or plugin
+ *   bypassed, is skipped after checking the ring buffers, so that an idle analyzer costs close to nothing)
+ *
+ * The callback is invoked from the background thread. The usual way to get the spectrum to the UI is to broadcast it
+ * with a Jmb parameter (`JmbParam<Spectrum>` using `SpectrumParamSerializer`) which then shows up as a
+ * `GUIJmbParam<Spectrum>` for the views to draw (the analyzer is the only producer of the parameter):
+ *
+ * ```
+ * // setActive (true)
+ * fSpectrumAnalyzer.setup({}, 2, processSetup.sampleRate);
+ * fSpectrumAnalyzer.setCallback([this](Spectrum const &s) { fState.fSpectrum.broadcast(s); });
+ * fSpectrumAnalyzer.start();
+ *
+ * // processInputs32Bits
+ * fSpectrumAnalyzer.push(out);
+ *
+ * // setActive (false)
+ * fSpectrumAnalyzer.stop();
+ * ```
+ *
+ * If the background thread falls behind (ex: the machine is overloaded), the oldest samples are skipped (the UI only
+ * cares about the most recent spectrum) which guarantees that the cost of the analysis per tick is bounded.
+ * `getStats` reports the time spent analyzing (which is the CPU cost of the analysis) and the number of FFTs
+ * computed. */
+class RTSpectrumAnalyzer
+{
+public:
+  struct Config
+  {
+    int32 fFFTSize{2048};        // rounded up to a power of 2
+    int32 fHopSize{512};         // number of samples between 2 FFTs (clamped to [1, fFFTSize])
+    int32 fFramesPerSecond{30};  // how many times per second the spectrum is delivered (at most)
+    float fSmoothing{0.5f};      // [0, 1) (0 => no smoothing, the closer to 1 the slower the decay)
+    float fMinDb{-120.0f};       // floor of the magnitudes
+  };
+
+  struct Stats
+  {
+    uint64 fFFTCount{};         // number of FFTs computed (all channels)
+    uint64 fFrameCount{};       // number of spectrums delivered
+    uint64 fDroppedSamples{};   // number of samples skipped because the analysis fell behind
+    uint64 fIdleCount{};        // number of calls to analyze skipped because nothing was pushed
+    double fAnalysisSeconds{};  // time spent analyzing
+  };
+
+  using Callback = std::function<void(Spectrum const &)>;
+
+public:
+  RTSpectrumAnalyzer() = default;
+
+  // Destructor => stops the background thread
+  ~RTSpectrumAnalyzer() { stop(); }
+
+  RTSpectrumAnalyzer(RTSpectrumAnalyzer const &) = delete;
+  RTSpectrumAnalyzer &operator=(RTSpectrumAnalyzer const &) = delete;
+
+  /**
+   * Allocates the buffers. Stops the background thread if it is running. Not meant to be called from the RT thread. */
+  void setup(Config const &iConfig, int32 iNumChannels, double iSampleRate)
+  {
+    stop();
+
+    fFFT = std::make_unique<Utils::RealFFT<float>>(iConfig.fFFTSize);
+    auto fftSize = fFFT->getSize();
+
+    fConfig = iConfig;
+    fConfig.fFFTSize = fftSize;
+    fConfig.fHopSize = std::clamp(iConfig.fHopSize, 1, fftSize);
+    fConfig.fFramesPerSecond = std::max(iConfig.fFramesPerSecond, 1);
+    fConfig.fSmoothing = std::clamp(iConfig.fSmoothing, 0.0f, 0.99f);
+
+    // the (at most) number of samples analyzed per tick: twice the number of samples produced per tick gives the
+    // background thread some slack, anything older than that is skipped
+    auto samplesPerTick = static_cast<int32>(std::max(iSampleRate, 0.0) / fConfig.fFramesPerSecond);
+    fMaxSamplesPerTick = std::max(fftSize, 2 * samplesPerTick);
+
+    fWindow.resize(fftSize);
+    fWindowScale = 2.0f / Utils::RealFFT<float>::hannWindow(fWindow.data(), fftSize);
+    fWindowed.resize(fftSize);
+    fReal.resize(fFFT->getNumBins());
+    fImag.resize(fFFT->getNumBins());
+    fScratch.resize(fMaxSamplesPerTick);
+
+    fChannels.clear();
+    fChannels.reserve(std::max(iNumChannels, 0));
+    for(int32 c = 0; c < iNumChannels; c++)
+    {
+      auto &channel = fChannels.emplace_back();
+      channel.fRing = std::make_unique<Utils::Collection::SPSCRingBuffer<float>>(2 * fMaxSamplesPerTick);
+      channel.fHistory.resize(fftSize);
+      channel.fMagnitudes.resize(fFFT->getNumBins());
+    }
+
+    fSpectrum.resize(iNumChannels, fFFT->getNumBins());
+    fSpectrum.fSampleRate = iSampleRate;
+    std::fill(fSpectrum.fMagnitudes.begin(), fSpectrum.fMagnitudes.end(), fConfig.fMinDb);
+
+    fStats = {};
+  }
+
+  /**
+   * The callback invoked (from the background thread) every time a new spectrum is available. Must be set while the
+   * background thread is not running. */
+  void setCallback(Callback iCallback) { fCallback = std::move(iCallback); }
+
+  // getConfig (the actual values after rounding/clamping)
+  inline Config const &getConfig() const { return fConfig; }
+
+  // getNumChannels
+  inline int32 getNumChannels() const { return static_cast<int32>(fChannels.size()); }
+
+  // getNumBins
+  inline int32 getNumBins() const { return fSpectrum.fNumBins; }
+
+  //------------------------------------------------------------------------------------------------------------
+  // RT thread
+  //------------------------------------------------------------------------------------------------------------
+
+  /**
+   * Copies the samples of each channel (the channels beyond `getNumChannels()` are ignored). Lock free and never
+   * allocates. */
+  template<typename SampleType>
+  void push(AudioBuffers<SampleType> const &iBuffers)
+  {
+    auto numChannels = std::min(iBuffers.getNumChannels(), getNumChannels());
+    auto buffers = iBuffers.getBuffer();
+    for(int32 c = 0; c < numChannels; c++)
+      push(c, buffers[c], iBuffers.getNumSamples());
+  }
+
+  /**
+   * Copies the samples of one channel. Lock free and never allocates. */
+  void push(int32 iChannel, Sample32 const *iSamples, int32 iNumSamples)
+  {
+    if(iChannel < 0 || iChannel >= getNumChannels() || !iSamples || iNumSamples <= 0)
+      return;
+    fChannels[iChannel].fRing->write(iSamples, static_cast<size_t>(iNumSamples));
+  }
+
+  /**
+   * Copies the samples of one channel (converted to 32 bits, the precision of the analysis). Lock free and never
+   * allocates. */
+  void push(int32 iChannel, Sample64 const *iSamples, int32 iNumSamples)
+  {
+    constexpr int32 kChunkSize = 256;
+    Sample32 chunk[kChunkSize];
+
+    while(iNumSamples > 0)
+    {
+      auto count = std::min(iNumSamples, kChunkSize);
+      for(int32 i = 0; i < count; i++)
+        chunk[i] = static_cast<Sample32>(iSamples[i]);
+      push(iChannel, chunk, count);
+      iSamples += count;
+      iNumSamples -= count;
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------
+  // Background thread
+  //------------------------------------------------------------------------------------------------------------
+
+  /**
+   * Starts the background thread which calls `analyze` `Config::fFramesPerSecond` times per second (does nothing if
+   * already running). */
+  void start()
+  {
+    if(fThread.joinable() || !fFFT)
+      return;
+
+    fStopRequested = false;
+    fThread = std::thread{[this] { run(); }};
+  }
+
+  /**
+   * Stops (and joins) the background thread (does nothing if not running) */
+  void stop()
+  {
+    if(!fThread.joinable())
+      return;
+
+    {
+      std::lock_guard<std::mutex> lock{fMutex};
+      fStopRequested = true;
+    }
+    fCondition.notify_all();
+    fThread.join();
+  }
+
+  // isRunning
+  inline bool isRunning() const { return fThread.joinable(); }
+
+  /**
+   * Analyzes the samples pushed since the last call: computes one FFT per channel every `Config::fHopSize` samples
+   * and, if at least one was computed, delivers the (smoothed) spectrum to the callback. This is what the background
+   * thread does on every tick, and it can be called directly when the background thread is not running (ex: offline
+   * rendering or tests). Returns immediately when nothing was pushed since the last call.
+   *
+   * @return `true` if a new spectrum was delivered */
+  bool analyze()
+  {
+    if(!fFFT)
+      return false;
+
+    // nothing pushed since the last call => no need to time or touch any of the work buffers
+    if(!hasPendingSamples())
+    {
+      fStats.fIdleCount++;
+      return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    bool newSpectrum = false;
+    for(auto &channel: fChannels)
+    {
+      // readLatest skips the samples that do not fit (the ones overwritten by the producer being lost anyway)
+      auto count = channel.fRing->readLatest(fScratch.data(), fScratch.size());
+      auto consumed = channel.fRing->getConsumedCount();
+      fStats.fDroppedSamples += consumed - channel.fConsumedCount - count;
+      channel.fConsumedCount = consumed;
+
+      newSpectrum |= consume(channel, fScratch.data(), static_cast<int32>(count));
+    }
+
+    if(newSpectrum)
+    {
+      auto minMagnitude = std::pow(10.0f, fConfig.fMinDb / 20.0f);
+      auto numBins = fSpectrum.fNumBins;
+      for(int32 c = 0; c < getNumChannels(); c++)
+      {
+        auto magnitudes = fChannels[c].fMagnitudes.data();
+        auto db = fSpectrum.getChannel(c);
+        for(int32 k = 0; k < numBins; k++)
+          db[k] = 20.0f * std::log10(std::max(magnitudes[k], minMagnitude));
+      }
+
+      fStats.fFrameCount++;
+      if(fCallback)
+        fCallback(fSpectrum);
+    }
+
+    fStats.fAnalysisSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return newSpectrum;
+  }
+
+  /**
+   * @return the last spectrum computed (only safe to call from the background thread or when it is not running) */
+  inline Spectrum const &getSpectrum() const { return fSpectrum; }
+
+  /**
+   * @return the stats (only safe to call from the background thread or when it is not running) */
+  inline Stats const &getStats() const { return fStats; }
+
+  // resetStats
+  inline void resetStats() { fStats = {}; }
+
+private:
+  struct Channel
+  {
+    std::unique_ptr<Utils::Collection::SPSCRingBuffer<float>> fRing{};
+    std::vector<float> fHistory{};     // the last fFFTSize samples (oldest first)
+    int32 fHopFill{};                  // number of samples received since the last FFT
+    std::vector<float> fMagnitudes{};  // smoothed (linear) magnitudes
+    uint64 fConsumedCount{};           // to compute the number of samples dropped
+  };
+
+  // hasPendingSamples
+  bool hasPendingSamples() const
+  {
+    return std::any_of(fChannels.begin(), fChannels.end(),
+                       [](auto const &channel) { return channel.fRing->getReadableCount() > 0; });
+  }
+
+  // consume => returns true if at least one FFT was computed
+  bool consume(Channel &ioChannel, float const *iSamples, int32 iNumSamples)
+  {
+    auto const fftSize = fConfig.fFFTSize;
+    auto history = ioChannel.fHistory.data();
+
+    bool computed = false;
+    int32 offset = 0;
+    while(offset < iNumSamples)
+    {
+      // never more than a hop (<= fftSize) at a time
+      auto count = std::min(iNumSamples - offset, fConfig.fHopSize - ioChannel.fHopFill);
+      std::memmove(history, history + count, (fftSize - count) * sizeof(float));
+      std::memcpy(history + fftSize - count, iSamples + offset, count * sizeof(float));
+
+      offset += count;
+      ioChannel.fHopFill += count;
+
+      if(ioChannel.fHopFill == fConfig.fHopSize)
+      {
+        ioChannel.fHopFill = 0;
+        computeMagnitudes(ioChannel);
+        computed = true;
+      }
+    }
+
+    return computed;
+  }
+
+  // computeMagnitudes
+  void computeMagnitudes(Channel &ioChannel)
+  {
+    auto const fftSize = fConfig.fFFTSize;
+    auto const numBins = fFFT->getNumBins();
+
+    auto history = ioChannel.fHistory.data();
+    auto window = fWindow.data();
+    auto windowed = fWindowed.data();
+    for(int32 i = 0; i < fftSize; i++)
+      windowed[i] = history[i] * window[i];
+
+    fFFT->forward(windowed, fReal.data(), fImag.data());
+
+    auto re = fReal.data();
+    auto im = fImag.data();
+    auto magnitudes = ioChannel.fMagnitudes.data();
+    auto const smoothing = fConfig.fSmoothing;
+    auto const scale = fWindowScale * (1.0f - smoothing);
+    for(int32 k = 0; k < numBins; k++)
+      magnitudes[k] = magnitudes[k] * smoothing + std::sqrt(re[k] * re[k] + im[k] * im[k]) * scale;
+
+    fStats.fFFTCount++;
+  }
+
+  // run (background thread)
+  void run()
+  {
+    auto period = std::chrono::microseconds{1000000 / fConfig.fFramesPerSecond};
+
+    std::unique_lock<std::mutex> lock{fMutex};
+    while(!fStopRequested)
+    {
+      lock.unlock();
+      analyze();
+      lock.lock();
+      fCondition.wait_for(lock, period, [this] { return fStopRequested; });
+    }
+  }
+
+private:
+  Config fConfig{};
+  Callback fCallback{};
+
+  std::unique_ptr<Utils::RealFFT<float>> fFFT{};
+  std::vector<float> fWindow{};
+  float fWindowScale{1.0f};  // so that a full scale sine is 0dB
+  int32 fMaxSamplesPerTick{};
+
+  std::vector<Channel> fChannels{};
+
+  // work buffers (background thread)
+  std::vector<float> fScratch{};
+  std::vector<float> fWindowed{};
+  std::vector<float> fReal{};
+  std::vector<float> fImag{};
+  Spectrum fSpectrum{};
+  Stats fStats{};
+
+  std::thread fThread{};
+  std::mutex fMutex{};
+  std::condition_variable fCondition{};
+  bool fStopRequested{false};
+};
+
+}
@@ -16,6 +16,7 @@
  * @author Yan Pujante
  */
 #include "RTState.h"
+#include "RTPresetBank.h"
 
 namespace pongasoft::VST::RT {
 
@@ -281,6 +282,47 @@ bool RTState::beforeProcessing()
     res |= onNewState(state);
   }
 
+  fSwitchedPreset = nullptr;
+
+  if(fPresetBank)
+  {
+    auto preset = fPresetBank->beforeProcessing();
+    if(preset)
+    {
+      fSwitchedPreset = preset;
+      res |= onNewState(preset);
+    }
+  }
+
+  return res;
+}
+
+//------------------------------------------------------------------------
+// RTState::addPresetChangesToOutput
+//------------------------------------------------------------------------
+tresult RTState::addPresetChangesToOutput(ProcessData &oData)
+{
+  auto preset = fSwitchedPreset;
+  fSwitchedPreset = nullptr;
+
+  if(!preset)
+    return kResultOk;
+
+  auto const &saveOrder = preset->fSaveOrder;
+
+  tresult res = kResultOk;
+
+  for(int i = 0; i < preset->getCount(); i++)
+  {
+    auto const &param = fVstParameters.at(saveOrder->fOrder[i]);
+    if(param->hasChanged())
+    {
+      auto paramRes = param->addToOutput(oData);
+      if(res == kResultOk)
+        res = paramRes;
+    }
+  }
+
   return res;
 }
 
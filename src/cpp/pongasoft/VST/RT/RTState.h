@@ -31,9 +31,11 @@
 
 namespace pongasoft {
 namespace VST {
-namespace Debug { class ParamDisplay; }
+namespace Debug { class ParamDisplay; class ParamSnapshot; }
 namespace RT {
 
+class RTPresetBank;
+
 using namespace Utils;
 
 /**
@@ -117,6 +119,14 @@ public:
    */
   virtual bool applyParameterChanges(IParameterChanges &inputParameterChanges);
 
+  /**
+   * Called by `RTProcessor::process` (after the parameter changes have been applied) to report to the host, through
+   * `ProcessData::outputParameterChanges`, the parameters modified by a preset switch which happened in
+   * `beforeProcessing`, so that the host (automation lanes) and the controller (and thus the UI) reflect the new
+   * preset. Does nothing if there was no switch in this frame.
+   */
+  virtual tresult addPresetChangesToOutput(ProcessData &oData);
+
   /**
    * This uses the same algorithm as when the param value is updated (implemented in applyParameterChanges) for
    * consistency. If the param changes more than once in a frame, only the last value is taken into account.
@@ -143,6 +153,28 @@ public:
    */
   virtual tresult writeLatestState(IBStreamer &oStreamer);
 
+  /**
+   * Attaches a preset bank to this state: `beforeProcessing` will then switch to the preset requested with
+   * `RTPresetBank::requestPresetChange` (after handling the state set by `setState`). The bank is not owned and must
+   * outlive this state (or be detached with `nullptr`). Should be called before processing starts. */
+  void setPresetBank(RTPresetBank *iPresetBank) { fPresetBank = iPresetBank; }
+
+  // getPresetBank
+  RTPresetBank *getPresetBank() const { return fPresetBank; }
+
+  /**
+   * @return the process mode (`kRealtime`, `kPrefetch` or `kOffline`) provided by the host in `setupProcessing` (see
+   *         `RTProcessor::onProcessModeChanged` to switch quality settings accordingly) */
+  int32 getProcessMode() const { return fProcessMode; }
+
+  /**
+   * @return true when the host is rendering offline (bounce/export), in which case the processing does not have
+   *         realtime constraints */
+  bool isOfflineProcessing() const { return fProcessMode == kOffline; }
+
+  // setProcessMode (called by RTProcessor::setupProcessing)
+  void setProcessMode(int32 iProcessMode) { fProcessMode = iProcessMode; }
+
   /**
    * @return true if messaging is enabled (which at this moment is whether any JmbParam was added) */
   bool isMessagingEnabled() const { return !fOutboundMessagingParameters.empty(); }
@@ -161,6 +193,7 @@ public:
 
   // gives access for debug
   friend class Debug::ParamDisplay;
+  friend class Debug::ParamSnapshot;
 
 protected:
   // the parameters
@@ -181,6 +214,15 @@ protected:
   // handles messages (receive messages)
   MessageHandler fMessageHandler{};
 
+  // optional preset bank (see setPresetBank)
+  RTPresetBank *fPresetBank{nullptr};
+
+  // the preset switched to in beforeProcessing (reported by addPresetChangesToOutput)
+  NormalizedState const *fSwitchedPreset{nullptr};
+
+  // the process mode (see getProcessMode)
+  int32 fProcessMode{kRealtime};
+
 protected:
   // add raw parameter to the structures
   tresult addRawParameter(std::unique_ptr<RTRawVstParameter> iParameter);
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pluginterfaces/vst/ivstevents.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace pongasoft::VST::RT {
+
+using namespace Steinberg;
+using namespace Steinberg::Vst;
+
+/**
+ * Policy used by `RTVoiceAllocator` when a note starts and all the voices are in use */
+enum class EVoiceStealingPolicy
+{
+  kNone,           // the new note is ignored
+  kOldest,         // the voice started first is stolen
+  kReleasedFirst,  // the oldest released voice (note off received) is stolen, or the oldest voice if none
+  kQuietest        // the voice with the lowest level (see `RTVoiceAllocator::setLevel`) is stolen
+};
+
+/**
+ * Default (empty) per voice data for `RTVoiceAllocator` */
+struct RTNoVoiceData {};
+
+/**
+ * Voice management for instrument plugins: a fixed pool of `MaxVoices` voices (no memory allocation ever happens
+ * after construction), assigned on note on and stolen according to a configurable policy when none is free.
+ *
+ * The state of the voices is kept as a structure of arrays (one array per property, indexed by voice) and the
+ * allocator maintains a dense list of the voices in use, so that the rendering code processes all the active voices
+ * in one tight loop. The plugin specific per voice state (oscillator phase, envelope...) should follow the same
+ * pattern (provided as `TVoiceData`, ex: `struct MyVoices { std::array<float, 64> fPhase; std::array<float, 64>
+ * fFrequency; }`, accessible with `data()`).
+ *
+ * A voice goes through 3 states: free => active (note on) => released (note off) => free. The allocator does not know
+ * when the sound of a released voice is over (release phase of the envelope), so the plugin must call `freeVoice()`
+ * when it is done.
+ *
+ * ```
+ * // in processInputs32Bits (RTProcessor subclass, with enableEventTimeline)
+ * getEventTimeline().forEachSubBlock(data.numSamples,
+ *                                    [&](int32 iStart, int32 iNumSamples) {
+ *                                      for(auto voice: fVoices.activeVoices())
+ *                                        render(voice, iStart, iNumSamples);
+ *                                      freeFinishedVoices(); // calls fVoices.freeVoice (see freeVoice)
+ *                                    },
+ *                                    [&](RTEventTimeline::Item const &iItem) {
+ *                                      if(iItem.isEvent())
+ *                                      {
+ *                                        auto res = fVoices.handleEvent(iItem.fEvent);
+ *                                        if(res.fType == NoteEvent::kNoteOn)
+ *                                          startVoice(res.fVoice, res.fStolen);
+ *                                      }
+ *                                    });
+ * ```
+ *
+ * \note This class is meant to be used from the RT thread only.
+ *
+ * @tparam MaxVoices the number of voices (polyphony)
+ * @tparam TVoiceData the plugin specific per voice state (should be a structure of arrays of size `MaxVoices`) */
+template<int32 MaxVoices, typename TVoiceData = RTNoVoiceData>
+class RTVoiceAllocator
+{
+  static_assert(MaxVoices > 0, "MaxVoices must be > 0");
+
+public:
+  using voice_t = int32;
+
+  static constexpr voice_t kNoVoice = -1;
+  static constexpr int32 kMaxVoices = MaxVoices;
+
+  enum class EVoiceStatus : uint8_t
+  {
+    kFree,
+    kActive,
+    kReleased
+  };
+
+  /**
+   * Result of `handleEvent` / `noteOn` / `noteOff` */
+  struct NoteEvent
+  {
+    enum Type
+    {
+      kIgnored, // not a note event or no voice matching
+      kNoteOn,
+      kNoteOff
+    };
+
+    Type fType{kIgnored};
+    voice_t fVoice{kNoVoice};
+    bool fStolen{}; // for kNoteOn: true if the voice was playing another note (which should be faded out quickly)
+  };
+
+  /**
+   * A view on the list of active (or released) voices, usable in a range for loop */
+  class ActiveVoices
+  {
+  public:
+    explicit ActiveVoices(RTVoiceAllocator const &iAllocator) : fAllocator{iAllocator} {}
+    inline voice_t const *begin() const { return fAllocator.fActive.data(); }
+    inline voice_t const *end() const { return fAllocator.fActive.data() + fAllocator.fActiveCount; }
+    inline int32 size() const { return fAllocator.fActiveCount; }
+  private:
+    RTVoiceAllocator const &fAllocator;
+  };
+
+public:
+  // Constructor
+  explicit RTVoiceAllocator(EVoiceStealingPolicy iPolicy = EVoiceStealingPolicy::kReleasedFirst) : fPolicy{iPolicy}
+  {
+    reset();
+  }
+
+  // setStealingPolicy
+  inline void setStealingPolicy(EVoiceStealingPolicy iPolicy) { fPolicy = iPolicy; }
+
+  // getStealingPolicy
+  inline EVoiceStealingPolicy getStealingPolicy() const { return fPolicy; }
+
+  /**
+   * When `true` (default), a note on for a note (channel/pitch) already playing reuses the same voice (instead of
+   * allocating a new one) */
+  inline void setRetrigger(bool iRetrigger) { fRetrigger = iRetrigger; }
+
+  /**
+   * Frees all the voices */
+  void reset()
+  {
+    fActiveCount = 0;
+    fFreeCount = MaxVoices;
+    for(voice_t v = 0; v < MaxVoices; v++)
+    {
+      // the first voice to be allocated is voice 0
+      fFree[v] = MaxVoices - 1 - v;
+      fStatus[v] = EVoiceStatus::kFree;
+      fActiveIndex[v] = -1;
+      fNoteId[v] = -1;
+      fLevel[v] = 0;
+    }
+  }
+
+  /**
+   * Handles a note on (velocity 0 is treated as a note off) or note off event. Other events are ignored. */
+  inline NoteEvent handleEvent(Event const &iEvent)
+  {
+    switch(iEvent.type)
+    {
+      case Event::kNoteOnEvent:
+        if(iEvent.noteOn.velocity <= 0)
+          return noteOff(iEvent.noteOn.channel, iEvent.noteOn.pitch, iEvent.noteOn.noteId);
+        return noteOn(iEvent.noteOn.channel, iEvent.noteOn.pitch, iEvent.noteOn.velocity, iEvent.noteOn.noteId);
+
+      case Event::kNoteOffEvent:
+        return noteOff(iEvent.noteOff.channel, iEvent.noteOff.pitch, iEvent.noteOff.noteId);
+
+      default:
+        return {};
+    }
+  }
+
+  /**
+   * Allocates (or steals) a voice for the note */
+  NoteEvent noteOn(int16 iChannel, int16 iPitch, float iVelocity, int32 iNoteId = -1)
+  {
+    NoteEvent res{NoteEvent::kNoteOn};
+
+    if(fRetrigger)
+      res.fVoice = findVoice(iChannel, iPitch, -1, false);
+
+    if(res.fVoice != kNoVoice)
+      res.fStolen = true;
+    else if(fFreeCount > 0)
+    {
+      res.fVoice = fFree[--fFreeCount];
+      fActiveIndex[res.fVoice] = fActiveCount;
+      fActive[fActiveCount++] = res.fVoice;
+    }
+    else
+    {
+      res.fVoice = findVoiceToSteal();
+      if(res.fVoice == kNoVoice)
+        return {};
+      res.fStolen = true;
+      fStolenCount++;
+    }
+
+    auto v = res.fVoice;
+    fStatus[v] = EVoiceStatus::kActive;
+    fChannel[v] = iChannel;
+    fPitch[v] = iPitch;
+    fVelocity[v] = iVelocity;
+    fNoteId[v] = iNoteId;
+    fAge[v] = fNextAge++;
+    fLevel[v] = iVelocity;
+
+    return res;
+  }
+
+  /**
+   * Releases the (active) voice playing the note: uses the note id if not -1, channel and pitch otherwise. */
+  NoteEvent noteOff(int16 iChannel, int16 iPitch, int32 iNoteId = -1)
+  {
+    auto v = findVoice(iChannel, iPitch, iNoteId, true);
+    if(v == kNoVoice)
+      return {};
+
+    fStatus[v] = EVoiceStatus::kReleased;
+    return {NoteEvent::kNoteOff, v, false};
+  }
+
+  /**
+   * Releases all the active voices */
+  void allNotesOff()
+  {
+    for(int32 i = 0; i < fActiveCount; i++)
+      fStatus[fActive[i]] = EVoiceStatus::kReleased;
+  }
+
+  /**
+   * Returns the voice to the pool (to be called by the plugin when the voice is done playing). The last voice of the
+   * active list is moved to the freed slot, so when freeing voices while iterating, iterate by index in reverse order:
+   *
+   * ```
+   * for(auto i = fVoices.getActiveVoiceCount() - 1; i >= 0; i--) { ... fVoices.freeVoice(fVoices.getActiveVoice(i)); }
+   * ``` */
+  void freeVoice(voice_t iVoice)
+  {
+    if(iVoice < 0 || iVoice >= MaxVoices || fStatus[iVoice] == EVoiceStatus::kFree)
+      return;
+
+    // swap with the last active voice to keep the list dense
+    auto index = fActiveIndex[iVoice];
+    auto last = fActive[--fActiveCount];
+    fActive[index] = last;
+    fActiveIndex[last] = index;
+
+    fActiveIndex[iVoice] = -1;
+    fStatus[iVoice] = EVoiceStatus::kFree;
+    fLevel[iVoice] = 0;
+    fFree[fFreeCount++] = iVoice;
+  }
+
+  /**
+   * @return the voices currently in use (active or released), in no particular order */
+  inline ActiveVoices activeVoices() const { return ActiveVoices{*this}; }
+
+  // getActiveVoiceCount
+  inline int32 getActiveVoiceCount() const { return fActiveCount; }
+
+  // getActiveVoice (0 <= iIndex < getActiveVoiceCount())
+  inline voice_t getActiveVoice(int32 iIndex) const { return fActive[iIndex]; }
+
+  // getStatus
+  inline EVoiceStatus getStatus(voice_t iVoice) const { return fStatus[iVoice]; }
+
+  // isReleased
+  inline bool isReleased(voice_t iVoice) const { return fStatus[iVoice] == EVoiceStatus::kReleased; }
+
+  // getPitch
+  inline int16 getPitch(voice_t iVoice) const { return fPitch[iVoice]; }
+
+  // getChannel
+  inline int16 getChannel(voice_t iVoice) const { return fChannel[iVoice]; }
+
+  // getVelocity
+  inline float getVelocity(voice_t iVoice) const { return fVelocity[iVoice]; }
+
+  // getNoteId
+  inline int32 getNoteId(voice_t iVoice) const { return fNoteId[iVoice]; }
+
+  /**
+   * Sets the current level of the voice (ex: envelope output) used by `EVoiceStealingPolicy::kQuietest` (defaults to
+   * the velocity) */
+  inline void setLevel(voice_t iVoice, float iLevel) { fLevel[iVoice] = iLevel; }
+
+  // getLevel
+  inline float getLevel(voice_t iVoice) const { return fLevel[iVoice]; }
+
+  // getStolenCount (number of voices stolen since creation)
+  inline uint64_t getStolenCount() const { return fStolenCount; }
+
+  // data (plugin specific per voice data)
+  inline TVoiceData &data() { return fData; }
+  inline TVoiceData const &data() const { return fData; }
+
+private:
+  // findVoice (iActiveOnly => ignores released voices)
+  voice_t findVoice(int16 iChannel, int16 iPitch, int32 iNoteId, bool iActiveOnly) const
+  {
+    voice_t res = kNoVoice;
+    for(int32 i = 0; i < fActiveCount; i++)
+    {
+      auto v = fActive[i];
+      if(iActiveOnly && fStatus[v] != EVoiceStatus::kActive)
+        continue;
+      bool match = iNoteId != -1 ? fNoteId[v] == iNoteId : (fChannel[v] == iChannel && fPitch[v] == iPitch);
+      // oldest matching voice
+      if(match && (res == kNoVoice || fAge[v] < fAge[res]))
+        res = v;
+    }
+    return res;
+  }
+
+  // findVoiceToSteal
+  voice_t findVoiceToSteal() const
+  {
+    voice_t res = kNoVoice;
+
+    switch(fPolicy)
+    {
+      case EVoiceStealingPolicy::kNone:
+        break;
+
+      case EVoiceStealingPolicy::kOldest:
+        for(int32 i = 0; i < fActiveCount; i++)
+        {
+          auto v = fActive[i];
+          if(res == kNoVoice || fAge[v] < fAge[res])
+            res = v;
+        }
+        break;
+
+      case EVoiceStealingPolicy::kReleasedFirst:
+        for(int32 i = 0; i < fActiveCount; i++)
+        {
+          auto v = fActive[i];
+          if(res == kNoVoice)
+            res = v;
+          else
+          {
+            auto released = fStatus[v] == EVoiceStatus::kReleased;
+            auto resReleased = fStatus[res] == EVoiceStatus::kReleased;
+            if((released && !resReleased) || (released == resReleased && fAge[v] < fAge[res]))
+              res = v;
+          }
+        }
+        break;
+
+      case EVoiceStealingPolicy::kQuietest:
+        for(int32 i = 0; i < fActiveCount; i++)
+        {
+          auto v = fActive[i];
+          if(res == kNoVoice || fLevel[v] < fLevel[res] || (fLevel[v] == fLevel[res] && fAge[v] < fAge[res]))
+            res = v;
+        }
+        break;
+    }
+
+    return res;
+  }
+
+private:
+  EVoiceStealingPolicy fPolicy;
+  bool fRetrigger{true};
+  uint64_t fNextAge{};
+  uint64_t fStolenCount{};
+
+  // dense list of voices in use (fActiveIndex[v] is the position of v in fActive)
+  std::array<voice_t, MaxVoices> fActive{};
+  std::array<int32, MaxVoices> fActiveIndex{};
+  int32 fActiveCount{};
+
+  // stack of free voices
+  std::array<voice_t, MaxVoices> fFree{};
+  int32 fFreeCount{};
+
+  // per voice state (structure of arrays)
+  std::array<EVoiceStatus, MaxVoices> fStatus{};
+  std::array<int16, MaxVoices> fChannel{};
+  std::array<int16, MaxVoices> fPitch{};
+  std::array<float, MaxVoices> fVelocity{};
+  std::array<int32, MaxVoices> fNoteId{};
+  std::array<uint64_t, MaxVoices> fAge{};
+  std::array<float, MaxVoices> fLevel{};
+
+  TVoiceData fData{};
+};
+
+}
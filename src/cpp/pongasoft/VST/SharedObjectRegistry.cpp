@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "SharedObjectRegistry.h"
+
+#include <chrono>
+#include <random>
+
+namespace pongasoft::VST {
+
+namespace impl {
+
+// computeProcessToken (random so that 2 processes cannot end up with the same token)
+uint64 computeProcessToken()
+{
+  std::random_device rd{};
+  uint64 token = (static_cast<uint64>(rd()) << 32) ^ static_cast<uint64>(rd());
+  token ^= static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+  token ^= static_cast<uint64>(reinterpret_cast<uintptr_t>(&token));
+  return token == 0 ? 1 : token;
+}
+
+}
+
+//------------------------------------------------------------------------
+// SharedObjectRegistry::getProcessToken
+//------------------------------------------------------------------------
+uint64 SharedObjectRegistry::getProcessToken()
+{
+  static const uint64 kProcessToken = impl::computeProcessToken();
+  return kProcessToken;
+}
+
+//------------------------------------------------------------------------
+// SharedObjectRegistry::instance
+//------------------------------------------------------------------------
+SharedObjectRegistry &SharedObjectRegistry::instance()
+{
+  static SharedObjectRegistry kInstance{};
+  return kInstance;
+}
+
+//------------------------------------------------------------------------
+// SharedObjectRegistry::doShare
+//------------------------------------------------------------------------
+SharedObjectHandle SharedObjectRegistry::doShare(std::shared_ptr<void> iObject, std::type_index iType)
+{
+  if(!iObject)
+    return {};
+
+  std::lock_guard<std::mutex> lock{fMutex};
+
+  // purge the objects which do not exist anymore
+  for(auto iter = fEntries.begin(); iter != fEntries.end();)
+  {
+    if(iter->second.fObject.expired())
+      iter = fEntries.erase(iter);
+    else
+      ++iter;
+  }
+
+  auto id = ++fLastObjectID;
+  fEntries.emplace(id, Entry{iObject, iType});
+  return {getProcessToken(), id};
+}
+
+//------------------------------------------------------------------------
+// SharedObjectRegistry::doFind
+//------------------------------------------------------------------------
+std::shared_ptr<void> SharedObjectRegistry::doFind(SharedObjectHandle const &iHandle, std::type_index iType)
+{
+  // handle coming from another process
+  if(!iHandle.isValid() || iHandle.fProcessToken != getProcessToken())
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock{fMutex};
+
+  auto iter = fEntries.find(iHandle.fObjectID);
+  if(iter == fEntries.end() || iter->second.fType != iType)
+    return nullptr;
+
+  return iter->second.fObject.lock();
+}
+
+//------------------------------------------------------------------------
+// SharedObjectRegistry::doUnshare
+//------------------------------------------------------------------------
+void SharedObjectRegistry::doUnshare(SharedObjectHandle const &iHandle)
+{
+  if(iHandle.fProcessToken != getProcessToken())
+    return;
+
+  std::lock_guard<std::mutex> lock{fMutex};
+  fEntries.erase(iHandle.fObjectID);
+}
+
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "ParamSerializers.h"
+
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace pongasoft::VST {
+
+/**
+ * Identifies an object shared with `SharedObjectRegistry::share`. It is a plain value which can be sent from the RT
+ * to the GUI like any other jamba parameter (see `SharedObjectHandleParamSerializer`). */
+struct SharedObjectHandle
+{
+  uint64 fProcessToken{0};
+  uint64 fObjectID{0};
+
+  // isValid
+  inline bool isValid() const { return fObjectID != 0; }
+
+  inline bool operator==(SharedObjectHandle const &rhs) const
+  {
+    return fProcessToken == rhs.fProcessToken && fObjectID == rhs.fObjectID;
+  }
+
+  inline bool operator!=(SharedObjectHandle const &rhs) const { return !(*this == rhs); }
+
+  friend std::ostream &operator<<(std::ostream &oStream, SharedObjectHandle const &iHandle)
+  {
+    return oStream << iHandle.fProcessToken << "/" << iHandle.fObjectID;
+  }
+};
+
+/**
+ * The VST3 architecture lets the host run the RT (processor) and GUI (controller) in different processes, which is why
+ * everything they exchange goes through (serialized) messages. Most hosts run them in the same process though, and
+ * some data (like a continuous stream of samples for a scope) is too expensive to serialize. This registry lets the RT
+ * share an object (like a `Utils::Collection::SPSCRingBuffer`) with the GUI *when they live in the same process*:
+ *
+ * - the RT shares the object and sends the handle to the GUI (as a regular jamba parameter)
+ * - the GUI calls `find` with the handle it received, which returns `nullptr` when the GUI lives in a different
+ *   process (the handle contains a token unique to the process), in which case it falls back to messaging
+ *
+ * ```
+ * // Parameters (RT -> GUI)
+ * fScopeHandleParam = jmb<SharedObjectHandleParamSerializer>(EParamID::kScopeHandle, STR16("Scope"))
+ *                       .rtOwned().shared().transient().add();
+ *
+ * // RTProcessor::setupProcessing (RTState holds the shared_ptr, the registry only holds a weak reference)
+ * fState.fScope = std::make_shared<SPSCRingBuffer<float>>(16384);
+ * fState.fScopeHandle.broadcast(SharedObjectRegistry::share(fState.fScope));
+ *
+ * // GUI (ex: in the view, when the parameter changes)
+ * fScope = SharedObjectRegistry::find<SPSCRingBuffer<float>>(*fScopeHandleParam);
+ * ```
+ *
+ * The registry only holds weak references: the object lives as long as the RT (and the GUI if it kept the
+ * `shared_ptr` returned by `find`) holds on to it. All methods are thread safe but use a lock and allocate memory, so
+ * they must not be called from the processing thread (`setupProcessing` or `setActive` are fine). */
+class SharedObjectRegistry
+{
+public:
+  /**
+   * Shares the object
+   *
+   * @return the handle to provide to `find` */
+  template<typename T>
+  static SharedObjectHandle share(std::shared_ptr<T> const &iObject)
+  {
+    return instance().doShare(std::static_pointer_cast<void>(std::const_pointer_cast<std::remove_const_t<T>>(iObject)),
+                              typeid(std::remove_const_t<T>));
+  }
+
+  /**
+   * @return the object shared with `share` or `nullptr` if the handle comes from another process, the object does not
+   *         exist anymore, or it is not a `T` */
+  template<typename T>
+  static std::shared_ptr<T> find(SharedObjectHandle const &iHandle)
+  {
+    return std::static_pointer_cast<T>(instance().doFind(iHandle, typeid(std::remove_const_t<T>)));
+  }
+
+  /**
+   * Stops sharing the object (`find` returns `nullptr` from now on) */
+  static void unshare(SharedObjectHandle const &iHandle) { instance().doUnshare(iHandle); }
+
+  //! A token unique to this process (part of every handle)
+  static uint64 getProcessToken();
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<void> fObject;
+    std::type_index fType;
+  };
+
+  static SharedObjectRegistry &instance();
+
+  SharedObjectHandle doShare(std::shared_ptr<void> iObject, std::type_index iType);
+  std::shared_ptr<void> doFind(SharedObjectHandle const &iHandle, std::type_index iType);
+  void doUnshare(SharedObjectHandle const &iHandle);
+
+private:
+  std::mutex fMutex{};
+  uint64 fLastObjectID{0};
+  std::unordered_map<uint64, Entry> fEntries{};
+};
+
+/**
+ * Serializer for `SharedObjectHandle` (so that a handle can be sent from the RT to the GUI) */
+class SharedObjectHandleParamSerializer : public IParamSerializer<SharedObjectHandle>
+{
+public:
+  tresult readFromStream(IBStreamer &iStreamer, ParamType &oValue) const override
+  {
+    ParamType value{};
+    if(IBStreamHelper::readInt64u(iStreamer, value.fProcessToken) == kResultOk &&
+       IBStreamHelper::readInt64u(iStreamer, value.fObjectID) == kResultOk)
+    {
+      oValue = value;
+      return kResultOk;
+    }
+    return kResultFalse;
+  }
+
+  tresult writeToStream(const ParamType &iValue, IBStreamer &oStreamer) const override
+  {
+    if(oStreamer.writeInt64u(iValue.fProcessToken) && oStreamer.writeInt64u(iValue.fObjectID))
+      return kResultOk;
+    return kResultFalse;
+  }
+};
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "ParamSerializers.h"
+
+#include <vector>
+
+namespace pongasoft::VST {
+
+/**
+ * The result of a spectrum analysis (see `RT::RTSpectrumAnalyzer`): the magnitude (in dB, `0` being a full scale sine)
+ * of `fNumBins` bins (from DC to Nyquist) per channel.
+ *
+ * The magnitudes are stored channel after channel (`fMagnitudes[channel * fNumBins + bin]`) in a single vector so
+ * that copying a spectrum (which is what delivering it to the UI does) is one allocation at most. */
+struct Spectrum
+{
+  int32 fNumChannels{};
+  int32 fNumBins{};
+  double fSampleRate{};
+  std::vector<float> fMagnitudes{};
+
+  // resize (does not allocate if the size does not change)
+  void resize(int32 iNumChannels, int32 iNumBins)
+  {
+    fNumChannels = iNumChannels;
+    fNumBins = iNumBins;
+    fMagnitudes.resize(static_cast<size_t>(iNumChannels) * static_cast<size_t>(iNumBins));
+  }
+
+  // getChannel (`fNumBins` magnitudes in dB)
+  inline float const *getChannel(int32 iChannel) const { return fMagnitudes.data() + iChannel * fNumBins; }
+  inline float *getChannel(int32 iChannel) { return fMagnitudes.data() + iChannel * fNumBins; }
+
+  /**
+   * @return the frequency (in Hz) at the center of the bin */
+  inline double getFrequency(int32 iBin) const
+  {
+    return fNumBins > 1 ? iBin * fSampleRate / (2.0 * (fNumBins - 1)) : 0;
+  }
+
+  bool operator==(Spectrum const &rhs) const
+  {
+    return fNumChannels == rhs.fNumChannels &&
+           fNumBins == rhs.fNumBins &&
+           fSampleRate == rhs.fSampleRate &&
+           fMagnitudes == rhs.fMagnitudes;
+  }
+
+  bool operator!=(Spectrum const &rhs) const { return !(rhs == *this); }
+};
+
+/**
+ * Serializer for `Spectrum` so that it can be used as a Jmb parameter (`JmbParam<Spectrum>`), which is how it is sent
+ * from the RT to the UI (`RTJmbOutParam<Spectrum>::broadcast` => `GUIJmbParam<Spectrum>`). */
+class SpectrumParamSerializer : public IParamSerializer<Spectrum>
+{
+public:
+  //! Maximum number of values accepted when reading (protects against corrupted messages)
+  static constexpr int32 kMaxValues = 1 << 20;
+
+  tresult readFromStream(IBStreamer &iStreamer, ParamType &oValue) const override
+  {
+    int32 numChannels{}, numBins{};
+    double sampleRate{};
+
+    if(IBStreamHelper::readInt32(iStreamer, numChannels) != kResultOk ||
+       IBStreamHelper::readInt32(iStreamer, numBins) != kResultOk ||
+       IBStreamHelper::readDouble(iStreamer, sampleRate) != kResultOk)
+      return kResultFalse;
+
+    if(numChannels < 0 || numBins < 0 || (numBins > 0 && numChannels > kMaxValues / numBins))
+      return kResultFalse;
+
+    oValue.resize(numChannels, numBins);
+    oValue.fSampleRate = sampleRate;
+    return IBStreamHelper::readFloatArray(iStreamer, oValue.fMagnitudes.data(), oValue.fMagnitudes.size());
+  }
+
+  tresult writeToStream(const ParamType &iValue, IBStreamer &oStreamer) const override
+  {
+    oStreamer.writeInt32(iValue.fNumChannels);
+    oStreamer.writeInt32(iValue.fNumBins);
+    oStreamer.writeDouble(iValue.fSampleRate);
+    oStreamer.writeFloatArray(iValue.fMagnitudes.data(), static_cast<int32>(iValue.fMagnitudes.size()));
+    return kResultOk;
+  }
+};
+
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include "DataCacheManager.h"
+
+#include <pongasoft/logging/logging.h>
+
+#include <algorithm>
+
+namespace pongasoft::VST::VstUtils {
+
+//------------------------------------------------------------------------
+// DataCacheManager::~DataCacheManager
+//------------------------------------------------------------------------
+DataCacheManager::~DataCacheManager()
+{
+  fWorker.stop();
+  DCHECK_F(fCaches.empty(), "caches must be destroyed before their manager");
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::global
+//------------------------------------------------------------------------
+std::shared_ptr<DataCacheManager> const &DataCacheManager::global()
+{
+  static const auto kGlobal = std::make_shared<DataCacheManager>();
+  return kGlobal;
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::acquireGlobal
+//------------------------------------------------------------------------
+void DataCacheManager::acquireGlobal()
+{
+  fGlobalUserCount++;
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::releaseGlobal
+//------------------------------------------------------------------------
+void DataCacheManager::releaseGlobal()
+{
+  DCHECK_F(fGlobalUserCount > 0, "releaseGlobal called without acquireGlobal");
+  if(fGlobalUserCount == 0)
+    return;
+
+  if(--fGlobalUserCount == 0)
+    global()->shutdown();
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::shutdown
+//------------------------------------------------------------------------
+void DataCacheManager::shutdown()
+{
+  fWorker.stop();
+  fTimer = nullptr;
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::setMemoryBudgetInBytes
+//------------------------------------------------------------------------
+void DataCacheManager::setMemoryBudgetInBytes(size_t iMemoryBudgetInBytes)
+{
+  fMemoryBudgetInBytes = iMemoryBudgetInBytes;
+  enforceBudget();
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::registerCache
+//------------------------------------------------------------------------
+void DataCacheManager::registerCache(IManagedCache *iCache)
+{
+  DCHECK_F(iCache != nullptr);
+  fCaches.emplace_back(iCache);
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::unregisterCache
+//------------------------------------------------------------------------
+void DataCacheManager::unregisterCache(IManagedCache *iCache)
+{
+  fCaches.erase(std::remove(fCaches.begin(), fCaches.end(), iCache), fCaches.end());
+  if(fCaches.empty())
+    fTimer = nullptr;
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::onSizeChanged
+//------------------------------------------------------------------------
+void DataCacheManager::onSizeChanged(size_t iOldSizeInBytes, size_t iNewSizeInBytes)
+{
+  DCHECK_F(fSizeInBytes >= iOldSizeInBytes);
+
+  fSizeInBytes = fSizeInBytes - iOldSizeInBytes + iNewSizeInBytes;
+
+  if(iNewSizeInBytes > iOldSizeInBytes)
+    enforceBudget();
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::enforceBudget
+//------------------------------------------------------------------------
+void DataCacheManager::enforceBudget()
+{
+  if(fMemoryBudgetInBytes == 0)
+    return;
+
+  while(fSizeInBytes > fMemoryBudgetInBytes)
+  {
+    IManagedCache *lru = nullptr;
+    clock::time_point lruTime{};
+
+    for(auto cache: fCaches)
+    {
+      clock::time_point t;
+      if(cache->getLeastRecentlyUsed(t) && (!lru || t < lruTime))
+      {
+        lru = cache;
+        lruTime = t;
+      }
+    }
+
+    // nothing left to evict (the entry being added is larger than the budget on its own)
+    if(!lru)
+      break;
+
+    // evicting calls onSizeChanged (which does not recurse since the size is decreasing)
+    lru->evictLeastRecentlyUsed();
+    fBudgetEvictionCount++;
+  }
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::requestSweep
+//------------------------------------------------------------------------
+void DataCacheManager::requestSweep()
+{
+  if(!fTimer)
+    fTimer = AutoReleaseTimer::create(this, fSweepIntervalMilliseconds);
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::sweep
+//------------------------------------------------------------------------
+void DataCacheManager::sweep(clock::time_point iNow)
+{
+  size_t expiring = 0;
+
+  for(auto cache: fCaches)
+    expiring += cache->sweep(iNow);
+
+  // nothing can expire anymore => no need to keep the timer running
+  if(expiring == 0)
+    fTimer = nullptr;
+}
+
+//------------------------------------------------------------------------
+// DataCacheManager::onTimer
+//------------------------------------------------------------------------
+void DataCacheManager::onTimer(Timer * /* timer */)
+{
+  sweep(clock::now());
+}
+
+}
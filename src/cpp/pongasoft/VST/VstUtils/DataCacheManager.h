@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include <pongasoft/VST/Timer.h>
+#include <pongasoft/Utils/Concurrent/WorkerThread.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace pongasoft::VST::VstUtils {
+
+using namespace Steinberg;
+
+/**
+ * Shared by all the `LRUDataCache` instances that use it, this class:
+ *
+ * - enforces a global memory budget: when the total size of the data held by all the caches exceeds the budget, the
+ *   least recently used entry (across all caches) is evicted until the total fits
+ * - owns the single (shared) timer used to sweep the expired entries of all the caches (instead of one timer per
+ *   entry or per access). The timer only runs while at least one cache holds an entry with a TTL.
+ * - owns the (lazily started) background thread used by the caches configured for background loading
+ *
+ * Like `ExpiringDataCache`, this class is **not** thread safe and is meant to be used from the UI thread (event loop)
+ * only. `global()` returns a manager shared by the whole plugin (no budget), but you can create your own. Since
+ * `global()` is a static instance, its thread and timer must not outlive the plugin (stopping a thread or a platform
+ * timer during static destruction, at module unload, is not safe): `acquireGlobal` / `releaseGlobal` (reference
+ * counted, which `GUIController` calls in `initialize` / `terminate`) shut them down when the last controller goes
+ * away. */
+class DataCacheManager : ITimerCallback
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  // default interval at which expired entries are swept
+  static constexpr uint32 kDefaultSweepIntervalMilliseconds = 1000;
+
+  /**
+   * Interface implemented by the caches managed by this class */
+  class IManagedCache
+  {
+  public:
+    virtual ~IManagedCache() = default;
+
+    /**
+     * Removes the entries that have expired at `iNow`
+     *
+     * @return the number of entries still subject to expiration */
+    virtual size_t sweep(clock::time_point iNow) = 0;
+
+    /**
+     * @return `true` if the cache has an entry that can be evicted (in which case `oLastAccessTime` is set to the
+     *         last access time of its least recently used entry) */
+    virtual bool getLeastRecentlyUsed(clock::time_point &oLastAccessTime) const = 0;
+
+    /**
+     * Evicts the least recently used entry */
+    virtual void evictLeastRecentlyUsed() = 0;
+  };
+
+public:
+  /**
+   * @param iMemoryBudgetInBytes the maximum number of bytes held by all the caches (`0` means unlimited)
+   * @param iSweepIntervalMilliseconds how often expired entries are swept */
+  explicit DataCacheManager(size_t iMemoryBudgetInBytes = 0,
+                            uint32 iSweepIntervalMilliseconds = kDefaultSweepIntervalMilliseconds) :
+    fMemoryBudgetInBytes{iMemoryBudgetInBytes},
+    fSweepIntervalMilliseconds{iSweepIntervalMilliseconds}
+  {}
+
+  // Destructor
+  ~DataCacheManager() override;
+
+  DataCacheManager(DataCacheManager const &) = delete;
+  DataCacheManager &operator=(DataCacheManager const &) = delete;
+
+  //! The manager shared by the whole plugin (no memory budget)
+  static std::shared_ptr<DataCacheManager> const &global();
+
+  /**
+   * Declares a user of `global()` (for example a controller). Must be balanced by a call to `releaseGlobal`. */
+  static void acquireGlobal();
+
+  /**
+   * The last user of `global()` shuts it down (see `shutdown`) */
+  static void releaseGlobal();
+
+  // getGlobalUserCount
+  static int getGlobalUserCount() { return fGlobalUserCount; }
+
+  /**
+   * Executes the pending background jobs, stops the background thread and the timer. Both are restarted on demand
+   * (next background load / next entry with a TTL). */
+  void shutdown();
+
+  // getMemoryBudgetInBytes
+  size_t getMemoryBudgetInBytes() const { return fMemoryBudgetInBytes; }
+
+  //! Changes the memory budget (evicting entries right away if necessary)
+  void setMemoryBudgetInBytes(size_t iMemoryBudgetInBytes);
+
+  //! Total number of bytes currently held by all the caches
+  size_t getSizeInBytes() const { return fSizeInBytes; }
+
+  //! Number of entries evicted because of the memory budget (all caches)
+  uint64 getBudgetEvictionCount() const { return fBudgetEvictionCount; }
+
+  /**
+   * Sweeps the expired entries of all the caches. Called by the timer but can be called manually. */
+  void sweep(clock::time_point iNow = clock::now());
+
+  // isSweeping (whether the timer is running)
+  bool isSweeping() const { return fTimer != nullptr; }
+
+  //------------------------------------------------------------------------
+  // API used by the caches
+  //------------------------------------------------------------------------
+
+  // registerCache
+  void registerCache(IManagedCache *iCache);
+
+  // unregisterCache
+  void unregisterCache(IManagedCache *iCache);
+
+  /**
+   * Caches call this method when their size changes. When growing, entries get evicted (globally least recently
+   * used first) until the budget is met. */
+  void onSizeChanged(size_t iOldSizeInBytes, size_t iNewSizeInBytes);
+
+  /**
+   * Caches call this method when they hold entries that can expire (starts the shared timer if necessary) */
+  void requestSweep();
+
+  //! The worker used for background loading
+  Utils::Concurrent::WorkerThread &getWorker() { return fWorker; }
+
+private:
+  // Callback from the timer
+  void onTimer(Timer *timer) override;
+
+  // evicts entries until the budget is met
+  void enforceBudget();
+
+private:
+  size_t fMemoryBudgetInBytes;
+  uint32 fSweepIntervalMilliseconds;
+
+  std::vector<IManagedCache *> fCaches{};
+  size_t fSizeInBytes{0};
+  uint64 fBudgetEvictionCount{0};
+
+  std::unique_ptr<AutoReleaseTimer> fTimer{};
+
+  // last member => joined first in the destructor
+  Utils::Concurrent::WorkerThread fWorker{};
+
+  // number of users of global() (UI thread only)
+  static inline int fGlobalUserCount{0};
+};
+
+}
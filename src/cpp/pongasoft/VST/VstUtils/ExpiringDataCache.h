@@ -20,6 +20,7 @@
 #define JAMBA_EXPIRINGDATACACHE_H
 
 #include <pongasoft/VST/Timer.h>
+#include <chrono>
 #include <functional>
 
 #include <pongasoft/logging/logging.h>
@@ -35,6 +36,9 @@ using namespace Steinberg;
  * environment where the timer (`ITimerCallback::onTimer`) and caller (`ExpiringDataCache::getData`) are part of the
  * event loop and thus never called by 2 threads at the same time.
  *
+ * \note This class caches a single value. Check `LRUDataCache` for a cache supporting multiple keys, a memory budget
+ *       and background loading.
+ *
  * \note This class offers copy/move constructors and copy/move assignment operators but care must be taken that
  *       the `Loader` can safely be moved/copied if you use them. A **bad** example would be a lambda capturing `this`
  *
@@ -127,25 +131,40 @@ public:
   {
     if(fCachedData)
     {
-      // resets the timer
-      fTimer = AutoReleaseTimer::create(this, fTimeToLiveMilliseconds);
+      // extends the TTL (the timer is not reset on every access: onTimer checks the last access time instead)
+      fLastAccessTime = clock::now();
       return fCachedData;
     }
 
     fCachedData = fDataLoader ? fDataLoader() : nullptr;
 
     if(fCachedData)
+    {
+      fLastAccessTime = clock::now();
       fTimer = AutoReleaseTimer::create(this, fTimeToLiveMilliseconds);
+    }
 
     return fCachedData;
   }
 
 private:
-  // Callback when the timer expires => remove cached data
+  using clock = std::chrono::steady_clock;
+
+  // Callback when the timer expires => remove cached data unless it was accessed since the timer was created
   void onTimer(Timer *timer) override
   {
-    fCachedData = nullptr;
-    fTimer = nullptr;
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - fLastAccessTime).count();
+
+    if(elapsed >= fTimeToLiveMilliseconds)
+    {
+      fCachedData = nullptr;
+      fTimer = nullptr;
+    }
+    else
+    {
+      // accessed in the meantime => wait for the remaining time only (at most one timer per TTL period)
+      fTimer = AutoReleaseTimer::create(this, static_cast<uint32>(fTimeToLiveMilliseconds - elapsed));
+    }
   }
 
 private:
@@ -153,6 +172,7 @@ private:
   uint32 fTimeToLiveMilliseconds{};
 
   Ptr fCachedData{};
+  clock::time_point fLastAccessTime{};
   std::unique_ptr<AutoReleaseTimer> fTimer{};
 };
 
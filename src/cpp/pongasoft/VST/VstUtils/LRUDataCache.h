@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "DataCacheManager.h"
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace pongasoft::VST::VstUtils {
+
+/**
+ * A cache for data identified by a key (for example decoded waveforms or bitmaps) which supports:
+ *
+ * - many keys, with least recently used (LRU) eviction when the cache holds more than `Options::fMaxEntries` entries
+ * - an (optional) time to live: entries not accessed for `Options::fTimeToLiveMilliseconds` are discarded. Expiration
+ *   is handled by the single timer shared by all the caches of the same `DataCacheManager` (accessing an entry only
+ *   records the access time)
+ * - byte size accounting (`Sizer`): the `DataCacheManager` enforces a memory budget across all its caches
+ * - (optional) background loading: `prefetch` and `tryGetData` never block on the loader, which is then executed by
+ *   the background thread of the `DataCacheManager`
+ * - hit/miss/eviction/expiration statistics
+ *
+ * Like `ExpiringDataCache`, this class is **not** thread safe and is meant to be used from the UI thread (event loop):
+ * only the loader may be invoked from another thread (when using background loading, in which case it must be thread
+ * safe and must not capture `this`).
+ *
+ * ```
+ * // in the view (keeps up to 16 waveforms, each one for at most 5s after its last access)
+ * mutable LRUDataCache<int, Waveform> fWaveformCache{[storage](int const &iIndex) { return storage->load(iIndex); },
+ *                                                    {5000, 16},
+ *                                                    [](Waveform const &w) { return w.getSizeInBytes(); }};
+ *
+ * // in draw
+ * auto waveform = fWaveformCache.getData(index);
+ * ```
+ *
+ * @tparam Key the type of the key (must be hashable with `std::hash<Key>`)
+ * @tparam T the type of the data that is being cached
+ * @tparam Ptr the (optional) type for the pointer. By default it is `std::shared_ptr<T>`. */
+template<typename Key, typename T, typename Ptr = std::shared_ptr<T>>
+class LRUDataCache : DataCacheManager::IManagedCache
+{
+public:
+  using key_type = Key;
+  using value_type = T;
+  using pointer = Ptr;
+  using clock = DataCacheManager::clock;
+
+  //! Loads the data for a key (returning `nullptr` is allowed but the result is not cached)
+  using Loader = std::function<Ptr(Key const &)>;
+
+  //! Computes the size (in bytes) of the data (for memory budget accounting)
+  using Sizer = std::function<size_t(T const &)>;
+
+  struct Options
+  {
+    // entries not accessed for this duration are discarded (`0` means never)
+    uint32 fTimeToLiveMilliseconds{0};
+
+    // maximum number of entries (`0` means unlimited)
+    size_t fMaxEntries{0};
+
+    // whether the loader is executed in the background by `prefetch` and `tryGetData`
+    bool fBackgroundLoading{false};
+  };
+
+  struct Stats
+  {
+    uint64 fHits{0};
+    uint64 fMisses{0};
+    uint64 fEvictions{0};   // LRU (max entries) and memory budget
+    uint64 fExpirations{0}; // TTL
+  };
+
+public:
+  /**
+   * @param iLoader the loader
+   * @param iOptions the options (ttl, max entries, background loading)
+   * @param iSizer computes the size of the data (default to `sizeof(T)`)
+   * @param iManager the manager (budget and sweep timer) */
+  explicit LRUDataCache(Loader iLoader,
+                        Options iOptions = {},
+                        Sizer iSizer = {},
+                        std::shared_ptr<DataCacheManager> iManager = DataCacheManager::global()) :
+    fLoader{std::move(iLoader)},
+    fOptions{iOptions},
+    fSizer{iSizer ? std::move(iSizer) : Sizer{[](T const &) -> size_t { return sizeof(T); }}},
+    fManager{std::move(iManager)}
+  {
+    fManager->registerCache(this);
+  }
+
+  // Destructor
+  ~LRUDataCache() override
+  {
+    clear();
+    fManager->unregisterCache(this);
+  }
+
+  // the cache registers itself with the manager => no copy
+  LRUDataCache(LRUDataCache const &) = delete;
+  LRUDataCache &operator=(LRUDataCache const &) = delete;
+
+  /**
+   * Returns the data for the key: from the cache if present (which also marks it as the most recently used),
+   * otherwise from the loader (synchronously, even when background loading is enabled).
+   *
+   * @return the data (which can be `nullptr`) */
+  Ptr getData(Key const &iKey)
+  {
+    collectBackgroundLoads();
+
+    if(auto data = find(iKey))
+      return data;
+
+    fStats.fMisses++;
+    auto data = fLoader ? fLoader(iKey) : nullptr;
+    if(data)
+      insert(iKey, data);
+    return data;
+  }
+
+  /**
+   * Returns the data if it is in the cache, otherwise schedules a (background) load and returns `nullptr`. Never
+   * blocks on the loader when background loading is enabled (otherwise it is the same as `getData`). */
+  Ptr tryGetData(Key const &iKey)
+  {
+    if(!fOptions.fBackgroundLoading)
+      return getData(iKey);
+
+    collectBackgroundLoads();
+
+    if(auto data = find(iKey))
+      return data;
+
+    fStats.fMisses++;
+    prefetch(iKey);
+    return nullptr;
+  }
+
+  /**
+   * Makes sure the data gets loaded (in the background when enabled) so that a subsequent call is a hit */
+  void prefetch(Key const &iKey)
+  {
+    if(fIndex.find(iKey) != fIndex.end())
+      return;
+
+    if(!fOptions.fBackgroundLoading)
+    {
+      getData(iKey);
+      return;
+    }
+
+    if(!fLoader || !fPending->fInFlight.insert(iKey).second)
+      return;
+
+    // Implementation note: the job only captures what it needs (by value) so that the cache can be destroyed
+    // while the job is in flight
+    fManager->getWorker().submit([loader = fLoader, pending = fPending, key = iKey]() {
+      auto data = loader(key);
+      std::lock_guard<std::mutex> lock{pending->fMutex};
+      pending->fLoaded.emplace_back(key, std::move(data));
+    });
+  }
+
+  /**
+   * Adds the results of the background loads that have completed to the cache. Called automatically by `getData`
+   * and `tryGetData`. */
+  void collectBackgroundLoads()
+  {
+    if(!fOptions.fBackgroundLoading)
+      return;
+
+    std::vector<std::pair<Key, Ptr>> loaded{};
+    {
+      std::lock_guard<std::mutex> lock{fPending->fMutex};
+      if(fPending->fLoaded.empty())
+        return;
+      std::swap(loaded, fPending->fLoaded);
+    }
+
+    for(auto &l: loaded)
+    {
+      fPending->fInFlight.erase(l.first);
+      if(l.second && fIndex.find(l.first) == fIndex.end())
+        insert(l.first, std::move(l.second));
+    }
+  }
+
+  //! Removes the entry (if present)
+  void invalidate(Key const &iKey)
+  {
+    auto iter = fIndex.find(iKey);
+    if(iter != fIndex.end())
+      erase(iter->second);
+  }
+
+  //! Removes all the entries
+  void clear()
+  {
+    while(!fEntries.empty())
+      erase(std::prev(fEntries.end()));
+  }
+
+  // getEntryCount
+  size_t getEntryCount() const { return fEntries.size(); }
+
+  // getSizeInBytes
+  size_t getSizeInBytes() const { return fSizeInBytes; }
+
+  // getStats
+  Stats const &getStats() const { return fStats; }
+
+  // getManager
+  DataCacheManager &getManager() const { return *fManager; }
+
+  //------------------------------------------------------------------------
+  // DataCacheManager::IManagedCache
+  //------------------------------------------------------------------------
+
+  // sweep
+  size_t sweep(clock::time_point iNow) override
+  {
+    if(fOptions.fTimeToLiveMilliseconds == 0)
+      return 0;
+
+    auto ttl = std::chrono::milliseconds(fOptions.fTimeToLiveMilliseconds);
+
+    // entries are sorted by access time (least recently used first)
+    while(!fEntries.empty() && iNow - fEntries.front().fLastAccessTime >= ttl)
+    {
+      erase(fEntries.begin());
+      fStats.fExpirations++;
+    }
+
+    return fEntries.size();
+  }
+
+  // getLeastRecentlyUsed
+  bool getLeastRecentlyUsed(clock::time_point &oLastAccessTime) const override
+  {
+    if(fEntries.empty())
+      return false;
+    oLastAccessTime = fEntries.front().fLastAccessTime;
+    return true;
+  }
+
+  // evictLeastRecentlyUsed
+  void evictLeastRecentlyUsed() override
+  {
+    if(!fEntries.empty())
+    {
+      erase(fEntries.begin());
+      fStats.fEvictions++;
+    }
+  }
+
+private:
+  struct Entry
+  {
+    Key fKey;
+    Ptr fData;
+    size_t fSizeInBytes;
+    clock::time_point fLastAccessTime;
+  };
+
+  using EntryIterator = typename std::list<Entry>::iterator;
+
+  // the results of the background loads (shared with the jobs)
+  struct Pending
+  {
+    std::mutex fMutex{};
+    std::vector<std::pair<Key, Ptr>> fLoaded{}; // protected by fMutex
+    std::unordered_set<Key> fInFlight{};        // only accessed by the UI thread
+  };
+
+  // find => hit (moves the entry to the most recently used position)
+  Ptr find(Key const &iKey)
+  {
+    auto iter = fIndex.find(iKey);
+    if(iter == fIndex.end())
+      return nullptr;
+
+    fStats.fHits++;
+    auto entry = iter->second;
+    entry->fLastAccessTime = clock::now();
+    fEntries.splice(fEntries.end(), fEntries, entry);
+    return entry->fData;
+  }
+
+  // insert (as the most recently used entry)
+  void insert(Key const &iKey, Ptr iData)
+  {
+    auto size = fSizer(*iData);
+    auto entry = fEntries.insert(fEntries.end(), Entry{iKey, std::move(iData), size, clock::now()});
+    fIndex[iKey] = entry;
+    fSizeInBytes += size;
+
+    if(fOptions.fMaxEntries > 0)
+    {
+      while(fEntries.size() > fOptions.fMaxEntries)
+        evictLeastRecentlyUsed();
+    }
+
+    if(fOptions.fTimeToLiveMilliseconds > 0)
+      fManager->requestSweep();
+
+    // may evict entries from this cache or other caches
+    fManager->onSizeChanged(0, size);
+  }
+
+  // erase
+  void erase(EntryIterator iEntry)
+  {
+    auto size = iEntry->fSizeInBytes;
+    fIndex.erase(iEntry->fKey);
+    fEntries.erase(iEntry);
+    fSizeInBytes -= size;
+    fManager->onSizeChanged(size, 0);
+  }
+
+private:
+  Loader fLoader;
+  Options fOptions;
+  Sizer fSizer;
+  std::shared_ptr<DataCacheManager> fManager;
+
+  // least recently used first
+  std::list<Entry> fEntries{};
+  std::unordered_map<Key, EntryIterator> fIndex{};
+  size_t fSizeInBytes{0};
+
+  std::shared_ptr<Pending> fPending{std::make_shared<Pending>()};
+
+  Stats fStats{};
+};
+
+}
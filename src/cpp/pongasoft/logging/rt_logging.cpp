@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include "rt_logging.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+
+namespace pongasoft::logging {
+
+//------------------------------------------------------------------------
+// RTLogger::instance
+//------------------------------------------------------------------------
+RTLogger &RTLogger::instance()
+{
+  static RTLogger kInstance{};
+  return kInstance;
+}
+
+//------------------------------------------------------------------------
+// RTLogger::RTLogger
+//------------------------------------------------------------------------
+RTLogger::RTLogger()
+{
+  for(uint64_t i = 0; i < kCapacity; i++)
+    fRecords[i].fSequence.store(i, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------
+// RTLogger::~RTLogger
+//------------------------------------------------------------------------
+RTLogger::~RTLogger()
+{
+  stop();
+}
+
+//------------------------------------------------------------------------
+// RTLogger::log
+//------------------------------------------------------------------------
+bool RTLogger::log(loguru::Verbosity iVerbosity, char const *iFile, unsigned iLine, char const *iFormat, ...)
+{
+  // Implementation note: this is a (simplified) version of Dmitry Vyukov's bounded MPMC queue. A record is free for
+  // the producer when its sequence == position, and ready for the consumer when its sequence == position + 1
+  auto position = fEnqueuePosition.load(std::memory_order_relaxed);
+  Record *record;
+
+  while(true)
+  {
+    record = &fRecords[position & (kCapacity - 1)];
+    auto sequence = record->fSequence.load(std::memory_order_acquire);
+    auto diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+    if(diff == 0)
+    {
+      if(fEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if(diff < 0)
+    {
+      // ring is full
+      fDroppedCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+      position = fEnqueuePosition.load(std::memory_order_relaxed);
+  }
+
+  record->fVerbosity = iVerbosity;
+  record->fFile = iFile;
+  record->fLine = iLine;
+
+  va_list args;
+  va_start(args, iFormat);
+  auto size = std::vsnprintf(record->fMessage, kMessageSize, iFormat, args);
+  va_end(args);
+
+  if(size >= kMessageSize)
+    fTruncatedCount.fetch_add(1, std::memory_order_relaxed);
+
+  record->fSequence.store(position + 1, std::memory_order_release);
+  fLoggedCount.fetch_add(1, std::memory_order_relaxed);
+
+  return true;
+}
+
+//------------------------------------------------------------------------
+// RTLogger::drain
+//------------------------------------------------------------------------
+int RTLogger::drain()
+{
+  std::lock_guard<std::mutex> lock{fDrainMutex};
+
+  int count = 0;
+
+  while(true)
+  {
+    auto &record = fRecords[fDequeuePosition & (kCapacity - 1)];
+    if(record.fSequence.load(std::memory_order_acquire) != fDequeuePosition + 1)
+      break; // empty (or not fully written yet)
+
+    loguru::log(record.fVerbosity, record.fFile, record.fLine, "%s", record.fMessage);
+
+    // frees the record for the producers
+    record.fSequence.store(fDequeuePosition + kCapacity, std::memory_order_release);
+    fDequeuePosition++;
+    count++;
+  }
+
+  return count;
+}
+
+//------------------------------------------------------------------------
+// RTLogger::start
+//------------------------------------------------------------------------
+void RTLogger::start(int iDrainIntervalMs)
+{
+  std::lock_guard<std::mutex> lock{fThreadMutex};
+
+  if(fRunning.load())
+    return;
+
+  fRunning = true;
+  fThread = std::thread{[this, iDrainIntervalMs]() {
+    loguru::set_thread_name("jamba-rt-logger");
+    while(fRunning.load())
+    {
+      drain();
+      std::this_thread::sleep_for(std::chrono::milliseconds(iDrainIntervalMs));
+    }
+  }};
+}
+
+//------------------------------------------------------------------------
+// RTLogger::stop
+//------------------------------------------------------------------------
+void RTLogger::stop()
+{
+  std::lock_guard<std::mutex> lock{fThreadMutex};
+
+  if(!fRunning.load())
+    return;
+
+  fRunning = false;
+  if(fThread.joinable())
+    fThread.join();
+
+  auto dropped = getDroppedCount();
+  drain();
+  if(dropped > 0)
+    LOG_F(WARNING, "RTLogger dropped %llu message(s)", static_cast<unsigned long long>(dropped));
+}
+
+//------------------------------------------------------------------------
+// RTLogger::acquire
+//------------------------------------------------------------------------
+void RTLogger::acquire(int iDrainIntervalMs)
+{
+  std::lock_guard<std::mutex> lock{fUsersMutex};
+
+  if(fUserCount++ == 0)
+    start(iDrainIntervalMs);
+}
+
+//------------------------------------------------------------------------
+// RTLogger::release
+//------------------------------------------------------------------------
+void RTLogger::release()
+{
+  std::lock_guard<std::mutex> lock{fUsersMutex};
+
+  if(fUserCount == 0)
+    return;
+
+  if(--fUserCount == 0)
+    stop();
+}
+
+//------------------------------------------------------------------------
+// RTLogger::getUserCount
+//------------------------------------------------------------------------
+int RTLogger::getUserCount() const
+{
+  std::lock_guard<std::mutex> lock{fUsersMutex};
+  return fUserCount;
+}
+
+}
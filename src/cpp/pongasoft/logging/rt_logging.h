@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#pragma once
+
+#include "logging.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace pongasoft::logging {
+
+/**
+ * Real time safe logging: `RTLOG_F` (and `DRTLOG_F` for debug only logging) have the same syntax as `LOG_F` but
+ * can be used from the RT thread. The message is formatted into a fixed size record of a preallocated lock free ring
+ * (no memory allocation, no lock, no I/O) and then handed to loguru by a background thread.
+ *
+ * The background thread must be started outside the RT thread. Since the instance is shared by all the plugin
+ * instances loaded in the process, use `acquire` / `release` (reference counted: the thread is started by the first
+ * `acquire` and stopped by the last `release`) which Jamba does in `RTProcessor::initialize` / `terminate` when
+ * `JAMBA_DEBUG_LOGGING` is defined, so that the thread never outlives the plugins (joining a thread during static
+ * destruction, at module unload, is not safe). Until then, messages simply accumulate in the ring. When the ring is
+ * full (the background thread cannot keep up), messages are dropped and counted (`getDroppedCount`). Messages longer
+ * than `kMessageSize` are truncated.
+ *
+ * The ring supports multiple producers (any number of threads can log) and a single consumer (`drain`, which is
+ * serialized internally). */
+class RTLogger
+{
+public:
+  // max size of a message (including the terminating 0)
+  static constexpr int kMessageSize = 256;
+
+  // number of records in the ring (must be a power of 2)
+  static constexpr uint64_t kCapacity = 512;
+
+  // default interval at which the background thread drains the ring
+  static constexpr int kDefaultDrainIntervalMs = 20;
+
+public:
+  // the (process wide) instance
+  static RTLogger &instance();
+
+  // Constructor (use `instance()` except for a standalone logger, in tests for example)
+  RTLogger();
+
+  RTLogger(RTLogger const &) = delete;
+  RTLogger &operator=(RTLogger const &) = delete;
+
+  /**
+   * Formats the message into the ring. RT safe (as long as the format arguments are: strings must not be
+   * temporary objects...).
+   *
+   * @return `false` if the message was dropped (ring full) */
+  bool log(loguru::Verbosity iVerbosity, char const *iFile, unsigned iLine, char const *iFormat, ...)
+    LOGURU_PRINTF_LIKE(5, 6);
+
+  /**
+   * Starts the background thread which drains the ring every `iDrainIntervalMs` milliseconds. Does nothing if
+   * already started. Never call from the RT thread. */
+  void start(int iDrainIntervalMs = kDefaultDrainIntervalMs);
+
+  /**
+   * Stops the background thread (draining whatever is left). Never call from the RT thread. */
+  void stop();
+
+  // isStarted
+  inline bool isStarted() const { return fRunning.load(); }
+
+  /**
+   * Reference counted version of `start`: the first call starts the background thread. Never call from the RT
+   * thread. */
+  void acquire(int iDrainIntervalMs = kDefaultDrainIntervalMs);
+
+  /**
+   * Reference counted version of `stop`: the call matching the first `acquire` stops the background thread. Never call
+   * from the RT thread. */
+  void release();
+
+  // getUserCount (number of `acquire` not yet released)
+  int getUserCount() const;
+
+  /**
+   * Hands all the pending messages to loguru. Called by the background thread but can also be called manually
+   * (for example in tests). Never call from the RT thread.
+   *
+   * @return the number of messages handed to loguru */
+  int drain();
+
+  // number of messages successfully written to the ring
+  inline uint64_t getLoggedCount() const { return fLoggedCount.load(); }
+
+  // number of messages dropped because the ring was full
+  inline uint64_t getDroppedCount() const { return fDroppedCount.load(); }
+
+  // number of messages truncated because they were longer than kMessageSize
+  inline uint64_t getTruncatedCount() const { return fTruncatedCount.load(); }
+
+  // Destructor => stops the background thread
+  ~RTLogger();
+
+private:
+  struct Record
+  {
+    // Vyukov bounded queue sequence number (see log/drain)
+    std::atomic<uint64_t> fSequence{0};
+    loguru::Verbosity fVerbosity{loguru::Verbosity_INFO};
+    char const *fFile{nullptr};
+    unsigned fLine{0};
+    char fMessage[kMessageSize]{};
+  };
+
+  static_assert((kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of 2");
+
+private:
+  std::array<Record, kCapacity> fRecords{};
+
+  // producers side (own cache line to avoid false sharing with the consumer)
+  alignas(64) std::atomic<uint64_t> fEnqueuePosition{0};
+
+  // consumer side (protected by fDrainMutex)
+  alignas(64) uint64_t fDequeuePosition{0};
+  std::mutex fDrainMutex{};
+
+  // stats
+  std::atomic<uint64_t> fLoggedCount{0};
+  std::atomic<uint64_t> fDroppedCount{0};
+  std::atomic<uint64_t> fTruncatedCount{0};
+
+  // background thread
+  std::mutex fThreadMutex{};
+  std::atomic<bool> fRunning{false};
+  std::thread fThread{};
+
+  // acquire/release (separate from fThreadMutex since acquire/release call start/stop)
+  mutable std::mutex fUsersMutex{};
+  int fUserCount{0};
+};
+
+}
+
+// RTLOG_F(INFO, "Foo: %d", some_number); => RT safe equivalent of LOG_F
+#define RTVLOG_F(verbosity, ...)                                                                   \
+  ((verbosity) > loguru::current_verbosity_cutoff()) ? (void)0                                     \
+    : (void) pongasoft::logging::RTLogger::instance().log(verbosity, __FILE__, __LINE__, __VA_ARGS__)
+
+#define RTLOG_F(verbosity_name, ...) RTVLOG_F(loguru::Verbosity_ ## verbosity_name, __VA_ARGS__)
+
+#if LOGURU_DEBUG_LOGGING
+  // RT safe equivalent of DLOG_F
+  #define DRTLOG_F(verbosity_name, ...) RTLOG_F(verbosity_name, __VA_ARGS__)
+#else
+  #define DRTLOG_F(verbosity_name, ...)
+#endif
@@ -18,6 +18,10 @@
 #include <pongasoft/Utils/Collection/CircularBuffer.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <vector>
+
 namespace pongasoft {
 namespace Utils {
 namespace Collection {
@@ -137,6 +141,140 @@ TEST(CircularBuffer, fold)
 
 }
 
+// CircularBuffer - pushBlock
+TEST(CircularBuffer, pushBlock)
+{
+  for(int size: {5, 8})
+  {
+    CircularBuffer<int> cb(size);
+    CircularBuffer<int> expected(size);
+    cb.init(0);
+    expected.init(0);
+
+    ASSERT_EQ(size == 8, cb.isPowerOfTwo());
+
+    int next = 1;
+    for(int blockSize: {0, 1, 3, 4, 7, 13, 2})
+    {
+      std::vector<int> block{};
+      for(int i = 0; i < blockSize; i++)
+      {
+        block.push_back(next);
+        expected.push(next);
+        next++;
+      }
+      cb.pushBlock(block.data(), blockSize);
+
+      for(int offset = -size; offset < size; offset++)
+        ASSERT_EQ(expected.getAt(offset), cb.getAt(offset));
+    }
+  }
+}
+
+// CircularBuffer - getSpans
+TEST(CircularBuffer, getSpans)
+{
+  CircularBuffer<int> cb(5);
+  cb.init(0);
+
+  // underlying buffer will be [6,7,3,4,5]
+  //                                ^ head
+  for(int i = 1; i <= 7; i++)
+    cb.push(i);
+
+  auto spans = cb.getSpans(0, 3); // [3,4,5]
+  ASSERT_EQ(3, spans.fFirstSize);
+  ASSERT_EQ(0, spans.fSecondSize);
+  ASSERT_EQ(3, spans.fFirst[0]);
+  ASSERT_EQ(5, spans.fFirst[2]);
+
+  spans = cb.getSpans(-2, 4); // [6,7,3,4] (no wrap)
+  ASSERT_EQ(4, spans.fFirstSize);
+  ASSERT_EQ(0, spans.fSecondSize);
+  ASSERT_EQ(6, spans.fFirst[0]);
+
+  spans = cb.getSpans(-4, 4); // [4,5][6,7]
+  ASSERT_EQ(2, spans.fFirstSize);
+  ASSERT_EQ(2, spans.fSecondSize);
+  ASSERT_EQ(4, spans.fFirst[0]);
+  ASSERT_EQ(5, spans.fFirst[1]);
+  ASSERT_EQ(6, spans.fSecond[0]);
+  ASSERT_EQ(7, spans.fSecond[1]);
+  ASSERT_EQ(4, spans.size());
+
+  spans = cb.getSpans(1, 5); // [4,5][6,7,3]
+  ASSERT_EQ(2, spans.fFirstSize);
+  ASSERT_EQ(3, spans.fSecondSize);
+  ASSERT_EQ(3, spans.fSecond[2]);
+
+  ASSERT_EQ(0, cb.getSpans(2, 0).size());
+
+  // non const => modifiable
+  auto mspans = cb.getSpans(2, 2); // [5][6]
+  mspans.fFirst[0] = 50;
+  mspans.fSecond[0] = 60;
+  ASSERT_EQ(50, cb.getAt(2));
+  ASSERT_EQ(60, cb.getAt(3));
+
+  ASSERT_EQ(1, CircularBuffer<int>::nextPowerOfTwo(1));
+  ASSERT_EQ(8, CircularBuffer<int>::nextPowerOfTwo(5));
+  ASSERT_EQ(8, CircularBuffer<int>::nextPowerOfTwo(8));
+  ASSERT_EQ(1024, CircularBuffer<int>::nextPowerOfTwo(1000));
+}
+
+// CircularBuffer - benchmark (pushing blocks and computing a windowed sum every block, per element vs block api)
+TEST(CircularBuffer, DISABLED_benchmark)
+{
+  constexpr int kBlockSize = 256;
+  constexpr int kWindowSize = 1024;
+  constexpr int kNumBlocks = 2000;
+
+  std::vector<float> block(kBlockSize);
+  for(int i = 0; i < kBlockSize; i++)
+    block[i] = static_cast<float>(i % 17) / 17.0f;
+
+  auto run = [&block](int iSize, bool iBlockAPI) -> std::pair<double, float> {
+    CircularBuffer<float> cb(iSize);
+    cb.init(0);
+    float total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(int b = 0; b < kNumBlocks; b++)
+    {
+      if(iBlockAPI)
+      {
+        cb.pushBlock(block.data(), kBlockSize);
+        auto spans = cb.getSpans(-kWindowSize, kWindowSize);
+        float sum = 0;
+        for(int i = 0; i < spans.fFirstSize; i++)
+          sum += spans.fFirst[i];
+        for(int i = 0; i < spans.fSecondSize; i++)
+          sum += spans.fSecond[i];
+        total += sum;
+      }
+      else
+      {
+        for(int i = 0; i < kBlockSize; i++)
+          cb.push(block[i]);
+        float sum = 0;
+        for(int i = -kWindowSize; i < 0; i++)
+          sum += cb.getAt(i);
+        total += sum;
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double, std::micro>(end - start).count() / kNumBlocks, total};
+  };
+
+  for(int size: {3000, CircularBuffer<float>::nextPowerOfTwo(3000)})
+  {
+    auto perElement = run(size, false);
+    auto blockAPI = run(size, true);
+    ASSERT_FLOAT_EQ(perElement.second, blockAPI.second);
+    std::cout << "CircularBuffer[" << size << "] block: " << blockAPI.first << "us (per element: "
+              << perElement.first << "us)" << std::endl;
+  }
+}
+
 }
 }
 }
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <pongasoft/Utils/Collection/PeakPyramid.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace pongasoft {
+namespace Utils {
+namespace Collection {
+namespace Test {
+
+// randomSamples
+std::vector<float> randomSamples(size_t iCount)
+{
+  std::mt19937 gen{42};
+  std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+  std::vector<float> res(iCount);
+  for(auto &s: res)
+    s = dist(gen);
+  return res;
+}
+
+// bruteForce
+Peak<float> bruteForce(std::vector<float> const &iSamples, size_t iFrom, size_t iTo)
+{
+  Peak<float> res{};
+  for(auto i = iFrom; i < iTo; i++)
+  {
+    res.fMin = std::min(res.fMin, iSamples[i]);
+    res.fMax = std::max(res.fMax, iSamples[i]);
+    res.fSumOfSquares += static_cast<double>(iSamples[i]) * iSamples[i];
+    res.fCount++;
+  }
+  return res;
+}
+
+// PeakPyramid - computePeak (simd/unrolled path vs scalar)
+TEST(PeakPyramid, computePeak)
+{
+  auto samples = randomSamples(1001);
+  for(size_t count: {0, 1, 3, 4, 5, 17, 64, 1001})
+  {
+    auto expected = bruteForce(samples, 0, count);
+    auto peak = impl::computePeak(samples.data(), count);
+    ASSERT_EQ(expected.fCount, peak.fCount);
+    ASSERT_EQ(expected.fMin, peak.fMin);
+    ASSERT_EQ(expected.fMax, peak.fMax);
+    ASSERT_NEAR(expected.fSumOfSquares, peak.fSumOfSquares, 1e-3);
+  }
+}
+
+// PeakPyramid - levels
+TEST(PeakPyramid, levels)
+{
+  auto samples = randomSamples(1000);
+
+  PeakPyramid<float> pyramid{16};
+  pyramid.build(samples.data(), samples.size());
+
+  ASSERT_EQ(1000, pyramid.getSampleCount());
+  ASSERT_EQ(7, pyramid.getLevelCount()); // 63 buckets, 32, 16, 8, 4, 2, 1
+  ASSERT_EQ(63, pyramid.getLevel(0).size());
+  ASSERT_EQ(1, pyramid.getLevel(6).size());
+
+  for(size_t l = 0; l < pyramid.getLevelCount(); l++)
+  {
+    auto bucketSize = pyramid.getBucketSize(l);
+    auto const &level = pyramid.getLevel(l);
+    for(size_t b = 0; b < level.size(); b++)
+    {
+      auto expected = bruteForce(samples, b * bucketSize, std::min((b + 1) * bucketSize, samples.size()));
+      ASSERT_EQ(expected.fCount, level[b].fCount);
+      ASSERT_EQ(expected.fMin, level[b].fMin);
+      ASSERT_EQ(expected.fMax, level[b].fMax);
+    }
+  }
+
+  auto all = pyramid.getPeak(0, 1000);
+  auto expected = bruteForce(samples, 0, 1000);
+  ASSERT_EQ(expected.fMin, all.fMin);
+  ASSERT_EQ(expected.fMax, all.fMax);
+  ASSERT_NEAR(expected.getRMS(), all.getRMS(), 1e-5);
+
+  ASSERT_TRUE(pyramid.getPeak(1000, 2000).isEmpty());
+}
+
+// PeakPyramid - append (incremental appends in random chunks == build)
+TEST(PeakPyramid, append)
+{
+  auto samples = randomSamples(10000);
+
+  PeakPyramid<float> built{32};
+  built.build(samples.data(), samples.size());
+
+  PeakPyramid<float> appended{32};
+  std::mt19937 gen{7};
+  std::uniform_int_distribution<size_t> chunk{0, 100};
+  size_t offset = 0;
+  while(offset < samples.size())
+  {
+    auto count = std::min(chunk(gen), samples.size() - offset);
+    appended.append(samples.data() + offset, count);
+    offset += count;
+  }
+
+  ASSERT_EQ(built.getLevelCount(), appended.getLevelCount());
+  for(size_t l = 0; l < built.getLevelCount(); l++)
+  {
+    auto const &b = built.getLevel(l);
+    auto const &a = appended.getLevel(l);
+    ASSERT_EQ(b.size(), a.size());
+    for(size_t i = 0; i < b.size(); i++)
+    {
+      ASSERT_EQ(b[i].fCount, a[i].fCount);
+      ASSERT_EQ(b[i].fMin, a[i].fMin);
+      ASSERT_EQ(b[i].fMax, a[i].fMax);
+      ASSERT_NEAR(b[i].fSumOfSquares, a[i].fSumOfSquares, 1e-2);
+    }
+  }
+}
+
+// PeakPyramid - appendStreaming (many small blocks, as recorded by a plugin: storage must grow geometrically)
+TEST(PeakPyramid, appendStreaming)
+{
+  constexpr size_t kBlockSize = 256;
+  constexpr size_t kBlockCount = 20000;
+
+  auto block = randomSamples(kBlockSize);
+  auto expected = bruteForce(block, 0, kBlockSize);
+
+  PeakPyramid<float> pyramid{64};
+  for(size_t i = 0; i < kBlockCount; i++)
+    pyramid.append(block.data(), block.size());
+
+  ASSERT_EQ(kBlockSize * kBlockCount, pyramid.getSampleCount());
+  ASSERT_EQ(kBlockSize * kBlockCount / 64, pyramid.getLevel(0).size());
+  ASSERT_EQ(1, pyramid.getLevel(pyramid.getLevelCount() - 1).size());
+
+  auto all = pyramid.getLevel(pyramid.getLevelCount() - 1)[0];
+  ASSERT_EQ(kBlockSize * kBlockCount, all.fCount);
+  ASSERT_EQ(expected.fMin, all.fMin);
+  ASSERT_EQ(expected.fMax, all.fMax);
+  ASSERT_NEAR(expected.getRMS(), all.getRMS(), 1e-4);
+}
+
+// PeakPyramid - getPeaks (every pixel contains its samples and does not extend by more than 2 buckets)
+TEST(PeakPyramid, getPeaks)
+{
+  auto samples = randomSamples(100000);
+
+  PeakPyramid<float> pyramid{64};
+  pyramid.build(samples.data(), samples.size());
+
+  std::vector<Peak<float>> peaks(300);
+
+  for(double spp: {0.5, 3.0, 64.0, 100.0, 333.3, 1000.0, 5000.0})
+  {
+    for(double start: {-100.0, 0.0, 12345.6, 90000.0})
+    {
+      pyramid.getPeaks(start, spp, peaks.data(), peaks.size(), samples.data());
+      for(size_t p = 0; p < peaks.size(); p++)
+      {
+        auto from = start + p * spp;
+        auto to = from + spp;
+        if(to <= 0 || from >= samples.size())
+        {
+          ASSERT_TRUE(peaks[p].isEmpty());
+          continue;
+        }
+
+        auto fromSample = static_cast<size_t>(std::max(0.0, std::floor(from)));
+        auto toSample = std::max(fromSample + 1, static_cast<size_t>(std::min<double>(samples.size(), std::ceil(to))));
+
+        auto exact = bruteForce(samples, fromSample, toSample);
+        ASSERT_LE(peaks[p].fMin, exact.fMin);
+        ASSERT_GE(peaks[p].fMax, exact.fMax);
+
+        if(spp < 64.0)
+        {
+          // computed from the samples
+          ASSERT_EQ(exact.fMin, peaks[p].fMin);
+          ASSERT_EQ(exact.fMax, peaks[p].fMax);
+        }
+        else
+        {
+          // bucket size <= spp => at most 1 bucket of extra samples on each side
+          ASSERT_LE(peaks[p].fCount, exact.fCount + 2 * spp);
+        }
+      }
+    }
+  }
+}
+
+// PeakPyramid - benchmark (1 minute of audio at 48kHz drawn in 1000 pixels: pyramid vs scanning all samples)
+TEST(PeakPyramid, DISABLED_benchmark)
+{
+  constexpr size_t kNumSamples = 48000 * 60;
+  constexpr size_t kNumPixels = 1000;
+  constexpr int kIterations = 20;
+
+  auto samples = randomSamples(kNumSamples);
+  std::vector<Peak<float>> peaks(kNumPixels);
+
+  auto start = std::chrono::steady_clock::now();
+  PeakPyramid<float> pyramid{};
+  pyramid.build(samples.data(), samples.size());
+  auto buildTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  // full view
+  double spp = static_cast<double>(kNumSamples) / kNumPixels;
+
+  start = std::chrono::steady_clock::now();
+  float checksum = 0;
+  for(int i = 0; i < kIterations; i++)
+  {
+    pyramid.getPeaks(0, spp, peaks.data(), kNumPixels, samples.data());
+    checksum += peaks[i].fMax;
+  }
+  auto pyramidTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kIterations;
+
+  start = std::chrono::steady_clock::now();
+  for(int i = 0; i < kIterations; i++)
+  {
+    for(size_t p = 0; p < kNumPixels; p++)
+      peaks[p] = impl::computePeak(samples.data() + static_cast<size_t>(p * spp), static_cast<size_t>(spp));
+    checksum += peaks[i].fMax;
+  }
+  auto scanTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kIterations;
+
+  std::cout << "PeakPyramid: build " << buildTime << "ms, draw " << pyramidTime << "us (scan: " << scanTime << "us)"
+            << " [" << checksum << "]" << std::endl;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <pongasoft/Utils/Collection/SPSCRingBuffer.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace pongasoft {
+namespace Utils {
+namespace Collection {
+namespace Test {
+
+// SPSCRingBuffer - readWrite
+TEST(SPSCRingBuffer, readWrite)
+{
+  SPSCRingBuffer<int> rb(5);
+  ASSERT_EQ(8, rb.getCapacity());
+
+  int out[16]{};
+  ASSERT_EQ(0, rb.read(out, 16));
+
+  int in[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+  rb.write(in, 3);
+  ASSERT_EQ(3, rb.getReadableCount());
+  ASSERT_EQ(2, rb.read(out, 2));
+  ASSERT_EQ(0, out[0]);
+  ASSERT_EQ(1, out[1]);
+
+  // wraps around
+  rb.write(in + 3, 6);
+  ASSERT_EQ(7, rb.getReadableCount());
+  ASSERT_EQ(7, rb.read(out, 16));
+  for(int i = 0; i < 7; i++)
+    ASSERT_EQ(i + 2, out[i]);
+  ASSERT_EQ(0, rb.getDroppedCount());
+
+  // overwrite oldest (consumer fell behind)
+  rb.write(in, 5);
+  rb.write(in + 5, 7);
+  ASSERT_EQ(8, rb.getReadableCount());
+  ASSERT_EQ(8, rb.read(out, 16));
+  for(int i = 0; i < 8; i++)
+    ASSERT_EQ(i + 4, out[i]);
+  ASSERT_EQ(4, rb.getDroppedCount());
+
+  // block bigger than the capacity => only the last 8 elements are kept
+  rb.write(in, 16);
+  ASSERT_EQ(8, rb.read(out, 16));
+  for(int i = 0; i < 8; i++)
+    ASSERT_EQ(i + 8, out[i]);
+  ASSERT_EQ(12, rb.getDroppedCount());
+  ASSERT_EQ(9 + 12 + 16, rb.getWrittenCount());
+
+  // readLatest skips the older elements (not accounted for as dropped)
+  rb.write(in, 6);
+  ASSERT_EQ(2, rb.readLatest(out, 2));
+  ASSERT_EQ(4, out[0]);
+  ASSERT_EQ(5, out[1]);
+  ASSERT_EQ(0, rb.getReadableCount());
+  ASSERT_EQ(12, rb.getDroppedCount());
+  ASSERT_EQ(9 + 12 + 16 + 6, rb.getConsumedCount());
+
+  rb.push(100);
+  rb.skipAll();
+  ASSERT_EQ(0, rb.read(out, 16));
+  ASSERT_EQ(rb.getWrittenCount(), rb.getConsumedCount());
+}
+
+// SPSCRingBuffer - concurrent (every element read is consistent and read + dropped == written)
+TEST(SPSCRingBuffer, concurrent)
+{
+  constexpr uint32_t kTotal = 2000000;
+  constexpr uint32_t kBlockSize = 64;
+
+  SPSCRingBuffer<uint32_t> rb(1024);
+  std::atomic<bool> done{false};
+
+  std::thread producer([&rb, &done]() {
+    uint32_t block[kBlockSize];
+    for(uint32_t i = 0; i < kTotal; i += kBlockSize)
+    {
+      for(uint32_t j = 0; j < kBlockSize; j++)
+        block[j] = i + j;
+      rb.write(block, kBlockSize);
+    }
+    done.store(true);
+  });
+
+  std::vector<uint32_t> out(300);
+  uint64_t readCount = 0;
+  uint32_t expected = 0;
+  bool ordered = true;
+
+  auto consume = [&]() {
+    auto previousDropped = rb.getDroppedCount();
+    auto count = rb.read(out.data(), out.size());
+    // the elements lost (if any) are right before what was read
+    expected += static_cast<uint32_t>(rb.getDroppedCount() - previousDropped);
+    for(size_t i = 0; i < count; i++)
+      ordered &= out[i] == expected++;
+    readCount += count;
+    return count;
+  };
+
+  while(!done.load())
+    consume();
+  while(consume() > 0) {}
+
+  producer.join();
+
+  ASSERT_TRUE(ordered);
+  ASSERT_EQ(kTotal, rb.getWrittenCount());
+  ASSERT_EQ(kTotal, readCount + rb.getDroppedCount());
+}
+
+// SPSCRingBuffer - benchmark (sustained throughput: RT like producer with 256 samples blocks, consumer reading as
+// fast as it can)
+TEST(SPSCRingBuffer, DISABLED_benchmark)
+{
+  constexpr size_t kBlockSize = 256;
+  constexpr uint64_t kTotal = kBlockSize * 200000;
+
+  SPSCRingBuffer<float> rb(16384);
+  std::atomic<bool> done{false};
+
+  std::vector<float> block(kBlockSize);
+  for(size_t i = 0; i < kBlockSize; i++)
+    block[i] = static_cast<float>(i) / kBlockSize;
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::thread producer([&]() {
+    for(uint64_t i = 0; i < kTotal; i += kBlockSize)
+      rb.write(block.data(), kBlockSize);
+    done.store(true);
+  });
+
+  std::vector<float> out(rb.getCapacity());
+  uint64_t readCount = 0;
+  float sum = 0;
+  while(true)
+  {
+    auto finished = done.load();
+    auto count = rb.read(out.data(), out.size());
+    readCount += count;
+    if(count > 0)
+      sum += out[count - 1];
+    if(finished && count == 0)
+      break;
+  }
+
+  producer.join();
+
+  auto end = std::chrono::steady_clock::now();
+  auto seconds = std::chrono::duration<double>(end - start).count();
+
+  ASSERT_EQ(kTotal, readCount + rb.getDroppedCount());
+
+  // note that on a single core machine, the consumer only runs when the producer is preempted (=> mostly dropped)
+  std::cout << "SPSCRingBuffer throughput: " << (kTotal / seconds / 1e6) << "M samples/s written, "
+            << (readCount / seconds / 1e6) << "M samples/s read"
+            << " (dropped: " << rb.getDroppedCount() << ", checksum: " << sum << ")"
+            << std::endl;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <pongasoft/Utils/Denormals.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace pongasoft::Utils::Test {
+
+// prevents the compiler from computing the values at compile time
+template<typename T>
+T opaque(T iValue)
+{
+  volatile T value = iValue;
+  return value;
+}
+
+// Denormals - testScopedNoDenormals
+TEST(Denormals, testScopedNoDenormals)
+{
+  auto denormal = opaque(std::numeric_limits<float>::min() / 4.0f);
+  ASSERT_EQ(FP_SUBNORMAL, std::fpclassify(denormal));
+
+  if(!ScopedNoDenormals::isSupported())
+    return;
+
+  {
+    ScopedNoDenormals noDenormals{};
+
+    // flushed to 0
+    ASSERT_EQ(0, opaque(denormal) * opaque(1.0f));
+    ASSERT_EQ(0, opaque(std::numeric_limits<float>::min()) * opaque(0.25f));
+
+    // nested => still enabled when the inner scope ends
+    {
+      ScopedNoDenormals nested{};
+    }
+    ASSERT_EQ(0, opaque(denormal) * opaque(1.0f));
+  }
+
+  // previous mode restored
+  ASSERT_EQ(FP_SUBNORMAL, std::fpclassify(opaque(denormal) * opaque(1.0f)));
+}
+
+// decayingTail: a one pole feedback filter fed with an impulse then silence (ex: the tail of a reverb)
+float decayingTail(int iNumSamples)
+{
+  float y = opaque(1.0f);
+  float const feedback = opaque(0.999f);
+  float sum = 0;
+  for(int i = 0; i < iNumSamples; i++)
+  {
+    y = y * feedback;
+    sum += y;
+  }
+  return sum;
+}
+
+// Denormals - benchmarkDecayingTail
+TEST(Denormals, DISABLED_benchmarkDecayingTail)
+{
+  // 0.999^n reaches the denormal range after ~87,000 samples (and 0 after ~104,000)
+  constexpr int kNumSamples = 100000;
+  constexpr int kIterations = 20;
+
+  auto measure = [](bool iNoDenormals) {
+    float sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < kIterations; i++)
+    {
+      if(iNoDenormals)
+      {
+        ScopedNoDenormals noDenormals{};
+        sum += decayingTail(kNumSamples);
+      }
+      else
+        sum += decayingTail(kNumSamples);
+    }
+    opaque(sum);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kIterations;
+  };
+
+  auto timeWithDenormals = measure(false);
+  auto timeWithoutDenormals = measure(true);
+
+  std::cout << "Decaying IIR tail (" << kNumSamples << " samples): " << timeWithDenormals << "ms with denormals, "
+            << timeWithoutDenormals << "ms flushed to zero"
+            << (ScopedNoDenormals::isSupported() ? "" : " (not supported on this platform)") << std::endl;
+}
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <pongasoft/Utils/FFT.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace pongasoft {
+namespace Utils {
+namespace Test {
+
+// RealFFT - size (rounded up to a power of 2)
+TEST(RealFFT, size)
+{
+  ASSERT_EQ(4, RealFFT<float>{1}.getSize());
+  ASSERT_EQ(512, RealFFT<float>{512}.getSize());
+  ASSERT_EQ(1024, RealFFT<float>{513}.getSize());
+  ASSERT_EQ(513, RealFFT<float>{1024}.getNumBins());
+}
+
+// RealFFT - forward (compared to a naive DFT)
+TEST(RealFFT, forward)
+{
+  for(int size: {4, 8, 16, 64, 1024})
+  {
+    RealFFT<double> fft{size};
+
+    std::vector<double> input(size);
+    for(int i = 0; i < size; i++)
+      input[i] = std::sin(0.37 * i) + 0.5 * std::cos(1.3 * i) + (i % 3) * 0.1;
+
+    std::vector<double> re(fft.getNumBins()), im(fft.getNumBins());
+    fft.forward(input.data(), re.data(), im.data());
+
+    for(int k = 0; k < fft.getNumBins(); k++)
+    {
+      double expectedRe = 0, expectedIm = 0;
+      for(int n = 0; n < size; n++)
+      {
+        auto angle = 2.0 * 3.14159265358979323846 * k * n / size;
+        expectedRe += input[n] * std::cos(angle);
+        expectedIm -= input[n] * std::sin(angle);
+      }
+      ASSERT_NEAR(expectedRe, re[k], 1e-9) << "size=" << size << ", k=" << k;
+      ASSERT_NEAR(expectedIm, im[k], 1e-9) << "size=" << size << ", k=" << k;
+    }
+  }
+}
+
+// RealFFT - sine (the peak is in the right bin and the window scaling gives the amplitude)
+TEST(RealFFT, sine)
+{
+  constexpr int kSize = 2048;
+  constexpr int kBin = 100;
+
+  RealFFT<float> fft{kSize};
+
+  std::vector<float> window(kSize);
+  auto sum = RealFFT<float>::hannWindow(window.data(), kSize);
+  ASSERT_NEAR(kSize / 2.0, sum, 1e-2);
+
+  std::vector<float> input(kSize);
+  for(int i = 0; i < kSize; i++)
+    input[i] = 0.5f * std::sin(2.0f * 3.14159265f * kBin * i / kSize) * window[i];
+
+  std::vector<float> re(fft.getNumBins()), im(fft.getNumBins());
+  fft.forward(input.data(), re.data(), im.data());
+
+  int peak = 0;
+  float peakMagnitude = 0;
+  for(int k = 0; k < fft.getNumBins(); k++)
+  {
+    auto magnitude = std::sqrt(re[k] * re[k] + im[k] * im[k]);
+    if(magnitude > peakMagnitude)
+    {
+      peak = k;
+      peakMagnitude = magnitude;
+    }
+  }
+
+  ASSERT_EQ(kBin, peak);
+  ASSERT_NEAR(0.5f, peakMagnitude * 2.0f / sum, 1e-3);
+}
+
+// RealFFT - benchmark
+TEST(RealFFT, DISABLED_benchmark)
+{
+  for(int size: {512, 2048, 8192})
+  {
+    RealFFT<float> fft{size};
+    std::vector<float> input(size), re(fft.getNumBins()), im(fft.getNumBins());
+    for(int i = 0; i < size; i++)
+      input[i] = std::sin(0.01f * i);
+
+    int const iterations = (1 << 24) / size;
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iterations; i++)
+      fft.forward(input.data(), re.data(), im.data());
+    auto time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "RealFFT<float> size " << size << ": " << time / iterations << "us" << std::endl;
+  }
+}
+
+}
+}
+}
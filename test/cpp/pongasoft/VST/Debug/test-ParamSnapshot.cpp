@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/Debug/ParamSnapshot.h>
+
+namespace pongasoft::VST::Debug::TestParamSnapshot {
+
+using namespace RT;
+
+enum ParamIDs : ParamID {
+  kParam1 = 1000,
+  kParam2 = 1001,
+  kParam3 = 1002,
+};
+
+//------------------------------------------------------------------------
+// MyParameters
+//------------------------------------------------------------------------
+class MyParameters : public Parameters
+{
+public:
+  RawVstParam fParam1;
+  RawVstParam fParam2;
+  RawVstParam fParam3;
+
+  MyParameters()
+  {
+    fParam1 = raw(kParam1, STR16("param1")).defaultValue(0.1).add();
+    fParam2 = raw(kParam2, STR16("param2")).defaultValue(0.2).add();
+    fParam3 = raw(kParam3, STR16("param3")).defaultValue(0.3).add();
+  }
+};
+
+//------------------------------------------------------------------------
+// MyRTState
+//------------------------------------------------------------------------
+class MyRTState : public RTState
+{
+public:
+  RTRawVstParam fParam1;
+  RTRawVstParam fParam2;
+  RTRawVstParam fParam3;
+
+  explicit MyRTState(MyParameters const &iParams) :
+    RTState(iParams),
+    fParam1{add(iParams.fParam1)},
+    fParam2{add(iParams.fParam2)},
+    fParam3{add(iParams.fParam3)}
+  {}
+};
+
+// ParamSnapshot - testCapture
+TEST(ParamSnapshot, testCapture)
+{
+  MyParameters params{};
+  MyRTState state{params};
+
+  ParamSnapshot snapshot{&state, 100, {kParam3, kParam1}};
+
+  ASSERT_EQ(std::vector<ParamID>({kParam3, kParam1}), snapshot.ids());
+  ASSERT_EQ(0, snapshot.getCaptureCount());
+
+  // rate limited
+  ASSERT_FALSE(snapshot.capture(60));
+  ASSERT_FALSE(snapshot.update());
+  ASSERT_TRUE(snapshot.capture(60));
+  ASSERT_EQ(1, snapshot.getCaptureCount());
+  ASSERT_FALSE(snapshot.capture(99));
+
+  ASSERT_TRUE(snapshot.update());
+  ASSERT_FALSE(snapshot.update()); // no new capture
+  ASSERT_EQ(0.3, snapshot.current().get(0));
+  ASSERT_EQ(0.1, snapshot.current().get(1));
+
+  // the snapshot does not change until the next capture
+  state.fParam1.update(0.7);
+  ASSERT_FALSE(snapshot.update());
+  ASSERT_EQ(0.1, snapshot.current().get(1));
+
+  snapshot.captureNow();
+  ASSERT_EQ(2, snapshot.getCaptureCount());
+  ASSERT_TRUE(snapshot.update());
+  ASSERT_EQ(0.7, snapshot.current().get(1));
+}
+
+// ParamSnapshot - testDiffs
+TEST(ParamSnapshot, testDiffs)
+{
+  MyParameters params{};
+  MyRTState state{params};
+
+  ParamSnapshot snapshot{&state};
+
+  ASSERT_EQ(std::vector<ParamID>({kParam1, kParam2, kParam3}), snapshot.ids());
+
+  // nothing captured yet => no diff
+  ASSERT_TRUE(snapshot.diffs().empty());
+  ASSERT_TRUE(snapshot.diffs().empty());
+
+  // first capture => every parameter is reported
+  ASSERT_TRUE(snapshot.capture(32));
+  auto diffs = snapshot.diffs();
+  ASSERT_EQ(3, diffs.size());
+  ASSERT_EQ(kParam1, diffs[0].fParamID);
+  ASSERT_EQ(0.1, diffs[0].fNormalizedValue);
+  ASSERT_EQ(params.fParam1->toUTF8String(0.1, -1), diffs[0].fValue);
+  ASSERT_EQ(kParam2, diffs[1].fParamID);
+  ASSERT_EQ(kParam3, diffs[2].fParamID);
+
+  // no new capture => no diff
+  ASSERT_TRUE(snapshot.diffs().empty());
+
+  // new capture but nothing changed => no diff
+  snapshot.captureNow();
+  ASSERT_TRUE(snapshot.diffs().empty());
+
+  // only the changed parameter is reported
+  state.fParam2.update(0.25);
+  snapshot.captureNow();
+  diffs = snapshot.diffs();
+  ASSERT_EQ(1, diffs.size());
+  ASSERT_EQ(kParam2, diffs[0].fParamID);
+  ASSERT_EQ(0.2, diffs[0].fPreviousNormalizedValue);
+  ASSERT_EQ(0.25, diffs[0].fNormalizedValue);
+  ASSERT_EQ(params.fParam2->toUTF8String(0.25, -1), diffs[0].fValue);
+
+  // only the latest capture counts
+  state.fParam1.update(0.5);
+  snapshot.captureNow();
+  state.fParam1.update(0.1);
+  snapshot.captureNow();
+  ASSERT_TRUE(snapshot.diffs().empty());
+}
+
+}
@@ -21,6 +21,8 @@
 #include <pongasoft/VST/Parameters.h>
 #include <pongasoft/VST/GUI/GUIState.h>
 #include <pongasoft/VST/GUI/GUIController.h>
+#include <chrono>
+#include <iostream>
 #include <stdexcept>
 
 namespace pongasoft::VST::GUI::Params::TestParamAware {
@@ -156,6 +158,9 @@ public:
   // empty
   inline bool empty() const { return fCallbacks.empty(); };
 
+  // getConnectionCount
+  inline size_t getConnectionCount() const { return fParamCxMgr ? fParamCxMgr->getConnectionCount() : 0; }
+
   ParamValue raw()
   {
     return getGUIState()->getRawVstParameter(ParamIDs::kRawVst)->getValue();
@@ -1901,4 +1906,264 @@ TEST(ParamAware, testJmbParam_Param)
   ASSERT_EQ(2, c.jmb());
 }
 
+//------------------------------------------------------------------------
+// ParamAware - testSuspendResume
+//------------------------------------------------------------------------
+TEST(ParamAware, testSuspendResume)
+{
+  MyController c{};
+
+  GUIRawVstParam param = c.registerRawVstParam(ParamIDs::kInt64Vst);
+  auto jmbParam = c.registerJmbParam<int32>(ParamIDs::kInt32Jmb);
+  CHECK_EMPTY(c);
+
+  // suspended => listener NOT called
+  c.suspendAll();
+  c.vst(3);
+  c.vst(4);
+  CHECK_EMPTY(c);
+  ASSERT_DOUBLE_EQ(0.8, param.getValue());
+
+  // resume => listener called once (catch up)
+  c.resumeAll();
+  CHECK(c, ParamIDs::kInt64Vst);
+
+  // no change while suspended => listener NOT called on resume
+  c.suspendAll();
+  c.resumeAll();
+  CHECK_EMPTY(c);
+
+  // not suspended anymore
+  c.jmb(5);
+  CHECK(c, ParamIDs::kInt32Jmb);
+  ASSERT_EQ(5, jmbParam.getValue());
+}
+
+//------------------------------------------------------------------------
+// ParamAware - testFanOut
+// Many listeners/callbacks on the same parameter share one connection
+//------------------------------------------------------------------------
+TEST(ParamAware, testFanOut)
+{
+  MyController c{};
+
+  std::vector<int> order{};
+
+  // Raw and typed vst params share the same underlying parameter
+  c.registerRawVstParam(ParamIDs::kInt64Vst);
+  c.registerVstCallback<int64>(ParamIDs::kInt64Vst, [&order]() { order.emplace_back(1); }, false);
+  c.registerRawVstCallback(ParamIDs::kInt64Vst, [&order]() { order.emplace_back(2); }, false);
+  c.registerJmbParam<int32>(ParamIDs::kInt32Jmb);
+  c.registerJmbCallback<int32>(ParamIDs::kInt32Jmb, [&order]() { order.emplace_back(3); }, false);
+  c.registerCallback<int32>(c.fState.fInt32Jmb, [&order]() { order.emplace_back(4); });
+  ASSERT_EQ(2, c.getConnectionCount());
+
+  // all listeners/callbacks are called (in registration order)
+  c.vst(3);
+  CHECK(c, ParamIDs::kInt64Vst);
+  ASSERT_EQ((std::vector<int>{1, 2}), order);
+  order.clear();
+
+  c.jmb(3);
+  CHECK(c, ParamIDs::kInt32Jmb);
+  ASSERT_EQ((std::vector<int>{3, 4}), order);
+  order.clear();
+
+  // invokeAll follows registration order as well
+  c.invokeAll();
+  ASSERT_EQ((std::vector<ParamID>{ParamIDs::kInt64Vst, ParamIDs::kInt32Jmb}), c.fCallbacks);
+  ASSERT_EQ((std::vector<int>{1, 2, 3, 4}), order);
+
+  // a callback unregistering everything stops the notification
+  c.reset();
+  auto count = 0;
+  c.registerJmbCallback<int32>(ParamIDs::kInt32Jmb, [&c, &count]() { count++; c.unregisterAll(); }, false);
+  c.registerJmbCallback<int32>(ParamIDs::kInt32Jmb, [&count]() { count++; }, false);
+  ASSERT_EQ(1, c.getConnectionCount());
+  c.jmb(4);
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(0, c.getConnectionCount());
+  c.jmb(5);
+  ASSERT_EQ(1, count);
+
+  // suspend/resume applies to the entries (the connection being shared)
+  auto count2 = 0;
+  c.registerJmbCallback<int32>(ParamIDs::kInt32Jmb, [&count]() { count++; }, false);
+  c.registerJmbCallback<int32>(ParamIDs::kInt32Jmb, [&count2]() { count2++; }, false);
+  c.suspendAll();
+  c.jmb(6);
+  c.jmb(7);
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(0, count2);
+  c.resumeAll();
+  ASSERT_EQ(2, count);
+  ASSERT_EQ(1, count2);
+}
+
+//------------------------------------------------------------------------
+// ParamAware - testFanOutShared
+// The connections are shared by all the managers (views) created by the same GUIState
+//------------------------------------------------------------------------
+TEST(ParamAware, testFanOutShared)
+{
+  MyController c{};
+  auto state = c.getGUIState();
+
+  std::vector<int> order{};
+
+  std::vector<std::unique_ptr<ParamAware>> views{};
+  for(int i = 0; i < 3; i++)
+  {
+    auto view = std::make_unique<ParamAware>();
+    view->initState(state);
+    view->registerRawVstCallback(ParamIDs::kInt64Vst, [&order, i]() { order.emplace_back(i); }, false);
+    view->registerJmbCallback<int32>(ParamIDs::kInt32Jmb, [&order, i]() { order.emplace_back(10 + i); }, false);
+    views.emplace_back(std::move(view));
+  }
+  c.registerVstCallback<int64>(ParamIDs::kInt64Vst, [&order]() { order.emplace_back(100); }, false);
+
+  // one connection per parameter for all the views
+  ASSERT_EQ(2, state->getParamConnectionCount());
+
+  c.vst(2);
+  ASSERT_EQ((std::vector<int>{0, 1, 2, 100}), order);
+  order.clear();
+
+  // a hidden (suspended) view catches up on resume, the other ones are not affected
+  views[1]->suspendAll();
+  c.vst(3);
+  ASSERT_EQ((std::vector<int>{0, 2, 100}), order);
+  order.clear();
+  views[1]->resumeAll();
+  ASSERT_EQ((std::vector<int>{1}), order);
+  order.clear();
+
+  // removing a view only removes its entries
+  views.erase(views.begin());
+  ASSERT_EQ(2, state->getParamConnectionCount());
+  c.jmb(4);
+  ASSERT_EQ((std::vector<int>{11, 12}), order);
+  order.clear();
+
+  // the connection is closed when the last entry is removed
+  views.clear();
+  ASSERT_EQ(1, state->getParamConnectionCount());
+  c.unregisterAll();
+  ASSERT_EQ(0, state->getParamConnectionCount());
+  c.vst(4);
+  ASSERT_TRUE(order.empty());
+}
+
+//------------------------------------------------------------------------
+// BenchmarkController (kBenchmarkParamCount raw vst parameters)
+//------------------------------------------------------------------------
+constexpr ParamID kBenchmarkParamID = 5000;
+constexpr int kBenchmarkParamCount = 64;
+
+class BenchmarkParameters : public Parameters
+{
+public:
+  BenchmarkParameters()
+  {
+    for(int i = 0; i < kBenchmarkParamCount; i++)
+      raw(kBenchmarkParamID + i, STR16("benchmark")).add();
+  }
+};
+
+class BenchmarkController : public GUIController
+{
+public:
+  BenchmarkController() : GUIController("JambaTestPlugin.uidesc"), fParams{}, fState{fParams}
+  {
+    // implementation note: this is only for testing! in real life scenario the host/DAW is the one
+    // instantiating the controller and calling initialize with a host context
+    initialize(nullptr);
+  }
+
+  // getGUIState
+  GUIState *getGUIState() override { return &fState; }
+
+  BenchmarkParameters fParams;
+  GUIPluginState<BenchmarkParameters> fState;
+};
+
+//------------------------------------------------------------------------
+// ParamAware - benchmarkRegisterUnregister
+// A large editor: kViews views (one manager each) registering kParamsPerView callbacks over kBenchmarkParamCount
+// parameters, then being destroyed. Compares the shared connections (one dependent per parameter) to the previous
+// connection path (one connection, so one dependent, per callback).
+//------------------------------------------------------------------------
+TEST(ParamAware, DISABLED_benchmarkRegisterUnregister)
+{
+  constexpr int kViews = 2000;
+  constexpr int kParamsPerView = 4;
+  constexpr int kIterations = 5;
+
+  BenchmarkController c{};
+  auto state = c.getGUIState();
+
+  auto paramID = [](int iView, int iParam) {
+    return static_cast<ParamID>(kBenchmarkParamID + (iView + iParam) % kBenchmarkParamCount);
+  };
+
+  int count = 0;
+  auto notifyAll = [state, &count]() {
+    count = 0;
+    for(int i = 0; i < kBenchmarkParamCount; i++)
+    {
+      auto param = state->getRawVstParameter(kBenchmarkParamID + i);
+      param->update(param->getValue() > 0.5 ? 0.0 : 1.0);
+    }
+    return count;
+  };
+
+  // shared connections
+  double sharedTime = 0;
+  for(int i = 0; i < kIterations; i++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    {
+      std::vector<std::unique_ptr<ParamAware>> views{};
+      views.reserve(kViews);
+      for(int v = 0; v < kViews; v++)
+      {
+        auto view = std::make_unique<ParamAware>();
+        view->initState(state);
+        for(int p = 0; p < kParamsPerView; p++)
+          view->registerRawVstCallback(paramID(v, p), [&count]() { count++; }, false);
+        views.emplace_back(std::move(view));
+      }
+      sharedTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      ASSERT_EQ(kBenchmarkParamCount, state->getParamConnectionCount());
+      ASSERT_EQ(kViews * kParamsPerView, notifyAll());
+      start = std::chrono::steady_clock::now();
+    }
+    sharedTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_EQ(0, state->getParamConnectionCount());
+  }
+
+  // previous path: one connection per callback
+  double perCallbackTime = 0;
+  for(int i = 0; i < kIterations; i++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    {
+      std::vector<std::vector<std::unique_ptr<FObjectCx>>> views(kViews);
+      for(int v = 0; v < kViews; v++)
+      {
+        for(int p = 0; p < kParamsPerView; p++)
+          views[v].emplace_back(state->findParam(paramID(v, p))->connect([&count]() { count++; }));
+      }
+      perCallbackTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+      ASSERT_EQ(kViews * kParamsPerView, notifyAll());
+      start = std::chrono::steady_clock::now();
+    }
+    perCallbackTime += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  std::cout << "Register/unregister " << kViews << " views x " << kParamsPerView << " callbacks ("
+            << kBenchmarkParamCount << " parameters): " << sharedTime / kIterations << "ms"
+            << " (one connection per callback: " << perCallbackTime / kIterations << "ms)" << std::endl;
+}
+
 }
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/GUI/Views/CustomView.h>
+
+#include <iostream>
+#include <vector>
+
+namespace pongasoft::VST::GUI::Views::TestCustomView {
+
+constexpr int kGridSize = 8;
+constexpr CCoord kCellSize = 20;
+
+//------------------------------------------------------------------------
+// GridView - a grid of 8x8 cells (one parameter per cell), each cell being "expensive" to draw
+//------------------------------------------------------------------------
+class GridView : public CustomView
+{
+public:
+  GridView() : CustomView(CRect{100, 50, 100 + kGridSize * kCellSize, 50 + kGridSize * kCellSize})
+  {
+    setBackColor(kTransparentCColor);
+    for(int i = 0; i < kGridSize * kGridSize; i++)
+      setParamDirtyRect(static_cast<ParamID>(1000 + i), computeCellRect(i));
+  }
+
+  static CRect computeCellRect(int iCell)
+  {
+    auto x = (iCell % kGridSize) * kCellSize;
+    auto y = (iCell / kGridSize) * kCellSize;
+    return CRect{x, y, x + kCellSize, y + kCellSize};
+  }
+
+  void draw(CDrawContext *iContext) override
+  {
+    // no draw context in this test => no call to CustomView::draw
+    for(int i = 0; i < kGridSize * kGridSize; i++)
+    {
+      if(intersectsUpdateRect(computeCellRect(i)))
+      {
+        fDrawnCells.emplace_back(i);
+        drawCell(i);
+      }
+    }
+    setDirty(false);
+  }
+
+  void drawCell(int iCell)
+  {
+    for(int i = 0; i < fCellWork; i++)
+      fChecksum += i * iCell;
+  }
+
+  void invalidRect(const CRect &iRect) override
+  {
+    fInvalidRects.emplace_back(iRect);
+  }
+
+  int fCellWork{0};
+  volatile int fChecksum{0};
+  std::vector<int> fDrawnCells{};
+  std::vector<CRect> fInvalidRects{};
+};
+
+// CustomView - testParamDirtyRect
+TEST(CustomView, testParamDirtyRect)
+{
+  auto view = VSTGUI::owned(new GridView());
+
+  // cell 9 => [20, 20, 40, 40] relative => offset by the position of the view
+  view->onParameterChange(1009);
+  ASSERT_EQ(1, view->fInvalidRects.size());
+  ASSERT_EQ(CRect(120, 70, 140, 90), view->fInvalidRects[0]);
+
+  // no dirty rect for this parameter => whole view
+  view->fInvalidRects.clear();
+  view->onParameterChange(2000);
+  ASSERT_EQ(1, view->fInvalidRects.size());
+  ASSERT_EQ(view->getViewSize(), view->fInvalidRects[0]);
+
+  // bounded by the view
+  view->fInvalidRects.clear();
+  view->markDirty(CRect{-10, -10, 10, 10});
+  ASSERT_EQ(CRect(100, 50, 110, 60), view->fInvalidRects[0]);
+
+  view->clearParamDirtyRects();
+  CRect rect{};
+  ASSERT_FALSE(view->getParamDirtyRect(1009, rect));
+}
+
+// CustomView - testUpdateRect
+TEST(CustomView, testUpdateRect)
+{
+  auto view = VSTGUI::owned(new GridView());
+
+  // outside of draw => everything needs to be drawn
+  ASSERT_TRUE(view->intersectsUpdateRect(GridView::computeCellRect(63)));
+
+  view->drawRect(nullptr, view->getViewSize());
+  ASSERT_EQ(64, view->fDrawnCells.size());
+
+  // only cell 9
+  view->fDrawnCells.clear();
+  view->drawRect(nullptr, CRect(120, 70, 140, 90));
+  ASSERT_EQ(std::vector<int>{9}, view->fDrawnCells);
+
+  ASSERT_EQ(nullptr, view->getDrawStats());
+  view->enableDrawStats();
+  view->drawRect(nullptr, CRect(120, 70, 140, 90));
+  ASSERT_EQ(1, view->getDrawStats()->fDrawCount);
+  ASSERT_EQ(CRect(20, 20, 40, 40), view->getDrawStats()->fLastUpdateRect);
+  view->enableDrawStats(false);
+  ASSERT_EQ(nullptr, view->getDrawStats());
+}
+
+// CustomView - benchmarkPartialRedraw (one cell changing in a 64 cells grid)
+TEST(CustomView, DISABLED_benchmarkPartialRedraw)
+{
+  constexpr int kIterations = 100;
+
+  auto view = VSTGUI::owned(new GridView());
+  view->fCellWork = 20000;
+
+  view->enableDrawStats();
+  for(int i = 0; i < kIterations; i++)
+    view->drawRect(nullptr, view->getViewSize());
+  auto fullDrawTime = view->getDrawStats()->getAverageDrawMilliseconds();
+
+  view->enableDrawStats();
+  for(int i = 0; i < kIterations; i++)
+  {
+    view->fInvalidRects.clear();
+    view->onParameterChange(static_cast<ParamID>(1000 + i % 64));
+    view->drawRect(nullptr, view->fInvalidRects[0]);
+  }
+  auto partialDrawTime = view->getDrawStats()->getAverageDrawMilliseconds();
+
+  std::cout << "CustomView draw (1 cell changed): " << partialDrawTime << "ms (full redraw: " << fullDrawTime << "ms)"
+            << std::endl;
+}
+
+}
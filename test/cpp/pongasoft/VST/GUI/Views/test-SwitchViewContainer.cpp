@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/GUI/Views/SwitchViewContainer.h>
+#include <pongasoft/VST/GUI/GUIController.h>
+#include <pongasoft/VST/Parameters.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+
+namespace pongasoft::VST::GUI::Views::TestSwitchViewContainer {
+
+//------------------------------------------------------------------------
+// MySwitchViewContainer - creates the templates without a uidesc
+//------------------------------------------------------------------------
+class MySwitchViewContainer : public SwitchViewContainer
+{
+public:
+  explicit MySwitchViewContainer(int iNumChildren) :
+    SwitchViewContainer(CRect{0, 0, 100, 100}),
+    fNumChildren{iNumChildren}
+  {}
+
+  using SwitchViewContainer::switchToTemplate;
+
+  CView *createTemplateView(std::string const &iTemplateName) override
+  {
+    fCreateCount[iTemplateName]++;
+    auto container = new CViewContainer(CRect{0, 0, 100, 100});
+    for(int i = 0; i < fNumChildren; i++)
+      container->addView(new CustomView(CRect{0, 0, 10, 10}));
+    return container;
+  }
+
+  CView *getCurrentView() const { return fCurrentView; }
+  std::string const &getCurrentTemplateName() const { return fCurrentTemplateName; }
+  int getCachedTemplateCount() const { return static_cast<int>(fTemplateCache.size()); }
+
+  int fNumChildren;
+  std::map<std::string, int> fCreateCount{};
+};
+
+// SwitchViewContainer - testTemplateCache
+TEST(SwitchViewContainer, testTemplateCache)
+{
+  // no cache (default) => view is created on every switch
+  {
+    auto sv = VSTGUI::owned(new MySwitchViewContainer(1));
+    sv->switchToTemplate("a");
+    sv->switchToTemplate("b");
+    sv->switchToTemplate("a");
+    ASSERT_EQ(2, sv->fCreateCount["a"]);
+    ASSERT_EQ(1, sv->fCreateCount["b"]);
+    ASSERT_EQ(0, sv->getCachedTemplateCount());
+    ASSERT_EQ(1, sv->getNbViews());
+  }
+
+  // LRU of size 1
+  {
+    auto sv = VSTGUI::owned(new MySwitchViewContainer(1));
+    sv->setTemplateCacheSize(1);
+    sv->switchToTemplate("a");
+    auto a = sv->getCurrentView();
+    sv->switchToTemplate("b");
+    ASSERT_FALSE(a->isVisible());
+    ASSERT_EQ(1, sv->getCachedTemplateCount());
+    ASSERT_EQ(2, sv->getNbViews());
+
+    // a comes from the cache
+    sv->switchToTemplate("a");
+    ASSERT_EQ(a, sv->getCurrentView());
+    ASSERT_TRUE(a->isVisible());
+    ASSERT_EQ(1, sv->fCreateCount["a"]);
+
+    // c evicts b (least recently used)
+    sv->switchToTemplate("c");
+    sv->switchToTemplate("b");
+    ASSERT_EQ(2, sv->fCreateCount["b"]);
+    sv->switchToTemplate("c");
+    ASSERT_EQ(1, sv->fCreateCount["c"]);
+    ASSERT_EQ(1, sv->getCachedTemplateCount());
+    ASSERT_EQ(2, sv->getNbViews());
+
+    // "_" => no view (current view is cached)
+    sv->switchToTemplate("_");
+    ASSERT_EQ(nullptr, sv->getCurrentView());
+    ASSERT_EQ(1, sv->getCachedTemplateCount());
+    sv->switchToTemplate("c");
+    ASSERT_EQ(1, sv->fCreateCount["c"]);
+
+    // disabling the cache discards the cached views
+    sv->setTemplateCacheSize(0);
+    ASSERT_EQ(0, sv->getCachedTemplateCount());
+    ASSERT_EQ(1, sv->getNbViews());
+  }
+
+  // keep all
+  {
+    auto sv = VSTGUI::owned(new MySwitchViewContainer(1));
+    sv->setTemplateCacheSize(-1);
+    for(int i = 0; i < 10; i++)
+    {
+      sv->switchToTemplate("a");
+      sv->switchToTemplate("b");
+      sv->switchToTemplate("c");
+    }
+    ASSERT_EQ(1, sv->fCreateCount["a"]);
+    ASSERT_EQ(1, sv->fCreateCount["b"]);
+    ASSERT_EQ(1, sv->fCreateCount["c"]);
+    ASSERT_EQ("c", sv->getCurrentTemplateName());
+    ASSERT_EQ(2, sv->getCachedTemplateCount());
+  }
+}
+
+enum ParamIDs : ParamID {
+  kRawVst = 1000
+};
+
+//------------------------------------------------------------------------
+// MyParameters
+//------------------------------------------------------------------------
+class MyParameters : public Parameters
+{
+public:
+  RawVstParam fRawVst;
+
+  MyParameters()
+  {
+    fRawVst = raw(ParamIDs::kRawVst, STR16("rawVst")).add();
+  }
+};
+
+//------------------------------------------------------------------------
+// MyController
+//------------------------------------------------------------------------
+class MyController : public GUIController
+{
+public:
+  MyController() : GUIController("JambaTestPlugin.uidesc"), fParams{}, fState{fParams}
+  {
+    // implementation note: this is only for testing! in real life scenario the host/DAW is the one
+    // instantiating the controller and calling initialize with a host context
+    initialize(nullptr);
+  }
+
+  ~MyController() override { terminate(); }
+
+  // getGUIState
+  GUIState *getGUIState() override { return &fState; }
+
+  bool raw(ParamValue iValue)
+  {
+    return getGUIState()->getRawVstParameter(ParamIDs::kRawVst)->update(iValue);
+  }
+
+  MyParameters fParams;
+  GUIPluginState<MyParameters> fState;
+};
+
+//------------------------------------------------------------------------
+// MyParamView - records the changes of the parameter it is connected to
+//------------------------------------------------------------------------
+class MyParamView : public CustomView
+{
+public:
+  MyParamView() : CustomView(CRect{0, 0, 10, 10}) {}
+
+  void registerParameters() override
+  {
+    fRawVst = registerRawVstParam(ParamIDs::kRawVst);
+  }
+
+  void onParameterChange(ParamID iParamID) override
+  {
+    fChangeCount++;
+    fLastValue = fRawVst.getValue();
+    CustomView::onParameterChange(iParamID);
+  }
+
+  GUIRawVstParam fRawVst{};
+  int fChangeCount{0};
+  ParamValue fLastValue{-1};
+};
+
+//------------------------------------------------------------------------
+// MyParamSwitchViewContainer - each template contains a MyParamView
+//------------------------------------------------------------------------
+class MyParamSwitchViewContainer : public SwitchViewContainer
+{
+public:
+  explicit MyParamSwitchViewContainer(GUIState *iGUIState) :
+    SwitchViewContainer(CRect{0, 0, 100, 100}),
+    fGUIState{iGUIState}
+  {}
+
+  using SwitchViewContainer::switchToTemplate;
+
+  // same steps as the view factory (CustomUIViewFactory)
+  CView *createTemplateView(std::string const &iTemplateName) override
+  {
+    auto container = new CViewContainer(CRect{0, 0, 100, 100});
+    auto view = new MyParamView();
+    view->initState(fGUIState);
+    view->registerParameters();
+    container->addView(view);
+    fParamViews[iTemplateName] = view;
+    return container;
+  }
+
+  GUIState *fGUIState;
+  std::map<std::string, MyParamView *> fParamViews{};
+};
+
+// SwitchViewContainer - testCachedViewCatchesUp (a parameter changes while the view is in the cache)
+TEST(SwitchViewContainer, testCachedViewCatchesUp)
+{
+  MyController c{};
+
+  auto sv = VSTGUI::owned(new MyParamSwitchViewContainer(c.getGUIState()));
+  sv->setTemplateCacheSize(-1);
+
+  sv->switchToTemplate("a");
+  auto a = sv->fParamViews["a"];
+  ASSERT_TRUE(c.raw(0.3));
+  ASSERT_EQ(1, a->fChangeCount);
+  ASSERT_EQ(0.3, a->fLastValue);
+
+  // a is hidden (cached) => not updated
+  sv->switchToTemplate("b");
+  auto b = sv->fParamViews["b"];
+  ASSERT_FALSE(a->isVisible());
+  ASSERT_TRUE(c.raw(0.5));
+  ASSERT_TRUE(c.raw(0.7));
+  ASSERT_EQ(1, a->fChangeCount);
+  ASSERT_EQ(0.3, a->fLastValue);
+  ASSERT_EQ(2, b->fChangeCount);
+  ASSERT_EQ(0.7, b->fLastValue);
+
+  // a is shown again => updated (once) with the latest value
+  sv->switchToTemplate("a");
+  ASSERT_EQ(a, sv->fParamViews["a"]);
+  ASSERT_TRUE(a->isVisible());
+  ASSERT_EQ(2, a->fChangeCount);
+  ASSERT_EQ(0.7, a->fLastValue);
+
+  // nothing changed while hidden => no update
+  sv->switchToTemplate("b");
+  ASSERT_EQ(2, b->fChangeCount); // b did not miss anything either
+  sv->switchToTemplate("a");
+  ASSERT_EQ(2, a->fChangeCount);
+
+  // a visible again => updated as usual
+  ASSERT_TRUE(c.raw(0.9));
+  ASSERT_EQ(3, a->fChangeCount);
+  ASSERT_EQ(0.9, a->fLastValue);
+  ASSERT_EQ(2, b->fChangeCount);
+}
+
+// benchmarkSwitching
+double benchmarkSwitching(int iTemplateCacheSize, int iIterations)
+{
+  auto sv = VSTGUI::owned(new MySwitchViewContainer(200));
+  sv->setTemplateCacheSize(iTemplateCacheSize);
+
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < iIterations; i++)
+  {
+    sv->switchToTemplate("a");
+    sv->switchToTemplate("b");
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / (2 * iIterations);
+}
+
+// SwitchViewContainer - benchmarkSwitching (repeated switching between 2 templates of 200 views each)
+TEST(SwitchViewContainer, DISABLED_benchmarkSwitching)
+{
+  constexpr int kIterations = 200;
+
+  auto noCacheTime = benchmarkSwitching(0, kIterations);
+  auto cacheTime = benchmarkSwitching(-1, kIterations);
+
+  std::cout << "SwitchViewContainer switch: " << cacheTime << "us (no cache: " << noCacheTime << "us)" << std::endl;
+}
+
+}
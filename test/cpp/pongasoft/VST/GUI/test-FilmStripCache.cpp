@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/GUI/FilmStripCache.h>
+#include <pongasoft/VST/GUI/DrawContext.h>
+#include <vstgui4/vstgui/lib/coffscreencontext.h>
+
+namespace pongasoft::VST::GUI::TestFilmStripCache {
+
+// FilmStripCache - testSlicing (hit/miss/scale factors)
+TEST(FilmStripCache, testSlicing)
+{
+  FilmStripCache cache{};
+
+  // 4 frames of 10x10
+  auto filmStrip = VSTGUI::makeOwned<CBitmap>(CPoint{10, 40});
+
+  // out of range => nothing sliced
+  ASSERT_EQ(nullptr, cache.getFrame(filmStrip, 4, 4, 1.0));
+  ASSERT_EQ(nullptr, cache.getFrame(filmStrip, 4, -1, 1.0));
+  ASSERT_EQ(nullptr, cache.getFrame(filmStrip, 0, 0, 1.0));
+  ASSERT_EQ(nullptr, cache.getFrame(nullptr, 4, 0, 1.0));
+  ASSERT_EQ(0, cache.getFilmStripCount());
+
+  auto frame = cache.getFrame(filmStrip, 4, 1, 1.0);
+  if(!frame)
+    GTEST_SKIP() << "offscreen rendering not available";
+
+  ASSERT_EQ(1, cache.getFilmStripCount());
+  ASSERT_EQ(10, frame->getWidth());
+  ASSERT_EQ(10, frame->getHeight());
+  ASSERT_EQ(1, cache.getStats().fSlices);
+  ASSERT_EQ(0, cache.getStats().fHits);
+
+  // same frame => hit
+  ASSERT_EQ(frame.get(), cache.getFrame(filmStrip, 4, 1, 1.0).get());
+  ASSERT_EQ(1, cache.getStats().fSlices);
+  ASSERT_EQ(1, cache.getStats().fHits);
+
+  // other frame => sliced
+  auto frame2 = cache.getFrame(filmStrip, 4, 2, 1.0);
+  ASSERT_NE(nullptr, frame2.get());
+  ASSERT_NE(frame.get(), frame2.get());
+  ASSERT_EQ(2, cache.getStats().fSlices);
+
+  // other scale factor => sliced separately
+  auto frameHiDPI = cache.getFrame(filmStrip, 4, 1, 2.0);
+  ASSERT_NE(nullptr, frameHiDPI.get());
+  ASSERT_NE(frame.get(), frameHiDPI.get());
+  ASSERT_EQ(3, cache.getStats().fSlices);
+  ASSERT_EQ(1, cache.getFilmStripCount());
+
+  // same bitmap seen as a different number of frames => different entry
+  ASSERT_NE(nullptr, cache.getFrame(filmStrip, 2, 0, 1.0).get());
+  ASSERT_EQ(2, cache.getFilmStripCount());
+
+  cache.resetStats();
+  ASSERT_EQ(0, cache.getStats().fSlices);
+  ASSERT_EQ(0, cache.getStats().fHits);
+}
+
+// FilmStripCache - testZoom (the zoom of the context is part of the scale factor)
+TEST(FilmStripCache, testZoom)
+{
+  FilmStripCache cache{};
+
+  auto filmStrip = VSTGUI::makeOwned<CBitmap>(CPoint{10, 20});
+  auto context = COffscreenContext::create(CPoint{20, 20}, 1.0);
+  if(!context)
+    GTEST_SKIP() << "offscreen rendering not available";
+
+  context->beginDraw();
+
+  ASSERT_EQ(1.0, getBitmapScaleFactor(context.get()));
+
+  // zoom x2 => sliced at 2x
+  {
+    CDrawContext::Transform zoom{*context, CGraphicsTransform().scale(2.0, 2.0)};
+    ASSERT_EQ(2.0, getBitmapScaleFactor(context.get()));
+    cache.drawFrame(context.get(), filmStrip, 2, 0, CRect{0, 0, 10, 10});
+    ASSERT_EQ(1, cache.getStats().fSlices);
+    ASSERT_NE(nullptr, cache.getFrame(filmStrip, 2, 0, 2.0).get());
+    ASSERT_EQ(1, cache.getStats().fHits);
+  }
+
+  // no zoom => sliced separately
+  cache.drawFrame(context.get(), filmStrip, 2, 0, CRect{0, 0, 10, 10});
+  ASSERT_EQ(2, cache.getStats().fSlices);
+
+  // rotation => no single resolution => drawn directly
+  {
+    CDrawContext::Transform rotation{*context, CGraphicsTransform().rotate(45.0)};
+    ASSERT_FALSE(getBitmapScaleFactor(context.get()).has_value());
+    cache.drawFrame(context.get(), filmStrip, 2, 1, CRect{0, 0, 10, 10});
+    ASSERT_EQ(2, cache.getStats().fSlices);
+    ASSERT_EQ(1, cache.getStats().fFallbacks);
+  }
+
+  context->endDraw();
+}
+
+// FilmStripCache - testPurge (only the filmstrips no longer referenced outside the cache are released)
+TEST(FilmStripCache, testPurge)
+{
+  FilmStripCache cache{};
+
+  auto filmStrip1 = VSTGUI::makeOwned<CBitmap>(CPoint{10, 20});
+  auto filmStrip2 = VSTGUI::makeOwned<CBitmap>(CPoint{10, 20});
+
+  if(!cache.getFrame(filmStrip1, 2, 0, 1.0))
+    GTEST_SKIP() << "offscreen rendering not available";
+
+  ASSERT_NE(nullptr, cache.getFrame(filmStrip2, 2, 0, 1.0).get());
+  ASSERT_EQ(2, cache.getFilmStripCount());
+
+  // the cache keeps the filmstrips alive
+  ASSERT_EQ(2, filmStrip1->getNbReference());
+
+  // still used => kept
+  cache.purge();
+  ASSERT_EQ(2, cache.getFilmStripCount());
+
+  // no longer used outside the cache => released
+  CBitmap *released = filmStrip1;
+  filmStrip1 = nullptr;
+  ASSERT_EQ(1, released->getNbReference());
+  cache.purge();
+  ASSERT_EQ(1, cache.getFilmStripCount());
+
+  // a new filmstrip triggers a purge
+  filmStrip2 = nullptr;
+  auto filmStrip3 = VSTGUI::makeOwned<CBitmap>(CPoint{10, 20});
+  ASSERT_NE(nullptr, cache.getFrame(filmStrip3, 2, 1, 1.0).get());
+  ASSERT_EQ(1, cache.getFilmStripCount());
+
+  // clear releases everything
+  cache.clear();
+  ASSERT_EQ(0, cache.getFilmStripCount());
+  ASSERT_EQ(1, filmStrip3->getNbReference());
+}
+
+// FilmStripCache - testUsers (the last user clears the cache)
+TEST(FilmStripCache, testUsers)
+{
+  FilmStripCache cache{};
+
+  auto filmStrip = VSTGUI::makeOwned<CBitmap>(CPoint{10, 20});
+  if(!cache.getFrame(filmStrip, 2, 0, 1.0))
+    GTEST_SKIP() << "offscreen rendering not available";
+
+  cache.acquire();
+  cache.acquire();
+  ASSERT_EQ(2, cache.getUserCount());
+
+  // still one user => kept
+  cache.release();
+  ASSERT_EQ(1, cache.getUserCount());
+  ASSERT_EQ(1, cache.getFilmStripCount());
+
+  // last user => cleared
+  cache.release();
+  ASSERT_EQ(0, cache.getUserCount());
+  ASSERT_EQ(0, cache.getFilmStripCount());
+  ASSERT_EQ(1, filmStrip->getNbReference());
+}
+
+// FilmStripCache - testDisabled
+TEST(FilmStripCache, testDisabled)
+{
+  FilmStripCache cache{};
+
+  auto filmStrip = VSTGUI::makeOwned<CBitmap>(CPoint{10, 20});
+  if(!cache.getFrame(filmStrip, 2, 0, 1.0))
+    GTEST_SKIP() << "offscreen rendering not available";
+
+  ASSERT_TRUE(cache.isEnabled());
+  cache.setEnabled(false);
+  ASSERT_FALSE(cache.isEnabled());
+
+  // disabling the cache releases the slices
+  ASSERT_EQ(0, cache.getFilmStripCount());
+  ASSERT_EQ(1, filmStrip->getNbReference());
+  ASSERT_EQ(0, cache.getStats().fFallbacks);
+}
+
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/GUI/GUIController.h>
+#include <pongasoft/VST/GUI/Views/CustomViewCreator.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace pongasoft::VST::GUI::TestGUIController {
+
+// the ui description of the test plugin (defined in jamba-test-plugin/CMakeLists.txt)
+#ifdef JAMBA_TEST_PLUGIN_UIDESC
+
+constexpr int kViewCopies = 20;
+
+//------------------------------------------------------------------------
+// createScaledUIDescription
+// Adds a template (`benchmark_view`) made of iCopies of the main view to the test plugin ui description and writes
+// it to a temporary file
+//------------------------------------------------------------------------
+std::string createScaledUIDescription(int iCopies)
+{
+  std::ifstream in{JAMBA_TEST_PLUGIN_UIDESC};
+  std::stringstream content;
+  content << in.rdbuf();
+  auto uidesc = content.str();
+
+  std::string templates = "\"templates\": {";
+  auto pos = uidesc.find(templates);
+  if(pos == std::string::npos)
+    return "";
+
+  std::ostringstream view;
+  view << R"("benchmark_view": { "attributes": { "class": "CViewContainer", "origin": "0, 0", "size": "720, 600" },)"
+       << R"( "children": {)";
+  for(int i = 0; i < iCopies; i++)
+  {
+    if(i > 0)
+      view << ",";
+    view << R"( "CViewContainer": { "attributes": { "class": "CViewContainer", "origin": "0, 0", "size": "720, 600",)"
+         << R"( "template": "view" } })";
+  }
+  view << "} },";
+
+  uidesc.insert(pos + templates.size(), view.str());
+
+  auto path = (std::filesystem::temp_directory_path() / "JambaTestPlugin-benchmark.uidesc").string();
+  std::ofstream out{path};
+  out << uidesc;
+  return path;
+}
+
+//------------------------------------------------------------------------
+// TestController
+//------------------------------------------------------------------------
+class TestController : public GUIController
+{
+public:
+  // Constructor (iXmlFileName must outlive the controller)
+  explicit TestController(char const *iXmlFileName) :
+    GUIController(iXmlFileName), fParams{}, fState{fParams}
+  {
+    // implementation note: this is only for testing! in real life scenario the host/DAW is the one
+    // instantiating the controller and calling initialize with a host context
+    initialize(nullptr);
+  }
+
+  ~TestController() override
+  {
+    if(!fTerminated)
+      terminate();
+  }
+
+  // terminate
+  tresult terminate() override
+  {
+    fTerminated = true;
+    return GUIController::terminate();
+  }
+
+  // getGUIState
+  GUIState *getGUIState() override { return &fState; }
+
+  /**
+   * Same steps as opening the editor (minus the platform window): load/parse the description and create the
+   * views. When iWarm is false, the description is released first (which is the behavior prior to caching). */
+  bool openEditor(bool iWarm, char const *iViewName = "view")
+  {
+    if(!iWarm)
+      releaseUIDescription();
+
+    auto description = getUIDescription();
+    if(!description)
+      return false;
+
+    auto view = VSTGUI::owned(description->createView(iViewName, nullptr));
+    return view != nullptr;
+  }
+
+  using GUIController::getUIDescription;
+  using GUIController::releaseUIDescription;
+  using GUIController::enableUIDescriptionCache;
+  using GUIController::getAttributeConversionCache;
+  using GUIController::willClose;
+
+  Parameters fParams;
+  GUIPluginState<Parameters> fState;
+  bool fTerminated{false};
+};
+
+//------------------------------------------------------------------------
+// SilenceWarnings (the views are not connected to actual parameters)
+//------------------------------------------------------------------------
+struct SilenceWarnings
+{
+  SilenceWarnings() : fVerbosity{loguru::g_stderr_verbosity} { loguru::g_stderr_verbosity = loguru::Verbosity_ERROR; }
+  ~SilenceWarnings() { loguru::g_stderr_verbosity = fVerbosity; }
+  loguru::Verbosity fVerbosity;
+};
+
+// GUIController - testUIDescriptionReused
+TEST(GUIController, testUIDescriptionReused)
+{
+  SilenceWarnings silence{};
+  TestController controller{JAMBA_TEST_PLUGIN_UIDESC};
+
+  auto description = controller.getUIDescription();
+  ASSERT_TRUE(description);
+
+  // same description across editor opens/closes
+  ASSERT_TRUE(controller.openEditor(true));
+  controller.willClose(nullptr);
+  ASSERT_TRUE(controller.openEditor(true));
+  ASSERT_EQ(description.get(), controller.getUIDescription().get());
+}
+
+// GUIController - testUIDescriptionReleased
+TEST(GUIController, testUIDescriptionReleased)
+{
+  SilenceWarnings silence{};
+
+  // released when the editor closes if the cache is disabled
+  {
+    TestController controller{JAMBA_TEST_PLUGIN_UIDESC};
+    controller.enableUIDescriptionCache(false);
+
+    auto description = controller.getUIDescription();
+    ASSERT_TRUE(description);
+    ASSERT_GT(description->getNbReference(), 1);
+    controller.willClose(nullptr);
+    ASSERT_EQ(1, description->getNbReference()); // only this test holds it
+
+    auto newDescription = controller.getUIDescription();
+    ASSERT_TRUE(newDescription);
+    ASSERT_NE(description.get(), newDescription.get());
+  }
+
+  // released on terminate
+  {
+    TestController controller{JAMBA_TEST_PLUGIN_UIDESC};
+
+    auto description = controller.getUIDescription();
+    ASSERT_TRUE(description);
+    controller.willClose(nullptr);
+    ASSERT_GT(description->getNbReference(), 1); // still cached
+
+    controller.terminate();
+    ASSERT_EQ(1, description->getNbReference());
+    ASSERT_EQ(nullptr, controller.getAttributeConversionCache());
+  }
+}
+
+// GUIController - testAttributeConversionCache
+TEST(GUIController, testAttributeConversionCache)
+{
+  SilenceWarnings silence{};
+  TestController controller{JAMBA_TEST_PLUGIN_UIDESC};
+
+  auto cache = controller.getAttributeConversionCache();
+  ASSERT_TRUE(cache != nullptr);
+
+  // the cache belongs to the factory used by the description
+  auto description = controller.getUIDescription();
+  ASSERT_EQ(cache, Views::AttributeConversionCache::from(description.get()));
+
+  if(!cache->isEnabled())
+    GTEST_SKIP() << "The cache is disabled in editor mode";
+
+  // first open: every value is converted
+  ASSERT_TRUE(controller.openEditor(true));
+  ASSERT_GT(cache->getStats().fMisses, 0);
+
+  // second open: every value comes from the cache
+  cache->resetStats();
+  ASSERT_TRUE(controller.openEditor(true));
+  ASSERT_GT(cache->getStats().fHits, 0);
+  ASSERT_EQ(0, cache->getStats().fMisses);
+
+  // invalidate => values are converted again
+  cache->invalidate();
+  cache->resetStats();
+  ASSERT_TRUE(controller.openEditor(true));
+  ASSERT_GT(cache->getStats().fMisses, 0);
+
+  // releasing the description invalidates the cache as well
+  cache->resetStats();
+  ASSERT_TRUE(controller.openEditor(false));
+  ASSERT_GT(cache->getStats().fMisses, 0);
+  auto misses = cache->getStats().fMisses;
+
+  // the cache is per controller
+  {
+    TestController otherController{JAMBA_TEST_PLUGIN_UIDESC};
+    ASSERT_NE(cache, otherController.getAttributeConversionCache());
+    ASSERT_TRUE(otherController.openEditor(true));
+    ASSERT_EQ(misses, otherController.getAttributeConversionCache()->getStats().fMisses);
+  }
+  ASSERT_EQ(misses, cache->getStats().fMisses);
+
+  // disabled => no caching at all
+  cache->setEnabled(false);
+  cache->resetStats();
+  ASSERT_TRUE(controller.openEditor(true));
+  ASSERT_EQ(0, cache->getStats().fHits);
+  ASSERT_EQ(0, cache->getStats().fMisses);
+}
+
+// GUIController - benchmarkEditorOpen (cold: parse + convert every time vs warm: cached description and conversions)
+TEST(GUIController, DISABLED_benchmarkEditorOpen)
+{
+  constexpr int kIterations = 10;
+
+  auto xmlFile = createScaledUIDescription(kViewCopies);
+  ASSERT_FALSE(xmlFile.empty());
+
+  SilenceWarnings silence{};
+
+  {
+    TestController controller{xmlFile.c_str()};
+
+    auto measure = [&controller](bool iWarm) {
+      auto start = std::chrono::steady_clock::now();
+      for(int i = 0; i < kIterations; i++)
+        EXPECT_TRUE(controller.openEditor(iWarm, "benchmark_view"));
+      return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kIterations;
+    };
+
+    auto coldTime = measure(false);
+
+    auto cache = controller.getAttributeConversionCache();
+    cache->resetStats();
+    auto warmTime = measure(true);
+    auto stats = cache->getStats();
+
+    std::cout << "Editor open (" << kViewCopies << "x main view): cold " << coldTime << "ms, warm " << warmTime << "ms"
+              << " (attribute conversions: " << stats.fHits << " hits / " << stats.fMisses << " misses)" << std::endl;
+  }
+
+  std::filesystem::remove(xmlFile);
+}
+
+#endif
+
+}
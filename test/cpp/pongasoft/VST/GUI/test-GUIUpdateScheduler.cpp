@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/GUI/GUIUpdateScheduler.h>
+#include <pongasoft/VST/GUI/Params/GUIValParameter.h>
+#include <pongasoft/VST/VstUtils/Utils.h>
+
+#include <vector>
+
+namespace pongasoft::VST::GUI::TestGUIUpdateScheduler {
+
+using namespace Params;
+
+// GUIUpdateScheduler - testCollapse
+TEST(GUIUpdateScheduler, testCollapse)
+{
+  auto scheduler = std::make_shared<GUIUpdateScheduler>();
+
+  auto p1 = VstUtils::make_sfo<GUIValParameter<int>>(1, 0);
+  auto p2 = VstUtils::make_sfo<GUIValParameter<int>>(2, 0);
+
+  std::vector<int> values{};
+
+  auto cx1 = p1->connect([&values, &p1]() { values.emplace_back(p1->getValue()); });
+  auto cx2 = p2->connect([&values, &p2]() { values.emplace_back(p2->getValue()); });
+
+  // no scheduler => synchronous
+  p1->update(1);
+  ASSERT_EQ(std::vector<int>{1}, values);
+  values.clear();
+
+  cx1->setScheduler(scheduler);
+  cx2->setScheduler(scheduler);
+
+  p1->update(10);
+  p1->update(11);
+  p2->update(20);
+  p1->update(12);
+  ASSERT_TRUE(values.empty());
+  ASSERT_EQ(2, scheduler->getPendingCount());
+  ASSERT_TRUE(scheduler->isRunning());
+
+  // delivered once per listener (in order of first notification), with the latest value
+  scheduler->flush();
+  ASSERT_EQ((std::vector<int>{12, 20}), values);
+  ASSERT_EQ(0, scheduler->getPendingCount());
+  ASSERT_EQ(4, scheduler->getStats().fReceivedCount);
+  ASSERT_EQ(2, scheduler->getStats().fDeliveredCount);
+
+  // closed connection => not delivered
+  values.clear();
+  p1->update(13);
+  p2->update(21);
+  cx1->close();
+  scheduler->flush();
+  ASSERT_EQ(std::vector<int>{21}, values);
+
+  // suspended connection => delivered on resume
+  values.clear();
+  p2->update(22);
+  cx2->suspend();
+  scheduler->flush();
+  ASSERT_TRUE(values.empty());
+  cx2->resume();
+  ASSERT_EQ(std::vector<int>{22}, values);
+
+  // 0 fps => immediate
+  values.clear();
+  scheduler->setFramesPerSecond(0);
+  p2->update(23);
+  p2->update(24);
+  ASSERT_EQ((std::vector<int>{23, 24}), values);
+
+  scheduler->resetStats();
+  ASSERT_EQ(0, scheduler->getStats().fReceivedCount);
+}
+
+// GUIUpdateScheduler - testCloseWhileDelivering
+TEST(GUIUpdateScheduler, testCloseWhileDelivering)
+{
+  auto scheduler = std::make_shared<GUIUpdateScheduler>();
+
+  auto p = VstUtils::make_sfo<GUIValParameter<int>>(1, 0);
+
+  int count = 0;
+  std::unique_ptr<FObjectCx> cx2{};
+
+  // the first callback closes the second connection
+  auto cx1 = p->connect([&cx2, &count]() { count++; cx2 = nullptr; });
+  cx2 = p->connect([&count]() { count++; });
+
+  cx1->setScheduler(scheduler);
+  cx2->setScheduler(scheduler);
+
+  p->update(1);
+  scheduler->flush();
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(nullptr, cx2);
+}
+
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTBlockAccumulator.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTBlockAccumulator {
+
+constexpr int32 kNumChannels = 2;
+constexpr int32 kMaxBlockSize = 1024;
+
+//------------------------------------------------------------------------
+// Block: one (stereo) input bus and one output bus
+//------------------------------------------------------------------------
+struct Block
+{
+  Block()
+  {
+    for(int32 c = 0; c < kNumChannels; c++)
+    {
+      fInPtrs[c] = fIn[c].data();
+      fOutPtrs[c] = fOut[c].data();
+    }
+    fInBus.numChannels = kNumChannels;
+    fInBus.channelBuffers32 = fInPtrs;
+    fOutBus.numChannels = kNumChannels;
+    fOutBus.channelBuffers32 = fOutPtrs;
+
+    fData.processMode = kOffline;
+    fData.symbolicSampleSize = kSample32;
+    fData.numInputs = 1;
+    fData.inputs = &fInBus;
+    fData.numOutputs = 1;
+    fData.outputs = &fOutBus;
+  }
+
+  std::vector<Sample32> fIn[kNumChannels]{std::vector<Sample32>(kMaxBlockSize), std::vector<Sample32>(kMaxBlockSize)};
+  std::vector<Sample32> fOut[kNumChannels]{std::vector<Sample32>(kMaxBlockSize), std::vector<Sample32>(kMaxBlockSize)};
+  Sample32 *fInPtrs[kNumChannels]{};
+  Sample32 *fOutPtrs[kNumChannels]{};
+  AudioBusBuffers fInBus{};
+  AudioBusBuffers fOutBus{};
+  ProcessData fData{};
+};
+
+// gain (the processing: out = 2 * in)
+tresult gain(ProcessData &data)
+{
+  for(int32 c = 0; c < data.outputs[0].numChannels; c++)
+    for(int32 i = 0; i < data.numSamples; i++)
+      data.outputs[0].channelBuffers32[c][i] = 2 * data.inputs[0].channelBuffers32[c][i];
+  return kResultOk;
+}
+
+// RTBlockAccumulator - testAlignment (output delayed by exactly the internal block size whatever the host blocks)
+TEST(RTBlockAccumulator, testAlignment)
+{
+  constexpr int32 kBlockSize = 256;
+
+  RTBlockAccumulator accumulator{};
+  ASSERT_FALSE(accumulator.isEnabled());
+  accumulator.setup(kSample32, {kNumChannels}, {kNumChannels}, kBlockSize);
+  ASSERT_TRUE(accumulator.isEnabled());
+
+  Block block{};
+  std::vector<int32> blockSizes{32, 100, 1, 256, 1000, 0, 7};
+  std::vector<int32> internalBlockSizes{};
+
+  int32 position = 0;
+  for(int b = 0; b < 30; b++)
+  {
+    auto n = blockSizes[b % blockSizes.size()];
+    block.fData.numSamples = n;
+    for(int32 c = 0; c < kNumChannels; c++)
+      for(int32 i = 0; i < n; i++)
+        block.fIn[c][i] = static_cast<Sample32>((c + 1) * (position + i + 1));
+
+    ASSERT_EQ(kResultOk, accumulator.process(block.fData, [&internalBlockSizes](ProcessData &data) {
+      // parameter changes and events do not apply to the internal block
+      EXPECT_EQ(nullptr, data.inputParameterChanges);
+      EXPECT_EQ(nullptr, data.inputEvents);
+      internalBlockSizes.emplace_back(data.numSamples);
+      return gain(data);
+    }));
+
+    for(int32 c = 0; c < kNumChannels; c++)
+    {
+      for(int32 i = 0; i < n; i++)
+      {
+        auto p = position + i - kBlockSize;
+        ASSERT_EQ(p < 0 ? 0 : 2 * (c + 1) * (p + 1), block.fOut[c][i]) << "block " << b << " sample " << i;
+      }
+    }
+
+    position += n;
+  }
+
+  // only full internal blocks were processed (the empty host block being processed directly)
+  ASSERT_EQ(position / kBlockSize + 4, internalBlockSizes.size());
+  ASSERT_EQ(position / kBlockSize, accumulator.getProcessedBlockCount());
+  for(auto s: internalBlockSizes)
+    ASSERT_TRUE(s == kBlockSize || s == 0);
+}
+
+// RTBlockAccumulator - testMismatch (buses not matching the setup => processed directly)
+TEST(RTBlockAccumulator, testMismatch)
+{
+  RTBlockAccumulator accumulator{};
+  accumulator.setup(kSample32, {1}, {1}, 256);
+
+  Block block{};
+  block.fData.numSamples = 64;
+  std::fill(block.fIn[0].begin(), block.fIn[0].end(), 1.0f);
+
+  int32 processed = 0;
+  accumulator.process(block.fData, [&processed](ProcessData &data) { processed += data.numSamples; return gain(data); });
+  ASSERT_EQ(64, processed);
+  ASSERT_EQ(2.0f, block.fOut[0][0]);
+
+  // 64 bits not allocated => direct
+  accumulator.setup(kSample64, {kNumChannels}, {kNumChannels}, 256);
+  processed = 0;
+  accumulator.process(block.fData, [&processed](ProcessData &data) { processed += data.numSamples; return gain(data); });
+  ASSERT_EQ(64, processed);
+}
+
+// RTBlockAccumulator - testResult (the first error returned while processing the internal blocks is returned)
+TEST(RTBlockAccumulator, testResult)
+{
+  RTBlockAccumulator accumulator{};
+  accumulator.setup(kSample32, {kNumChannels}, {kNumChannels}, 16);
+
+  Block block{};
+  block.fData.numSamples = 64; // => 4 internal blocks
+
+  std::vector<tresult> results{kResultOk, kInvalidArgument, kResultFalse, kResultOk};
+  size_t count = 0;
+  ASSERT_EQ(kInvalidArgument, accumulator.process(block.fData, [&results, &count](ProcessData &data) {
+    gain(data);
+    return results[count++];
+  }));
+  ASSERT_EQ(4, count);
+
+  ASSERT_EQ(kResultOk, accumulator.process(block.fData, [](ProcessData &data) { return gain(data); }));
+}
+
+// RTBlockAccumulator - benchmarkThroughput (offline render with small host blocks and a per block overhead)
+TEST(RTBlockAccumulator, DISABLED_benchmarkThroughput)
+{
+  constexpr int32 kHostBlockSize = 32;
+  constexpr int32 kNumSamples = 44100 * 20;
+
+  // a processing with a per block cost (ex: filter coefficients computation) and a per sample cost
+  auto process = [](ProcessData &data) {
+    Sample32 coefficient = 0;
+    for(int k = 1; k <= 64; k++)
+      coefficient += std::sin(0.01f * k) / static_cast<Sample32>(k);
+    for(int32 c = 0; c < data.outputs[0].numChannels; c++)
+      for(int32 i = 0; i < data.numSamples; i++)
+        data.outputs[0].channelBuffers32[c][i] = coefficient * data.inputs[0].channelBuffers32[c][i];
+    return kResultOk;
+  };
+
+  auto run = [&process](int32 iInternalBlockSize) {
+    RTBlockAccumulator accumulator{};
+    accumulator.setup(kSample32, {kNumChannels}, {kNumChannels}, iInternalBlockSize);
+
+    Block block{};
+    block.fData.numSamples = kHostBlockSize;
+    for(int32 c = 0; c < kNumChannels; c++)
+      for(int32 i = 0; i < kHostBlockSize; i++)
+        block.fIn[c][i] = std::sin(0.01f * i);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int32 s = 0; s < kNumSamples; s += kHostBlockSize)
+      accumulator.process(block.fData, process);
+    auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return kNumSamples / time / 1e6;
+  };
+
+  std::cout << "Offline throughput (host blocks of " << kHostBlockSize << " samples): direct " << run(0)
+            << " Msamples/s";
+  for(int32 internalBlockSize: {512, 4096})
+    std::cout << ", accumulated (" << internalBlockSize << ") " << run(internalBlockSize) << " Msamples/s";
+  std::cout << std::endl;
+}
+
+}
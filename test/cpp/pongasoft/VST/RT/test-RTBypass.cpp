@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTBypass.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTBypass {
+
+constexpr int32 kNumChannels = 2;
+constexpr int32 kBlockSize = 64;
+
+//------------------------------------------------------------------------
+// Block: one (stereo) input bus and one output bus (which can share the same buffers)
+//------------------------------------------------------------------------
+struct Block
+{
+  explicit Block(bool iInPlace = false)
+  {
+    for(int32 c = 0; c < kNumChannels; c++)
+    {
+      fInPtrs[c] = fIn[c].data();
+      fOutPtrs[c] = iInPlace ? fIn[c].data() : fOut[c].data();
+    }
+    fInBus.numChannels = kNumChannels;
+    fInBus.channelBuffers32 = fInPtrs;
+    fOutBus.numChannels = kNumChannels;
+    fOutBus.channelBuffers32 = fOutPtrs;
+
+    fData.processMode = kRealtime;
+    fData.symbolicSampleSize = kSample32;
+    fData.numSamples = kBlockSize;
+    fData.numInputs = 1;
+    fData.inputs = &fInBus;
+    fData.numOutputs = 1;
+    fData.outputs = &fOutBus;
+  }
+
+  std::vector<Sample32> fIn[kNumChannels]{std::vector<Sample32>(kBlockSize), std::vector<Sample32>(kBlockSize)};
+  std::vector<Sample32> fOut[kNumChannels]{std::vector<Sample32>(kBlockSize), std::vector<Sample32>(kBlockSize)};
+  Sample32 *fInPtrs[kNumChannels]{};
+  Sample32 *fOutPtrs[kNumChannels]{};
+  AudioBusBuffers fInBus{};
+  AudioBusBuffers fOutBus{};
+  ProcessData fData{};
+};
+
+// processBlock (iProcess being the processing (wet) which is only called when not fully bypassed)
+template<typename Process>
+bool processBlock(RTBypass &iBypass, Block &iBlock, bool iBypassed, uint32 iLatency, Process &&iProcess)
+{
+  if(!iBypass.beginBlock(iBlock.fData, iBypassed, iLatency))
+    return false;
+  iProcess(iBlock);
+  iBypass.endBlock(iBlock.fData);
+  return true;
+}
+
+// silence (the processing outputs 0)
+void silence(Block &iBlock)
+{
+  for(int32 c = 0; c < kNumChannels; c++)
+    std::fill(iBlock.fOutPtrs[c], iBlock.fOutPtrs[c] + kBlockSize, 0.0f);
+}
+
+// RTBypass - testFullyBypassed
+TEST(RTBypass, testFullyBypassed)
+{
+  RTBypass bypass{};
+  bypass.setup(kSample32, kNumChannels, 64, kBlockSize);
+  bypass.reset(true);
+  ASSERT_TRUE(bypass.isFullyBypassed());
+
+  Block block{};
+  for(int32 i = 0; i < kBlockSize; i++)
+    block.fIn[0][i] = block.fIn[1][i] = static_cast<Sample32>(i + 1);
+
+  // no latency => input copied to output, processing not called
+  ASSERT_FALSE(processBlock(bypass, block, true, 0, [](Block &) { FAIL(); }));
+  ASSERT_EQ(block.fIn[0], block.fOut[0]);
+  ASSERT_EQ(block.fIn[1], block.fOut[1]);
+
+  // latency => input delayed
+  bypass.reset(true);
+  ASSERT_FALSE(processBlock(bypass, block, true, 10, [](Block &) { FAIL(); }));
+  for(int32 i = 0; i < kBlockSize; i++)
+    ASSERT_EQ(i < 10 ? 0 : i + 1 - 10, block.fOut[0][i]);
+
+  // in place (same buffers) => nothing to do
+  Block inPlace{true};
+  for(int32 i = 0; i < kBlockSize; i++)
+    inPlace.fIn[0][i] = static_cast<Sample32>(i + 1);
+  ASSERT_FALSE(processBlock(bypass, inPlace, true, 0, [](Block &) { FAIL(); }));
+  ASSERT_EQ(1.0f, inPlace.fIn[0][0]);
+  ASSERT_EQ(64.0f, inPlace.fIn[0][63]);
+}
+
+// RTBypass - testCrossfade (no jump larger than one crossfade step when the bypass state changes)
+TEST(RTBypass, testCrossfade)
+{
+  constexpr int32 kCrossfadeSamples = 200;
+
+  RTBypass bypass{};
+  bypass.setCrossfadeSamples(kCrossfadeSamples);
+  bypass.setup(kSample32, kNumChannels, 0, kBlockSize);
+  bypass.reset(false);
+
+  Block block{};
+  for(int32 c = 0; c < kNumChannels; c++)
+    std::fill(block.fIn[c].begin(), block.fIn[c].end(), 1.0f);
+
+  std::vector<Sample32> output{};
+  auto run = [&](bool iBypassed, int iBlocks) {
+    int processed = 0;
+    for(int b = 0; b < iBlocks; b++)
+    {
+      if(processBlock(bypass, block, iBypassed, 0, silence))
+        processed++;
+      output.insert(output.end(), block.fOut[0].begin(), block.fOut[0].end());
+      EXPECT_EQ(block.fOut[0], block.fOut[1]);
+    }
+    return processed;
+  };
+
+  // processing (silence)
+  ASSERT_EQ(2, run(false, 2));
+
+  // bypass => crossfade over 200 samples (4 blocks) then fully bypassed (processing not called anymore)
+  ASSERT_EQ(4, run(true, 6));
+  ASSERT_TRUE(bypass.isFullyBypassed());
+
+  // back to processing
+  ASSERT_EQ(6, run(false, 6));
+  ASSERT_EQ(0.0, bypass.getMix());
+
+  for(size_t i = 1; i < output.size(); i++)
+    ASSERT_LE(std::abs(output[i] - output[i - 1]), 1.0f / kCrossfadeSamples + 1e-6f) << "at " << i;
+  ASSERT_EQ(0.0f, output[2 * kBlockSize - 1]);
+  ASSERT_EQ(1.0f, output[6 * kBlockSize]);
+  ASSERT_EQ(0.0f, output.back());
+}
+
+// RTBypass - testLatencyCompensation (the dry path is aligned with the processing => no artifact while crossfading)
+TEST(RTBypass, testLatencyCompensation)
+{
+  constexpr int32 kLatency = 23;
+
+  // crossfade longer than the toggles below => never fully bypassed (the processing, which has a state, is always
+  // called)
+  RTBypass bypass{};
+  bypass.setCrossfadeSamples(1000);
+  bypass.setup(kSample32, kNumChannels, 64, kBlockSize);
+  bypass.reset(false);
+
+  // the processing is a pure delay of kLatency samples
+  RTDelayLine<Sample32> wet{};
+  wet.setup(kNumChannels, kLatency, kBlockSize);
+  wet.setDelay(kLatency);
+  auto process = [&wet](Block &iBlock) {
+    AudioBuffers32 in{iBlock.fInBus, kBlockSize};
+    AudioBuffers32 out{iBlock.fOutBus, kBlockSize};
+    wet.process(in, out);
+  };
+
+  Block block{};
+  int32 position = 0;
+  for(int b = 0; b < 20; b++)
+  {
+    for(int32 c = 0; c < kNumChannels; c++)
+      for(int32 i = 0; i < kBlockSize; i++)
+        block.fIn[c][i] = static_cast<Sample32>(position + i + 1);
+
+    // toggles the bypass every 3 blocks
+    ASSERT_TRUE(processBlock(bypass, block, (b / 3) % 2 == 1, kLatency, process));
+
+    for(int32 i = 0; i < kBlockSize; i++)
+    {
+      auto p = position + i - kLatency;
+      ASSERT_NEAR(p < 0 ? 0 : p + 1, block.fOut[0][i], 1e-3) << "block " << b << " sample " << i;
+    }
+
+    position += kBlockSize;
+  }
+}
+
+// RTBypass - benchmarkBypassed (cpu of a session of many bypassed instances vs processing)
+TEST(RTBypass, DISABLED_benchmarkBypassed)
+{
+  constexpr int kInstances = 64;
+  constexpr int kBlocks = 1000;
+
+  auto run = [](bool iBypassed, bool iInPlace, uint32 iLatency) {
+    std::vector<RTBypass> bypasses(kInstances);
+    for(auto &b: bypasses)
+    {
+      b.setup(kSample32, kNumChannels, 256, kBlockSize);
+      b.reset(iBypassed);
+    }
+
+    Block block{iInPlace};
+    for(int32 c = 0; c < kNumChannels; c++)
+      for(int32 i = 0; i < kBlockSize; i++)
+        block.fIn[c][i] = std::sin(0.01f * i);
+
+    auto process = [](Block &iBlock) {
+      for(int32 c = 0; c < kNumChannels; c++)
+        for(int32 i = 0; i < kBlockSize; i++)
+          iBlock.fOutPtrs[c][i] = std::tanh(3.0f * iBlock.fInPtrs[c][i]);
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for(int b = 0; b < kBlocks; b++)
+      for(auto &bypass: bypasses)
+        processBlock(bypass, block, iBypassed, iLatency, process);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  auto processing = run(false, false, 0);
+  auto bypassed = run(true, false, 0);
+  auto bypassedInPlace = run(true, true, 0);
+  auto bypassedLatency = run(true, false, 128);
+
+  std::cout << kInstances << " instances x " << kBlocks << " blocks: processing " << processing << "ms, bypassed "
+            << bypassed << "ms, bypassed (in place) " << bypassedInPlace << "ms, bypassed (latency) "
+            << bypassedLatency << "ms" << std::endl;
+}
+
+}
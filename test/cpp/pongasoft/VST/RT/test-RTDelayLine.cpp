@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTDelayLine.h>
+#include <pongasoft/VST/Oversampler.h>
+
+#include <cmath>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTDelayLine {
+
+//------------------------------------------------------------------------
+// Bus (owns the memory of an AudioBusBuffers)
+//------------------------------------------------------------------------
+struct Bus
+{
+  Bus(int32 iNumChannels, int32 iNumSamples) :
+    fSamples(static_cast<size_t>(iNumChannels), std::vector<Sample32>(static_cast<size_t>(iNumSamples))),
+    fPtrs(static_cast<size_t>(iNumChannels)),
+    fNumSamples{iNumSamples}
+  {
+    for(size_t c = 0; c < fSamples.size(); c++)
+      fPtrs[c] = fSamples[c].data();
+    fBusBuffers.numChannels = iNumChannels;
+    fBusBuffers.channelBuffers32 = fPtrs.data();
+  }
+
+  AudioBuffers32 buffers(int32 iNumSamples) { return AudioBuffers32{fBusBuffers, iNumSamples}; }
+
+  std::vector<std::vector<Sample32>> fSamples;
+  std::vector<Sample32 *> fPtrs;
+  int32 fNumSamples;
+  AudioBusBuffers fBusBuffers{};
+};
+
+// RTDelayLine - testAlignment (the output is the input delayed by exactly `delay` samples whatever the block sizes)
+TEST(RTDelayLine, testAlignment)
+{
+  constexpr int32 kMaxBlockSize = 64;
+  constexpr int32 kNumSamples = 2000;
+
+  // block sizes vary (including blocks bigger than the max provided in setup and empty blocks)
+  std::vector<int32> blockSizes{1, 64, 17, 0, 200, 63, 64, 5};
+
+  for(int32 delay: {0, 1, 23, 100, 256})
+  {
+    RTDelayLine<Sample32> line{};
+    line.setup(2, 256, kMaxBlockSize);
+    line.setDelay(delay);
+    ASSERT_EQ(delay, line.getDelay());
+
+    Bus in{2, 256};
+    Bus out{2, 256};
+
+    int32 position = 0;
+    size_t b = 0;
+    while(position < kNumSamples)
+    {
+      auto n = std::min(blockSizes[b++ % blockSizes.size()], kNumSamples - position);
+      for(int32 c = 0; c < 2; c++)
+        for(int32 i = 0; i < n; i++)
+          in.fSamples[c][i] = static_cast<Sample32>((c + 1) * 1000 + position + i);
+
+      auto inBuffers = in.buffers(n);
+      auto outBuffers = out.buffers(n);
+      line.process(inBuffers, outBuffers);
+
+      for(int32 c = 0; c < 2; c++)
+      {
+        for(int32 i = 0; i < n; i++)
+        {
+          auto p = position + i - delay;
+          auto expected = p < 0 ? 0 : static_cast<Sample32>((c + 1) * 1000 + p);
+          ASSERT_EQ(expected, out.fSamples[c][i]) << "delay=" << delay << " position=" << position + i;
+        }
+      }
+
+      position += n;
+    }
+  }
+}
+
+// RTDelayLine - testInPlace
+TEST(RTDelayLine, testInPlace)
+{
+  RTDelayLine<Sample32> line{};
+  line.setup(1, 8, 4);
+  line.setDelay(3);
+
+  Bus bus{1, 4};
+  std::vector<Sample32> output{};
+  for(int b = 0; b < 3; b++)
+  {
+    for(int32 i = 0; i < 4; i++)
+      bus.fSamples[0][i] = static_cast<Sample32>(1 + b * 4 + i);
+    auto buffers = bus.buffers(4);
+    line.process(buffers, buffers);
+    output.insert(output.end(), bus.fSamples[0].begin(), bus.fSamples[0].end());
+  }
+  ASSERT_EQ((std::vector<Sample32>{0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), output);
+
+  // max delay
+  line.setDelay(100);
+  ASSERT_EQ(8, line.getDelay());
+
+  line.reset();
+  auto buffers = bus.buffers(4);
+  line.process(buffers, buffers);
+  ASSERT_EQ((std::vector<Sample32>{0, 0, 0, 0}), bus.fSamples[0]);
+}
+
+// RTDelayLine - testLatencyCompensation (dry path delayed by the latency of the (oversampled) wet path)
+TEST(RTDelayLine, testLatencyCompensation)
+{
+  constexpr int32 kBlockSize = 128;
+  constexpr double kPi = 3.14159265358979323846;
+
+  Oversampler<Sample32> oversampler{2};
+  oversampler.setup(1, kBlockSize);
+
+  RTDelayLine<Sample32> dryLine{};
+  dryLine.setup(1, 64, kBlockSize);
+  dryLine.setDelay(static_cast<int32>(oversampler.getLatencySamples()));
+
+  Bus in{1, kBlockSize};
+  Bus wet{1, kBlockSize};
+  Bus dry{1, kBlockSize};
+
+  double maxError = 0;
+  for(int32 b = 0; b < 16; b++)
+  {
+    for(int32 i = 0; i < kBlockSize; i++)
+      in.fSamples[0][i] = static_cast<Sample32>(std::sin(2 * kPi * 0.01 * (b * kBlockSize + i)));
+
+    auto inBuffers = in.buffers(kBlockSize);
+    auto wetBuffers = wet.buffers(kBlockSize);
+    auto dryBuffers = dry.buffers(kBlockSize);
+    oversampler.process(inBuffers, wetBuffers, [](Sample32 s, int32) { return s; });
+    dryLine.process(inBuffers, dryBuffers);
+
+    if(b < 2)
+      continue;
+
+    for(int32 i = 0; i < kBlockSize; i++)
+      maxError = std::max(maxError, static_cast<double>(std::abs(wet.fSamples[0][i] - dry.fSamples[0][i])));
+  }
+
+  // wet and dry are aligned => mixing them does not comb filter
+  ASSERT_LT(maxError, 1e-3);
+}
+
+}
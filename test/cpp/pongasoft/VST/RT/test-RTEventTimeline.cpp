@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTEventTimeline.h>
+
+#include <random>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTEventTimeline {
+
+//------------------------------------------------------------------------
+// Minimal (non ref counted) implementations of the host side interfaces
+//------------------------------------------------------------------------
+#define TEST_FUNKNOWN_METHODS \
+  tresult PLUGIN_API queryInterface(const TUID, void **obj) override { *obj = nullptr; return kNoInterface; } \
+  uint32 PLUGIN_API addRef() override { return 1; } \
+  uint32 PLUGIN_API release() override { return 1; }
+
+class MyParamValueQueue : public IParamValueQueue
+{
+public:
+  explicit MyParamValueQueue(ParamID iParamID) : fParamID{iParamID} {}
+  ParamID PLUGIN_API getParameterId() override { return fParamID; }
+  int32 PLUGIN_API getPointCount() override { return static_cast<int32>(fPoints.size()); }
+  tresult PLUGIN_API getPoint(int32 index, int32 &sampleOffset, ParamValue &value) override
+  {
+    if(index < 0 || index >= getPointCount())
+      return kResultFalse;
+    sampleOffset = fPoints[index].first;
+    value = fPoints[index].second;
+    return kResultOk;
+  }
+  tresult PLUGIN_API addPoint(int32 sampleOffset, ParamValue value, int32 &index) override
+  {
+    index = getPointCount();
+    fPoints.emplace_back(sampleOffset, value);
+    return kResultOk;
+  }
+  TEST_FUNKNOWN_METHODS
+
+  ParamID fParamID;
+  std::vector<std::pair<int32, ParamValue>> fPoints{};
+};
+
+class MyParameterChanges : public IParameterChanges
+{
+public:
+  int32 PLUGIN_API getParameterCount() override { return static_cast<int32>(fQueues.size()); }
+  IParamValueQueue *PLUGIN_API getParameterData(int32 index) override { return &fQueues[index]; }
+  IParamValueQueue *PLUGIN_API addParameterData(const ParamID &id, int32 &index) override
+  {
+    index = getParameterCount();
+    return &fQueues.emplace_back(id);
+  }
+  TEST_FUNKNOWN_METHODS
+
+  // add
+  void add(ParamID iParamID, int32 iSampleOffset, ParamValue iValue)
+  {
+    for(auto &q: fQueues)
+    {
+      if(q.fParamID == iParamID)
+      {
+        int32 index;
+        q.addPoint(iSampleOffset, iValue, index);
+        return;
+      }
+    }
+    int32 index;
+    addParameterData(iParamID, index)->addPoint(iSampleOffset, iValue, index);
+  }
+
+  std::vector<MyParamValueQueue> fQueues{};
+};
+
+class MyEventList : public IEventList
+{
+public:
+  int32 PLUGIN_API getEventCount() override { return static_cast<int32>(fEvents.size()); }
+  tresult PLUGIN_API getEvent(int32 index, Event &e) override
+  {
+    if(index < 0 || index >= getEventCount())
+      return kResultFalse;
+    e = fEvents[index];
+    return kResultOk;
+  }
+  tresult PLUGIN_API addEvent(Event &e) override { fEvents.emplace_back(e); return kResultOk; }
+  TEST_FUNKNOWN_METHODS
+
+  // noteOn
+  void noteOn(int32 iSampleOffset, int16 iPitch)
+  {
+    Event e{};
+    e.type = Event::kNoteOnEvent;
+    e.sampleOffset = iSampleOffset;
+    e.noteOn.pitch = iPitch;
+    addEvent(e);
+  }
+
+  std::vector<Event> fEvents{};
+};
+
+// RTEventTimeline - testMerge
+TEST(RTEventTimeline, testMerge)
+{
+  MyParameterChanges changes{};
+  changes.add(100, 0, 0.1);
+  changes.add(100, 32, 0.2);
+  changes.add(100, 64, 0.3);
+  changes.add(200, 32, 0.5);
+
+  MyEventList events{};
+  events.noteOn(16, 60);
+  events.noteOn(32, 62);
+  events.noteOn(200, 64); // out of the block => clamped
+
+  RTEventTimeline timeline{16};
+  timeline.build(&changes, &events, 128);
+  ASSERT_EQ(0, timeline.getOverflowCount());
+
+  // (offset, param id or pitch)
+  std::vector<std::pair<int32, int32>> expected{
+    {0, 100}, {16, 60}, {32, 100}, {32, 200}, {32, 62}, {64, 100}, {127, 64}
+  };
+
+  ASSERT_EQ(expected.size(), timeline.size());
+  for(int32 i = 0; i < timeline.size(); i++)
+  {
+    auto const &item = timeline[i];
+    ASSERT_EQ(expected[i].first, item.fSampleOffset);
+    ASSERT_EQ(expected[i].second, item.isParamChange() ? static_cast<int32>(item.fParamID) : item.fEvent.noteOn.pitch);
+  }
+  ASSERT_DOUBLE_EQ(0.5, timeline[3].fValue);
+
+  // sub blocks
+  std::vector<std::pair<int32, int32>> subBlocks{};
+  int itemCount = 0;
+  timeline.forEachSubBlock(128,
+                           [&subBlocks](int32 iStart, int32 iNumSamples) { subBlocks.emplace_back(iStart, iNumSamples); },
+                           [&itemCount](RTEventTimeline::Item const &) { itemCount++; });
+  ASSERT_EQ(7, itemCount);
+  ASSERT_EQ((std::vector<std::pair<int32, int32>>{{0, 16}, {16, 16}, {32, 32}, {64, 63}, {127, 1}}), subBlocks);
+
+  // nothing => one sub block
+  timeline.build(nullptr, nullptr, 128);
+  ASSERT_TRUE(timeline.empty());
+  subBlocks.clear();
+  timeline.forEachSubBlock(128,
+                           [&subBlocks](int32 iStart, int32 iNumSamples) { subBlocks.emplace_back(iStart, iNumSamples); },
+                           [](RTEventTimeline::Item const &) { FAIL(); });
+  ASSERT_EQ((std::vector<std::pair<int32, int32>>{{0, 128}}), subBlocks);
+
+  // overflow
+  RTEventTimeline small{2};
+  small.build(&changes, &events, 128);
+  ASSERT_EQ(7, small.size());
+  ASSERT_EQ(1, small.getOverflowCount());
+}
+
+// RTEventTimeline - testDense (every parameter automated on every sample + many events)
+TEST(RTEventTimeline, testDense)
+{
+  constexpr int32 kNumSamples = 256;
+  constexpr int32 kNumParams = 16;
+  constexpr int32 kNumEvents = 128;
+
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int32> offsets{0, kNumSamples - 1};
+
+  MyParameterChanges changes{};
+  for(int32 p = 0; p < kNumParams; p++)
+    for(int32 s = 0; s < kNumSamples; s++)
+      changes.add(p, s, static_cast<ParamValue>(s) / kNumSamples);
+
+  std::vector<int32> eventOffsets{};
+  for(int32 e = 0; e < kNumEvents; e++)
+    eventOffsets.emplace_back(offsets(random));
+  std::sort(eventOffsets.begin(), eventOffsets.end());
+
+  MyEventList events{};
+  for(int32 e = 0; e < kNumEvents; e++)
+    events.noteOn(eventOffsets[e], static_cast<int16>(e));
+
+  RTEventTimeline timeline{kNumParams * kNumSamples + kNumEvents};
+
+  for(int iteration = 0; iteration < 10; iteration++)
+  {
+    timeline.build(&changes, &events, kNumSamples);
+    ASSERT_EQ(kNumParams * kNumSamples + kNumEvents, timeline.size());
+  }
+  ASSERT_EQ(0, timeline.getOverflowCount());
+
+  // sorted by offset, parameters before events at the same offset, host order preserved
+  int16 nextPitch = 0;
+  for(int32 i = 1; i < timeline.size(); i++)
+  {
+    auto const &previous = timeline[i - 1];
+    auto const &item = timeline[i];
+    ASSERT_LE(previous.fSampleOffset, item.fSampleOffset);
+    if(previous.fSampleOffset == item.fSampleOffset)
+    {
+      ASSERT_FALSE(previous.isEvent() && item.isParamChange());
+      if(previous.isParamChange() && item.isParamChange())
+        ASSERT_LT(previous.fParamID, item.fParamID);
+    }
+  }
+  for(auto const &item: timeline)
+  {
+    if(item.isEvent())
+      ASSERT_EQ(nextPitch++, item.fEvent.noteOn.pitch);
+    else
+      ASSERT_DOUBLE_EQ(static_cast<ParamValue>(item.fSampleOffset) / kNumSamples, item.fValue);
+  }
+  ASSERT_EQ(kNumEvents, nextPitch);
+
+  // sub blocks cover the entire block
+  int32 total = 0;
+  timeline.forEachSubBlock(kNumSamples,
+                           [&total](int32 iStart, int32 iNumSamples) { ASSERT_EQ(total, iStart); total += iNumSamples; },
+                           [](RTEventTimeline::Item const &) {});
+  ASSERT_EQ(kNumSamples, total);
+}
+
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTState.h>
+#include <pongasoft/VST/RT/RTPresetBank.h>
+#include <pongasoft/VST/VstUtils/FastWriteMemoryStream.h>
+#include <pluginterfaces/vst/ivstparameterchanges.h>
+
+#include <map>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTPresetBank {
+
+enum ParamIDs : ParamID {
+  kParam1 = 1000,
+  kParam2 = 1001,
+};
+
+//------------------------------------------------------------------------
+// MyParameters
+//------------------------------------------------------------------------
+class MyParameters : public Parameters
+{
+public:
+  RawVstParam fParam1;
+  RawVstParam fParam2;
+
+  MyParameters()
+  {
+    fParam1 = raw(kParam1, STR16("param1")).add();
+    fParam2 = raw(kParam2, STR16("param2")).add();
+    setRTSaveStateOrder(1, fParam1, fParam2);
+  }
+};
+
+//------------------------------------------------------------------------
+// MyRTState
+//------------------------------------------------------------------------
+class MyRTState : public RTState
+{
+public:
+  RTRawVstParam fParam1;
+  RTRawVstParam fParam2;
+
+  explicit MyRTState(MyParameters const &iParams) :
+    RTState(iParams),
+    fParam1{add(iParams.fParam1)},
+    fParam2{add(iParams.fParam2)}
+  {}
+};
+
+//------------------------------------------------------------------------
+// Minimal (non ref counted) implementation of the host side output parameter changes
+//------------------------------------------------------------------------
+#define TEST_FUNKNOWN_METHODS \
+  tresult PLUGIN_API queryInterface(const TUID, void **obj) override { *obj = nullptr; return kNoInterface; } \
+  uint32 PLUGIN_API addRef() override { return 1; } \
+  uint32 PLUGIN_API release() override { return 1; }
+
+class MyParamValueQueue : public IParamValueQueue
+{
+public:
+  explicit MyParamValueQueue(ParamID iParamID) : fParamID{iParamID} {}
+  ParamID PLUGIN_API getParameterId() override { return fParamID; }
+  int32 PLUGIN_API getPointCount() override { return static_cast<int32>(fPoints.size()); }
+  tresult PLUGIN_API getPoint(int32 index, int32 &sampleOffset, ParamValue &value) override
+  {
+    if(index < 0 || index >= getPointCount())
+      return kResultFalse;
+    sampleOffset = fPoints[index].first;
+    value = fPoints[index].second;
+    return kResultOk;
+  }
+  tresult PLUGIN_API addPoint(int32 sampleOffset, ParamValue value, int32 &index) override
+  {
+    index = getPointCount();
+    fPoints.emplace_back(sampleOffset, value);
+    return kResultOk;
+  }
+  TEST_FUNKNOWN_METHODS
+
+  ParamID fParamID;
+  std::vector<std::pair<int32, ParamValue>> fPoints{};
+};
+
+class MyParameterChanges : public IParameterChanges
+{
+public:
+  MyParameterChanges() { fQueues.reserve(16); }
+  int32 PLUGIN_API getParameterCount() override { return static_cast<int32>(fQueues.size()); }
+  IParamValueQueue *PLUGIN_API getParameterData(int32 index) override { return &fQueues[index]; }
+  IParamValueQueue *PLUGIN_API addParameterData(const ParamID &id, int32 &index) override
+  {
+    index = getParameterCount();
+    return &fQueues.emplace_back(id);
+  }
+  TEST_FUNKNOWN_METHODS
+
+  // last value of each parameter (what the host sees)
+  std::map<ParamID, ParamValue> getValues() const
+  {
+    std::map<ParamID, ParamValue> res{};
+    for(auto const &q: fQueues)
+      if(!q.fPoints.empty())
+        res[q.fParamID] = q.fPoints.back().second;
+    return res;
+  }
+
+  std::vector<MyParamValueQueue> fQueues{};
+};
+
+// encodePreset
+std::vector<int8> encodePreset(MyParameters const &iParams, ParamValue iValue1, ParamValue iValue2)
+{
+  auto state = iParams.newRTState();
+  state->set(0, iValue1);
+  state->set(1, iValue2);
+
+  VstUtils::FastWriteMemoryStream stream{};
+  IBStreamer streamer(&stream, kLittleEndian);
+  iParams.writeRTState(state.get(), streamer);
+
+  return std::vector<int8>(stream.getData(), stream.getData() + stream.getSize());
+}
+
+// RTPresetBank - testSwitch
+TEST(RTPresetBank, testSwitch)
+{
+  MyParameters params{};
+  MyRTState state{params};
+  ASSERT_EQ(kResultOk, state.init());
+
+  RTPresetBank bank{params, 3};
+  state.setPresetBank(&bank);
+
+  ASSERT_EQ(3, bank.getNumPresets());
+  ASSERT_FALSE(bank.isPresetReady(0));
+  ASSERT_FALSE(bank.requestPresetChange(3));
+
+  bank.decodePresetAsync(0, encodePreset(params, 0.1, 0.2));
+  bank.decodePresetAsync(1, encodePreset(params, 0.3, 0.4));
+  bank.waitForDecoding();
+
+  ASSERT_TRUE(bank.isPresetReady(0));
+  ASSERT_TRUE(bank.isPresetReady(1));
+  ASSERT_FALSE(bank.isPresetReady(2));
+
+  // no request => nothing happens
+  ASSERT_FALSE(state.beforeProcessing());
+  state.afterProcessing();
+  ASSERT_EQ(0.0, state.fParam1.value());
+
+  // switch to preset 1
+  ASSERT_TRUE(bank.requestPresetChange(1));
+  ASSERT_TRUE(state.beforeProcessing());
+  ASSERT_EQ(0.3, state.fParam1.value());
+  ASSERT_EQ(0.4, state.fParam2.value());
+  // old values are still available for crossfading
+  ASSERT_EQ(0.0, state.fParam1.previous());
+  ASSERT_EQ(1, bank.getLastSwitchInfo().fCurrentPresetIndex);
+  ASSERT_EQ(-1, bank.getLastSwitchInfo().fPreviousPresetIndex);
+  ASSERT_EQ(0, bank.getLastSwitchInfo().fLatencyInBlocks);
+  state.afterProcessing();
+
+  // switch to preset 0
+  ASSERT_TRUE(bank.requestPresetChange(0));
+  ASSERT_TRUE(state.beforeProcessing());
+  ASSERT_EQ(0.1, state.fParam1.value());
+  ASSERT_EQ(0.3, state.fParam1.previous());
+  ASSERT_EQ(1, bank.getLastSwitchInfo().fPreviousPresetIndex);
+  ASSERT_EQ(0, bank.getLastSwitchInfo().fCurrentPresetIndex);
+  state.afterProcessing();
+
+  // preset 2 not decoded yet => switch is delayed until ready
+  ASSERT_TRUE(bank.requestPresetChange(2));
+  ASSERT_FALSE(state.beforeProcessing());
+  state.afterProcessing();
+  ASSERT_FALSE(state.beforeProcessing());
+  state.afterProcessing();
+  ASSERT_EQ(0.1, state.fParam1.value());
+
+  bank.decodePresetAsync(2, encodePreset(params, 0.5, 0.6));
+  bank.waitForDecoding();
+  ASSERT_TRUE(state.beforeProcessing());
+  ASSERT_EQ(0.5, state.fParam1.value());
+  ASSERT_EQ(0.6, state.fParam2.value());
+  ASSERT_EQ(2, bank.getLastSwitchInfo().fLatencyInBlocks);
+  state.afterProcessing();
+
+  // last request wins
+  ASSERT_TRUE(bank.requestPresetChange(0));
+  ASSERT_TRUE(bank.requestPresetChange(1));
+  ASSERT_TRUE(state.beforeProcessing());
+  ASSERT_EQ(0.3, state.fParam1.value());
+  ASSERT_EQ(1, bank.getLastSwitchInfo().fCurrentPresetIndex);
+  state.afterProcessing();
+  ASSERT_FALSE(state.beforeProcessing());
+}
+
+// RTPresetBank - testOutputParameterChanges (the host/controller are told about the new values)
+TEST(RTPresetBank, testOutputParameterChanges)
+{
+  MyParameters params{};
+  MyRTState state{params};
+  ASSERT_EQ(kResultOk, state.init());
+
+  RTPresetBank bank{params, 2};
+  state.setPresetBank(&bank);
+
+  bank.decodePresetAsync(0, encodePreset(params, 0.1, 0.0));
+  bank.decodePresetAsync(1, encodePreset(params, 0.3, 0.0));
+  bank.waitForDecoding();
+
+  auto process = [&state]() {
+    MyParameterChanges outputChanges{};
+    ProcessData data{};
+    data.outputParameterChanges = &outputChanges;
+    state.beforeProcessing();
+    EXPECT_EQ(kResultOk, state.addPresetChangesToOutput(data));
+    state.afterProcessing();
+    return outputChanges.getValues();
+  };
+
+  // no switch => nothing reported
+  ASSERT_TRUE(process().empty());
+
+  // switch to preset 0 => only param1 changed (param2 is already 0)
+  ASSERT_TRUE(bank.requestPresetChange(0));
+  ASSERT_EQ((std::map<ParamID, ParamValue>{{kParam1, 0.1}}), process());
+
+  // reported once
+  ASSERT_TRUE(process().empty());
+
+  // switch to preset 1
+  ASSERT_TRUE(bank.requestPresetChange(1));
+  ASSERT_EQ((std::map<ParamID, ParamValue>{{kParam1, 0.3}}), process());
+
+  // switching to the same values => nothing to report
+  ASSERT_TRUE(bank.requestPresetChange(1));
+  ASSERT_TRUE(process().empty());
+}
+
+}
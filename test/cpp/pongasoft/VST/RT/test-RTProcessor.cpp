@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTProcessor.h>
+#include <pongasoft/VST/RT/RTKernelProcessor.h>
+#include <pongasoft/VST/AudioBuffer.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTProcessor {
+
+constexpr int32 kNumChannels = 2;
+constexpr int32 kBlockSize = 128;
+
+//------------------------------------------------------------------------
+// MyParameters
+//------------------------------------------------------------------------
+class MyParameters : public Parameters
+{
+public:
+  RawVstParam fGain;
+
+  MyParameters()
+  {
+    fGain = raw(1000, STR16("gain")).defaultValue(0.5).add();
+    setRTSaveStateOrder(1, fGain);
+  }
+};
+
+//------------------------------------------------------------------------
+// MyRTState
+//------------------------------------------------------------------------
+class MyRTState : public RTState
+{
+public:
+  RTRawVstParam fGain;
+
+  explicit MyRTState(MyParameters const &iParams) : RTState(iParams), fGain{add(iParams.fGain)} {}
+};
+
+//------------------------------------------------------------------------
+// MyProcessor (a one pole low pass filter: has a tail)
+//------------------------------------------------------------------------
+class MyProcessor : public RTProcessor
+{
+public:
+  MyProcessor() : RTProcessor(FUID{}), fState{fParams}
+  {
+    // implementation note: this is only for testing! in real life scenario the host/DAW is the one
+    // instantiating the processor and calling initialize/setActive
+    initialize(nullptr);
+    setActive(true);
+  }
+
+  ~MyProcessor() override { setActive(false); terminate(); }
+
+  RTState *getRTState() override { return &fState; }
+
+  uint32 PLUGIN_API getTailSamples() override { return fTailSamples; }
+
+  using RTProcessor::enableSilenceSkip;
+  using RTProcessor::addLatencyComponent;
+  using RTProcessor::setLatencySamples;
+  using RTProcessor::getLatencySamples;
+
+  tresult processInputs32Bits(ProcessData &data) override
+  {
+    fProcessedBlockCount++;
+
+    AudioBuffers32 in{data.inputs[0], data.numSamples};
+    AudioBuffers32 out{data.outputs[0], data.numSamples};
+
+    auto gain = static_cast<Sample32>(fState.fGain.getValue());
+
+    for(int32 c = 0; c < kNumChannels; c++)
+    {
+      auto inBuffer = in.getBuffer()[c];
+      auto outBuffer = out.getBuffer()[c];
+      auto &z = fZ[c];
+      for(int32 i = 0; i < data.numSamples; i++)
+      {
+        z += 0.01f * (gain * inBuffer[i] - z);
+        outBuffer[i] = std::tanh(z);
+      }
+    }
+
+    out.adjustSilenceFlags();
+
+    return kResultOk;
+  }
+
+  MyParameters fParams{};
+  MyRTState fState;
+  uint32 fTailSamples{kNoTail};
+  int fProcessedBlockCount{};
+  Sample32 fZ[kNumChannels]{};
+};
+
+//------------------------------------------------------------------------
+// Block: one (stereo) input bus and one output bus
+//------------------------------------------------------------------------
+struct Block
+{
+  Block()
+  {
+    for(int32 c = 0; c < kNumChannels; c++)
+    {
+      fInPtrs[c] = fIn[c].data();
+      fOutPtrs[c] = fOut[c].data();
+    }
+    fInBus.numChannels = kNumChannels;
+    fInBus.channelBuffers32 = fInPtrs;
+    fOutBus.numChannels = kNumChannels;
+    fOutBus.channelBuffers32 = fOutPtrs;
+
+    fData.processMode = kRealtime;
+    fData.symbolicSampleSize = kSample32;
+    fData.numSamples = kBlockSize;
+    fData.numInputs = 1;
+    fData.inputs = &fInBus;
+    fData.numOutputs = 1;
+    fData.outputs = &fOutBus;
+  }
+
+  // fill (silent when iValue is 0)
+  void fill(Sample32 iValue)
+  {
+    for(auto &in: fIn)
+      std::fill(in.begin(), in.end(), iValue);
+    fInBus.silenceFlags = iValue == 0 ? (1 << kNumChannels) - 1 : 0;
+    for(auto &out: fOut)
+      std::fill(out.begin(), out.end(), 1.0f);
+    fOutBus.silenceFlags = 0;
+  }
+
+  bool isOutputCleared() const
+  {
+    for(auto &out: fOut)
+      for(auto s: out)
+        if(s != 0)
+          return false;
+    return fOutBus.silenceFlags == (1 << kNumChannels) - 1;
+  }
+
+  std::vector<Sample32> fIn[kNumChannels]{std::vector<Sample32>(kBlockSize), std::vector<Sample32>(kBlockSize)};
+  std::vector<Sample32> fOut[kNumChannels]{std::vector<Sample32>(kBlockSize), std::vector<Sample32>(kBlockSize)};
+  Sample32 *fInPtrs[kNumChannels]{};
+  Sample32 *fOutPtrs[kNumChannels]{};
+  AudioBusBuffers fInBus{};
+  AudioBusBuffers fOutBus{};
+  ProcessData fData{};
+};
+
+// RTProcessor - testSilenceSkip
+TEST(RTProcessor, testSilenceSkip)
+{
+  MyProcessor processor{};
+  Block block{};
+
+  // disabled by default => always processed
+  block.fill(0);
+  ASSERT_EQ(kResultOk, processor.process(block.fData));
+  ASSERT_EQ(1, processor.fProcessedBlockCount);
+  ASSERT_EQ(0, processor.getSkippedBlockCount());
+
+  processor.enableSilenceSkip();
+
+  // no tail => skipped right away
+  block.fill(0);
+  ASSERT_EQ(kResultOk, processor.process(block.fData));
+  ASSERT_EQ(1, processor.fProcessedBlockCount);
+  ASSERT_EQ(1, processor.getSkippedBlockCount());
+  ASSERT_TRUE(block.isOutputCleared());
+
+  // not silent => processed
+  block.fill(0.5f);
+  processor.process(block.fData);
+  ASSERT_EQ(2, processor.fProcessedBlockCount);
+  ASSERT_FALSE(block.isOutputCleared());
+
+  // tail of 2 blocks => 2 silent blocks are processed then skipped
+  processor.fTailSamples = 2 * kBlockSize;
+  block.fill(0.5f);
+  processor.process(block.fData);
+  processor.resetSkippedBlockCount();
+  for(int i = 0; i < 5; i++)
+  {
+    block.fill(0);
+    processor.process(block.fData);
+  }
+  ASSERT_EQ(5, processor.fProcessedBlockCount);
+  ASSERT_EQ(3, processor.getSkippedBlockCount());
+  ASSERT_TRUE(block.isOutputCleared());
+
+  // infinite tail => never skipped
+  processor.fTailSamples = kInfiniteTail;
+  block.fill(0);
+  processor.process(block.fData);
+  ASSERT_EQ(6, processor.fProcessedBlockCount);
+
+  // no samples (parameters flush) => not skipped
+  processor.fTailSamples = kNoTail;
+  block.fData.numSamples = 0;
+  processor.resetSkippedBlockCount();
+  processor.process(block.fData);
+  ASSERT_EQ(7, processor.fProcessedBlockCount);
+  ASSERT_EQ(0, processor.getSkippedBlockCount());
+}
+
+// RTProcessor - testLatency
+TEST(RTProcessor, testLatency)
+{
+  MyProcessor processor{};
+
+  // no component => no latency
+  ASSERT_EQ(0, processor.getLatencySamples());
+
+  auto lookahead = processor.addLatencyComponent(64);
+  auto filter = processor.addLatencyComponent();
+  ASSERT_EQ(64, processor.getLatencySamples());
+  ASSERT_EQ(64, processor.getLatencySamples(lookahead));
+  ASSERT_EQ(0, processor.getLatencySamples(filter));
+
+  processor.setLatencySamples(filter, 23);
+  ASSERT_EQ(87, processor.getLatencySamples());
+
+  processor.setLatencySamples(lookahead, 0);
+  ASSERT_EQ(23, processor.getLatencySamples());
+
+  // invalid component => ignored
+  processor.setLatencySamples(12, 100);
+  ASSERT_EQ(23, processor.getLatencySamples());
+  ASSERT_EQ(0, processor.getLatencySamples(12));
+}
+
+// RTProcessor - benchmarkSilenceSkip (a session of many instances, most of them on silent tracks)
+TEST(RTProcessor, DISABLED_benchmarkSilenceSkip)
+{
+  constexpr int kInstances = 64;
+  constexpr int kActiveInstances = 4;
+  constexpr int kBlocks = 1000; // ~3s at 44.1kHz
+
+  auto run = [](bool iSilenceSkip) {
+    std::vector<std::unique_ptr<MyProcessor>> processors{};
+    for(int i = 0; i < kInstances; i++)
+    {
+      processors.emplace_back(std::make_unique<MyProcessor>());
+      processors.back()->fTailSamples = 4410; // 100ms
+      processors.back()->enableSilenceSkip(iSilenceSkip);
+    }
+
+    Block block{};
+
+    auto start = std::chrono::steady_clock::now();
+    uint64 skipped = 0;
+    for(int b = 0; b < kBlocks; b++)
+    {
+      for(int i = 0; i < kInstances; i++)
+      {
+        block.fill(i < kActiveInstances ? 0.5f : 0);
+        processors[i]->process(block.fData);
+      }
+    }
+    auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    for(auto &p: processors)
+      skipped += p->getSkippedBlockCount();
+
+    return std::make_pair(time, skipped);
+  };
+
+  auto [timeWithoutSkip, skippedWithoutSkip] = run(false);
+  auto [timeWithSkip, skippedWithSkip] = run(true);
+
+  ASSERT_EQ(0, skippedWithoutSkip);
+  ASSERT_GT(skippedWithSkip, 0);
+
+  std::cout << "Silent session (" << kInstances << " instances, " << kActiveInstances << " active, " << kBlocks
+            << " blocks): " << timeWithoutSkip << "ms without skip, " << timeWithSkip << "ms with skip ("
+            << skippedWithSkip << " skipped blocks)" << std::endl;
+}
+
+//------------------------------------------------------------------------
+// MyKernelProcessor (gain of 2, records the sample type used by the kernel)
+//------------------------------------------------------------------------
+template<typename TInternalSample>
+class MyKernelProcessor : public RTKernelProcessor<MyKernelProcessor<TInternalSample>, TInternalSample>
+{
+public:
+  using Base = RTKernelProcessor<MyKernelProcessor<TInternalSample>, TInternalSample>;
+
+  MyKernelProcessor() : Base(FUID{}), fState{fParams}
+  {
+    this->initialize(nullptr);
+    this->addAudioInput(STR16("Stereo In"), SpeakerArr::kStereo);
+    this->addAudioOutput(STR16("Stereo Out"), SpeakerArr::kStereo);
+    ProcessSetup setup{kRealtime, kSample64, kBlockSize, 44100};
+    this->setupProcessing(setup);
+    this->setActive(true);
+  }
+
+  ~MyKernelProcessor() override { this->setActive(false); this->terminate(); }
+
+  RTState *getRTState() override { return &fState; }
+
+  template<typename SampleType>
+  tresult processKernel(ProcessData &data)
+  {
+    fKernelSampleSize = data.symbolicSampleSize;
+
+    AudioBuffers<SampleType> in{data.inputs[0], data.numSamples};
+    AudioBuffers<SampleType> out{data.outputs[0], data.numSamples};
+
+    for(int32 c = 0; c < kNumChannels; c++)
+      for(int32 i = 0; i < data.numSamples; i++)
+        out.getBuffer()[c][i] = 2 * in.getBuffer()[c][i];
+
+    out.adjustSilenceFlags();
+    return kResultOk;
+  }
+
+  MyParameters fParams{};
+  MyRTState fState;
+  int32 fKernelSampleSize{-1};
+};
+
+// runKernel (host requests iSampleSize)
+template<typename TProcessor, typename SampleType>
+void runKernel(TProcessor &iProcessor, int32 iSampleSize, int32 iExpectedKernelSampleSize)
+{
+  std::vector<SampleType> in[kNumChannels]{std::vector<SampleType>(kBlockSize), std::vector<SampleType>(kBlockSize)};
+  std::vector<SampleType> out[kNumChannels]{std::vector<SampleType>(kBlockSize), std::vector<SampleType>(kBlockSize)};
+  SampleType *inPtrs[kNumChannels]{in[0].data(), in[1].data()};
+  SampleType *outPtrs[kNumChannels]{out[0].data(), out[1].data()};
+
+  for(int32 i = 0; i < kBlockSize; i++)
+  {
+    in[0][i] = static_cast<SampleType>(i) / kBlockSize;
+    in[1][i] = -static_cast<SampleType>(i) / kBlockSize;
+  }
+
+  AudioBusBuffers inBus{};
+  inBus.numChannels = kNumChannels;
+  AudioBusBuffers outBus{};
+  outBus.numChannels = kNumChannels;
+  if constexpr(std::is_same_v<SampleType, Sample32>)
+  {
+    inBus.channelBuffers32 = inPtrs;
+    outBus.channelBuffers32 = outPtrs;
+  }
+  else
+  {
+    inBus.channelBuffers64 = inPtrs;
+    outBus.channelBuffers64 = outPtrs;
+  }
+
+  ProcessData data{};
+  data.symbolicSampleSize = iSampleSize;
+  data.numSamples = kBlockSize;
+  data.numInputs = 1;
+  data.inputs = &inBus;
+  data.numOutputs = 1;
+  data.outputs = &outBus;
+
+  ASSERT_EQ(kResultOk, iProcessor.process(data));
+  ASSERT_EQ(iExpectedKernelSampleSize, iProcessor.fKernelSampleSize);
+
+  for(int32 c = 0; c < kNumChannels; c++)
+    for(int32 i = 0; i < kBlockSize; i++)
+      ASSERT_NEAR(2 * in[c][i], out[c][i], 1e-6);
+
+  // channel 0 starts with 0 but is not silent
+  ASSERT_EQ(0, outBus.silenceFlags);
+}
+
+// RTKernelProcessor - testKernel
+TEST(RTKernelProcessor, testKernel)
+{
+  // native => kernel called with the host sample type
+  {
+    MyKernelProcessor<void> processor{};
+    runKernel<MyKernelProcessor<void>, Sample32>(processor, kSample32, kSample32);
+    runKernel<MyKernelProcessor<void>, Sample64>(processor, kSample64, kSample64);
+  }
+
+  // 32 bits internal precision
+  {
+    MyKernelProcessor<Sample32> processor{};
+    runKernel<MyKernelProcessor<Sample32>, Sample32>(processor, kSample32, kSample32);
+    runKernel<MyKernelProcessor<Sample32>, Sample64>(processor, kSample64, kSample32);
+  }
+
+  // 64 bits internal precision
+  {
+    MyKernelProcessor<Sample64> processor{};
+    runKernel<MyKernelProcessor<Sample64>, Sample32>(processor, kSample32, kSample64);
+    runKernel<MyKernelProcessor<Sample64>, Sample64>(processor, kSample64, kSample64);
+  }
+}
+
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTSpectrumAnalyzer.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTSpectrumAnalyzer {
+
+constexpr double kSampleRate = 48000;
+constexpr int32 kBlockSize = 512;
+
+//------------------------------------------------------------------------
+// sine (at the center of iBin for an FFT of size iFFTSize)
+//------------------------------------------------------------------------
+template<typename SampleType>
+std::vector<SampleType> sine(int32 iNumSamples, int32 iBin, int32 iFFTSize, double iAmplitude)
+{
+  std::vector<SampleType> res(iNumSamples);
+  for(int32 i = 0; i < iNumSamples; i++)
+    res[i] = static_cast<SampleType>(iAmplitude * std::sin(2.0 * 3.14159265358979323846 * iBin * i / iFFTSize));
+  return res;
+}
+
+//------------------------------------------------------------------------
+// peak
+//------------------------------------------------------------------------
+int32 peak(Spectrum const &iSpectrum, int32 iChannel)
+{
+  auto magnitudes = iSpectrum.getChannel(iChannel);
+  return static_cast<int32>(std::max_element(magnitudes, magnitudes + iSpectrum.fNumBins) - magnitudes);
+}
+
+// RTSpectrumAnalyzer - testSine
+TEST(RTSpectrumAnalyzer, testSine)
+{
+  RTSpectrumAnalyzer analyzer{};
+  analyzer.setup({2000, 500, 30, 0.5f, -120.0f}, 2, kSampleRate);
+
+  // rounded up/clamped
+  ASSERT_EQ(2048, analyzer.getConfig().fFFTSize);
+  ASSERT_EQ(500, analyzer.getConfig().fHopSize);
+  ASSERT_EQ(1025, analyzer.getNumBins());
+
+  int frames = 0;
+  analyzer.setCallback([&frames](Spectrum const &s) {
+    frames++;
+    ASSERT_EQ(2, s.fNumChannels);
+    ASSERT_EQ(1025, s.fNumBins);
+  });
+
+  // nothing pushed => nothing delivered
+  ASSERT_FALSE(analyzer.analyze());
+  ASSERT_EQ(0, frames);
+
+  // channel 0: sine (-6dB), channel 1: silence (1s, analyzed 30 times per second)
+  auto samples = sine<Sample32>(kSampleRate, 100, 2048, 0.5);
+  std::vector<Sample32> silence(samples.size());
+  int32 samplesSinceTick = 0;
+  int ticks = 0;
+  for(size_t offset = 0; offset < samples.size(); offset += kBlockSize)
+  {
+    auto count = std::min<int32>(kBlockSize, static_cast<int32>(samples.size() - offset));
+    analyzer.push(0, samples.data() + offset, count);
+    analyzer.push(1, silence.data() + offset, count);
+    samplesSinceTick += count;
+    if(samplesSinceTick >= kSampleRate / 30)
+    {
+      samplesSinceTick = 0;
+      ticks++;
+      ASSERT_TRUE(analyzer.analyze());
+    }
+  }
+
+  // the remaining samples
+  if(analyzer.analyze())
+    ticks++;
+
+  ASSERT_EQ(ticks, frames);
+  ASSERT_EQ(2 * (samples.size() / 500), analyzer.getStats().fFFTCount);
+  ASSERT_EQ(0, analyzer.getStats().fDroppedSamples);
+
+  auto const &spectrum = analyzer.getSpectrum();
+  ASSERT_EQ(100, peak(spectrum, 0));
+  ASSERT_NEAR(100 * kSampleRate / 2048, spectrum.getFrequency(100), 1e-6);
+  ASSERT_NEAR(-6.02, spectrum.getChannel(0)[100], 0.1);
+  ASSERT_LT(spectrum.getChannel(0)[200], -60.0f);
+  for(int32 k = 0; k < spectrum.fNumBins; k++)
+    ASSERT_EQ(-120.0f, spectrum.getChannel(1)[k]);
+
+  // less than a hop => no new FFT
+  analyzer.push(0, samples.data(), 10);
+  ASSERT_FALSE(analyzer.analyze());
+  ASSERT_EQ(ticks, frames);
+}
+
+// RTSpectrumAnalyzer - testPushAudioBuffers (64 bits samples are converted)
+TEST(RTSpectrumAnalyzer, testPushAudioBuffers)
+{
+  RTSpectrumAnalyzer analyzer{};
+  analyzer.setup({1024, 256, 30, 0, -120.0f}, 1, kSampleRate);
+
+  auto samples = sine<Sample64>(1024, 50, 1024, 1.0);
+  Sample64 *ptrs[2]{samples.data(), samples.data()};
+  AudioBusBuffers bus{};
+  bus.numChannels = 2; // channel 1 ignored
+  bus.channelBuffers64 = ptrs;
+  AudioBuffers<Sample64> buffers{bus, static_cast<int32>(samples.size())};
+
+  analyzer.push(buffers);
+  ASSERT_TRUE(analyzer.analyze());
+  ASSERT_EQ(4, analyzer.getStats().fFFTCount);
+  ASSERT_EQ(50, peak(analyzer.getSpectrum(), 0));
+  ASSERT_NEAR(0, analyzer.getSpectrum().getChannel(0)[50], 0.1);
+}
+
+// RTSpectrumAnalyzer - testFallingBehind (only the most recent samples are analyzed)
+TEST(RTSpectrumAnalyzer, testFallingBehind)
+{
+  RTSpectrumAnalyzer analyzer{};
+  analyzer.setup({1024, 1024, 30, 0, -120.0f}, 1, kSampleRate);
+
+  // 10s without analyzing
+  auto samples = sine<Sample32>(kBlockSize, 0, 1024, 0);
+  int32 numSamples = 0;
+  for(; numSamples < 10 * kSampleRate; numSamples += kBlockSize)
+    analyzer.push(0, samples.data(), kBlockSize);
+
+  // max per tick is 2 * 48000 / 30 = 3200 samples => 3 FFTs
+  ASSERT_TRUE(analyzer.analyze());
+  ASSERT_EQ(3, analyzer.getStats().fFFTCount);
+  ASSERT_EQ(numSamples - 3200, analyzer.getStats().fDroppedSamples);
+}
+
+// RTSpectrumAnalyzer - testIdle (nothing pushed => analysis skipped)
+TEST(RTSpectrumAnalyzer, testIdle)
+{
+  RTSpectrumAnalyzer analyzer{};
+  analyzer.setup({1024, 1024, 30, 0, -120.0f}, 2, kSampleRate);
+
+  ASSERT_FALSE(analyzer.analyze());
+  ASSERT_FALSE(analyzer.analyze());
+  ASSERT_EQ(2, analyzer.getStats().fIdleCount);
+  ASSERT_EQ(0, analyzer.getStats().fAnalysisSeconds);
+
+  // one channel only is enough to analyze
+  auto samples = sine<Sample32>(1024, 10, 1024, 1.0);
+  analyzer.push(1, samples.data(), 1024);
+  ASSERT_TRUE(analyzer.analyze());
+  ASSERT_EQ(2, analyzer.getStats().fIdleCount);
+  ASSERT_EQ(1, analyzer.getStats().fFFTCount);
+
+  // everything consumed => idle again
+  ASSERT_FALSE(analyzer.analyze());
+  ASSERT_EQ(3, analyzer.getStats().fIdleCount);
+}
+
+// RTSpectrumAnalyzer - testBackgroundThread
+TEST(RTSpectrumAnalyzer, testBackgroundThread)
+{
+  RTSpectrumAnalyzer analyzer{};
+  analyzer.setup({}, 1, kSampleRate);
+
+  std::atomic<int> peakBin{-1};
+  analyzer.setCallback([&peakBin](Spectrum const &s) { peakBin = peak(s, 0); });
+
+  analyzer.start();
+  ASSERT_TRUE(analyzer.isRunning());
+
+  // the RT thread
+  auto samples = sine<Sample32>(kSampleRate, 200, 2048, 1.0);
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+  for(size_t offset = 0; peakBin != 200 && std::chrono::steady_clock::now() < deadline; offset += kBlockSize)
+  {
+    analyzer.push(0, samples.data() + (offset % (samples.size() - kBlockSize)), kBlockSize);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+
+  analyzer.stop();
+  ASSERT_FALSE(analyzer.isRunning());
+  ASSERT_EQ(200, peakBin);
+  ASSERT_GT(analyzer.getStats().fFrameCount, 0);
+}
+
+// RTSpectrumAnalyzer - benchmarkCPU (cost of the analysis as a percentage of real time, per FFT size/channels)
+TEST(RTSpectrumAnalyzer, DISABLED_benchmarkCPU)
+{
+  constexpr int32 kNumSeconds = 5;
+  constexpr int32 kFramesPerSecond = 30;
+
+  auto samples = sine<Sample32>(kBlockSize, 10, kBlockSize, 0.5);
+
+  for(int32 fftSize: {512, 2048, 8192})
+  {
+    for(int32 numChannels: {1, 2, 8})
+    {
+      RTSpectrumAnalyzer analyzer{};
+      analyzer.setup({fftSize, fftSize / 4, kFramesPerSecond, 0.5f, -120.0f}, numChannels, kSampleRate);
+
+      double pushSeconds = 0;
+      int32 samplesSinceTick = 0;
+      for(int32 i = 0; i < kNumSeconds * kSampleRate; i += kBlockSize)
+      {
+        auto start = std::chrono::steady_clock::now();
+        for(int32 c = 0; c < numChannels; c++)
+          analyzer.push(c, samples.data(), kBlockSize);
+        pushSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        samplesSinceTick += kBlockSize;
+        if(samplesSinceTick >= kSampleRate / kFramesPerSecond)
+        {
+          samplesSinceTick = 0;
+          analyzer.analyze();
+        }
+      }
+
+      auto const &stats = analyzer.getStats();
+      ASSERT_EQ(0, stats.fDroppedSamples);
+
+      std::cout << "Spectrum analyzer (FFT " << fftSize << ", hop " << fftSize / 4 << ", " << numChannels
+                << " channel(s)): background " << stats.fAnalysisSeconds * 100.0 / kNumSeconds << "% CPU ("
+                << stats.fFFTCount << " FFTs, " << stats.fAnalysisSeconds * 1e6 / std::max<uint64>(stats.fFFTCount, 1)
+                << "us/FFT), RT push " << pushSeconds * 100.0 / kNumSeconds << "% CPU" << std::endl;
+    }
+  }
+}
+
+}
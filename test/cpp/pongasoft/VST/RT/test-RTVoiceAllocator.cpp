@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <gtest/gtest.h>
+#include <pongasoft/VST/RT/RTVoiceAllocator.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace pongasoft::VST::RT::TestRTVoiceAllocator {
+
+// noteOnEvent
+Event noteOnEvent(int16 iPitch, float iVelocity = 1.0f, int32 iNoteId = -1)
+{
+  Event e{};
+  e.type = Event::kNoteOnEvent;
+  e.noteOn.pitch = iPitch;
+  e.noteOn.velocity = iVelocity;
+  e.noteOn.noteId = iNoteId;
+  return e;
+}
+
+// noteOffEvent
+Event noteOffEvent(int16 iPitch, int32 iNoteId = -1)
+{
+  Event e{};
+  e.type = Event::kNoteOffEvent;
+  e.noteOff.pitch = iPitch;
+  e.noteOff.noteId = iNoteId;
+  return e;
+}
+
+// RTVoiceAllocator - testAllocate
+TEST(RTVoiceAllocator, testAllocate)
+{
+  using Allocator = RTVoiceAllocator<4>;
+  Allocator voices{EVoiceStealingPolicy::kNone};
+
+  auto res = voices.handleEvent(noteOnEvent(60));
+  ASSERT_EQ(Allocator::NoteEvent::kNoteOn, res.fType);
+  ASSERT_EQ(0, res.fVoice);
+  ASSERT_FALSE(res.fStolen);
+  ASSERT_EQ(60, voices.getPitch(0));
+
+  ASSERT_EQ(1, voices.handleEvent(noteOnEvent(62)).fVoice);
+  ASSERT_EQ(2, voices.handleEvent(noteOnEvent(64)).fVoice);
+  ASSERT_EQ(3, voices.handleEvent(noteOnEvent(65)).fVoice);
+  ASSERT_EQ(4, voices.getActiveVoiceCount());
+
+  // no stealing => ignored
+  ASSERT_EQ(Allocator::NoteEvent::kIgnored, voices.handleEvent(noteOnEvent(67)).fType);
+
+  // retrigger => same voice
+  res = voices.handleEvent(noteOnEvent(62, 0.5f));
+  ASSERT_EQ(1, res.fVoice);
+  ASSERT_TRUE(res.fStolen);
+  ASSERT_FLOAT_EQ(0.5f, voices.getVelocity(1));
+
+  // note off => released (still in use)
+  res = voices.handleEvent(noteOffEvent(64));
+  ASSERT_EQ(Allocator::NoteEvent::kNoteOff, res.fType);
+  ASSERT_EQ(2, res.fVoice);
+  ASSERT_TRUE(voices.isReleased(2));
+  ASSERT_EQ(4, voices.getActiveVoiceCount());
+
+  // note off for a note not playing => ignored
+  ASSERT_EQ(Allocator::NoteEvent::kIgnored, voices.handleEvent(noteOffEvent(70)).fType);
+
+  // velocity 0 => note off
+  ASSERT_EQ(Allocator::NoteEvent::kNoteOff, voices.handleEvent(noteOnEvent(60, 0)).fType);
+  ASSERT_TRUE(voices.isReleased(0));
+
+  // free => back to the pool and the list of active voices is still dense
+  voices.freeVoice(2);
+  voices.freeVoice(2); // no op
+  ASSERT_EQ(3, voices.getActiveVoiceCount());
+  std::vector<int32> active{voices.activeVoices().begin(), voices.activeVoices().end()};
+  std::sort(active.begin(), active.end());
+  ASSERT_EQ((std::vector<int32>{0, 1, 3}), active);
+  ASSERT_EQ(2, voices.handleEvent(noteOnEvent(67)).fVoice);
+
+  // note id takes precedence over pitch
+  voices.reset();
+  ASSERT_EQ(0, voices.noteOn(0, 60, 1.0f, 100).fVoice);
+  ASSERT_EQ(1, voices.noteOn(0, 62, 1.0f, 101).fVoice);
+  ASSERT_EQ(1, voices.handleEvent(noteOffEvent(60, 101)).fVoice);
+
+  // non note events are ignored
+  Event e{};
+  e.type = Event::kDataEvent;
+  ASSERT_EQ(Allocator::NoteEvent::kIgnored, voices.handleEvent(e).fType);
+}
+
+// RTVoiceAllocator - testStealing
+TEST(RTVoiceAllocator, testStealing)
+{
+  using Allocator = RTVoiceAllocator<3>;
+
+  // oldest
+  {
+    Allocator voices{EVoiceStealingPolicy::kOldest};
+    voices.noteOn(0, 60, 1.0f);
+    voices.noteOn(0, 62, 1.0f);
+    voices.noteOn(0, 64, 1.0f);
+    voices.noteOff(0, 62);
+    auto res = voices.noteOn(0, 65, 1.0f);
+    ASSERT_EQ(0, res.fVoice);
+    ASSERT_TRUE(res.fStolen);
+    ASSERT_EQ(65, voices.getPitch(0));
+    ASSERT_EQ(1, voices.getStolenCount());
+    ASSERT_EQ(1, voices.noteOn(0, 67, 1.0f).fVoice);
+  }
+
+  // released first
+  {
+    Allocator voices{};
+    voices.noteOn(0, 60, 1.0f);
+    voices.noteOn(0, 62, 1.0f);
+    voices.noteOn(0, 64, 1.0f);
+    voices.noteOff(0, 64);
+    voices.noteOff(0, 62);
+    ASSERT_EQ(1, voices.noteOn(0, 65, 1.0f).fVoice); // oldest released
+    ASSERT_EQ(2, voices.noteOn(0, 67, 1.0f).fVoice); // released
+    ASSERT_EQ(0, voices.noteOn(0, 69, 1.0f).fVoice); // none released => oldest
+  }
+
+  // quietest
+  {
+    Allocator voices{EVoiceStealingPolicy::kQuietest};
+    voices.noteOn(0, 60, 0.9f);
+    voices.noteOn(0, 62, 0.2f);
+    voices.noteOn(0, 64, 0.5f);
+    ASSERT_EQ(1, voices.noteOn(0, 65, 1.0f).fVoice);
+    voices.setLevel(2, 0.01f);
+    ASSERT_EQ(2, voices.noteOn(0, 67, 1.0f).fVoice);
+  }
+}
+
+//------------------------------------------------------------------------
+// Synth: a (very) simple synth rendering all the voices in one loop, per voice state as a structure of arrays
+//------------------------------------------------------------------------
+template<int32 MaxVoices>
+struct SynthVoices
+{
+  std::array<float, MaxVoices> fPhase{};
+  std::array<float, MaxVoices> fIncrement{};
+  std::array<float, MaxVoices> fGain{};
+  std::array<float, MaxVoices> fDecay{};
+};
+
+template<int32 MaxVoices>
+class Synth
+{
+public:
+  using Allocator = RTVoiceAllocator<MaxVoices, SynthVoices<MaxVoices>>;
+
+  void handleEvent(Event const &iEvent)
+  {
+    auto res = fVoices.handleEvent(iEvent);
+    auto &data = fVoices.data();
+    if(res.fType == Allocator::NoteEvent::kNoteOn)
+    {
+      data.fPhase[res.fVoice] = 0;
+      data.fIncrement[res.fVoice] = 440.0f * std::pow(2.0f, (iEvent.noteOn.pitch - 69) / 12.0f) / 44100.0f;
+      data.fGain[res.fVoice] = iEvent.noteOn.velocity;
+      data.fDecay[res.fVoice] = 1.0f;
+    }
+    else if(res.fType == Allocator::NoteEvent::kNoteOff)
+      data.fDecay[res.fVoice] = 0.999f;
+  }
+
+  void render(float *oBuffer, int32 iNumSamples)
+  {
+    auto &data = fVoices.data();
+
+    std::fill(oBuffer, oBuffer + iNumSamples, 0.0f);
+    for(auto v: fVoices.activeVoices())
+    {
+      auto phase = data.fPhase[v];
+      auto increment = data.fIncrement[v];
+      auto gain = data.fGain[v];
+      auto decay = data.fDecay[v];
+      for(int32 i = 0; i < iNumSamples; i++)
+      {
+        oBuffer[i] += gain * (2.0f * phase - 1.0f); // saw
+        phase += increment;
+        phase -= static_cast<float>(phase >= 1.0f);
+        gain *= decay;
+      }
+      data.fPhase[v] = phase;
+      data.fGain[v] = gain;
+      fVoices.setLevel(v, gain);
+    }
+
+    // free the voices which are done (reverse order, see freeVoice)
+    for(auto i = fVoices.getActiveVoiceCount() - 1; i >= 0; i--)
+    {
+      auto v = fVoices.getActiveVoice(i);
+      if(fVoices.isReleased(v) && data.fGain[v] < 1e-4f)
+        fVoices.freeVoice(v);
+    }
+  }
+
+  Allocator fVoices{};
+};
+
+// benchmark: plays chords (note on/off churn) with all the voices used
+template<int32 MaxVoices>
+void benchmark()
+{
+  constexpr int32 kBlockSize = 128;
+  constexpr int32 kBlocks = 2000;
+
+  Synth<MaxVoices> synth{};
+  std::vector<float> buffer(kBlockSize);
+
+  std::mt19937 random{MaxVoices};
+  std::uniform_int_distribution<int> pitches{24, 96};
+
+  int32 noteOnCount = 0;
+  auto start = std::chrono::steady_clock::now();
+  for(int32 b = 0; b < kBlocks; b++)
+  {
+    // every 4 blocks, a quarter of the voices start a note and another quarter stops
+    if(b % 4 == 0)
+    {
+      for(int32 n = 0; n < std::max(MaxVoices / 4, 1); n++)
+      {
+        auto pitch = static_cast<int16>(pitches(random));
+        synth.handleEvent(noteOnEvent(pitch, 0.5f));
+        synth.handleEvent(noteOffEvent(static_cast<int16>(pitches(random))));
+        noteOnCount++;
+      }
+    }
+    synth.render(buffer.data(), kBlockSize);
+  }
+  auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  ASSERT_GT(synth.fVoices.getActiveVoiceCount(), 0);
+  ASSERT_LE(synth.fVoices.getActiveVoiceCount(), MaxVoices);
+
+  std::cout << MaxVoices << " voices: " << time << "ms for " << kBlocks << " blocks of " << kBlockSize << " samples ("
+            << noteOnCount << " notes, " << synth.fVoices.getStolenCount() << " stolen, "
+            << synth.fVoices.getActiveVoiceCount() << " active at the end)" << std::endl;
+}
+
+// RTVoiceAllocator - benchmarkVoices
+TEST(RTVoiceAllocator, DISABLED_benchmarkVoices)
+{
+  benchmark<8>();
+  benchmark<64>();
+  benchmark<256>();
+}
+
+}
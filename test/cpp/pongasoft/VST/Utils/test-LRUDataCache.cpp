@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <pongasoft/VST/VstUtils/LRUDataCache.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+namespace pongasoft::VST::VstUtils::TestLRUDataCache {
+
+using Cache = LRUDataCache<int, std::string>;
+
+// stringLoader (counts the number of calls)
+Cache::Loader stringLoader(std::shared_ptr<int> const &iLoadCount)
+{
+  return [iLoadCount](int const &iKey) -> std::shared_ptr<std::string> {
+    (*iLoadCount)++;
+    if(iKey < 0)
+      return nullptr;
+    return std::make_shared<std::string>(std::to_string(iKey));
+  };
+}
+
+// stringSizer
+size_t stringSizer(std::string const &iString) { return 100; }
+
+// LRUDataCache - testLRU
+TEST(LRUDataCache, testLRU)
+{
+  auto manager = std::make_shared<DataCacheManager>();
+  auto loadCount = std::make_shared<int>(0);
+
+  Cache cache{stringLoader(loadCount), {0, 2}, stringSizer, manager};
+
+  ASSERT_EQ("1", *cache.getData(1));
+  ASSERT_EQ("2", *cache.getData(2));
+  ASSERT_EQ("1", *cache.getData(1)); // hit => 1 is now the most recently used
+  ASSERT_EQ(2, *loadCount);
+  ASSERT_EQ(200, cache.getSizeInBytes());
+  ASSERT_EQ(200, manager->getSizeInBytes());
+
+  // evicts 2
+  ASSERT_EQ("3", *cache.getData(3));
+  ASSERT_EQ(2, cache.getEntryCount());
+  ASSERT_EQ(1, cache.getStats().fEvictions);
+  ASSERT_EQ("1", *cache.getData(1));
+  ASSERT_EQ(3, *loadCount);
+  ASSERT_EQ("2", *cache.getData(2));
+  ASSERT_EQ(4, *loadCount);
+
+  // nullptr is not cached
+  ASSERT_EQ(nullptr, cache.getData(-1));
+  ASSERT_EQ(nullptr, cache.getData(-1));
+  ASSERT_EQ(6, *loadCount);
+
+  ASSERT_EQ(2, cache.getStats().fHits);
+  ASSERT_EQ(6, cache.getStats().fMisses);
+
+  cache.invalidate(2);
+  ASSERT_EQ(1, cache.getEntryCount());
+  cache.clear();
+  ASSERT_EQ(0, cache.getEntryCount());
+  ASSERT_EQ(0, manager->getSizeInBytes());
+}
+
+// LRUDataCache - testTTL
+TEST(LRUDataCache, testTTL)
+{
+  auto manager = std::make_shared<DataCacheManager>();
+  auto loadCount = std::make_shared<int>(0);
+
+  Cache cache{stringLoader(loadCount), {1000}, stringSizer, manager};
+
+  cache.getData(1);
+  cache.getData(2);
+  auto t1 = DataCacheManager::clock::now(); // >= access time of 1 and 2
+
+  manager->sweep(t1 + std::chrono::milliseconds(500));
+  ASSERT_EQ(2, cache.getEntryCount());
+
+  // accessing 2 extends its TTL
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  cache.getData(2); // access time of 2 >= t1 + 20ms
+
+  manager->sweep(t1 + std::chrono::milliseconds(1010));
+  ASSERT_EQ(1, cache.getEntryCount());
+  ASSERT_EQ(1, cache.getStats().fExpirations);
+  ASSERT_EQ("2", *cache.getData(2));
+  ASSERT_EQ(2, *loadCount);
+
+  manager->sweep(DataCacheManager::clock::now() + std::chrono::milliseconds(1000));
+  ASSERT_EQ(0, cache.getEntryCount());
+  ASSERT_EQ(2, cache.getStats().fExpirations);
+  ASSERT_FALSE(manager->isSweeping());
+}
+
+// LRUDataCache - testMemoryBudget
+TEST(LRUDataCache, testMemoryBudget)
+{
+  auto manager = std::make_shared<DataCacheManager>(250);
+  auto loadCount = std::make_shared<int>(0);
+
+  Cache cache1{stringLoader(loadCount), {}, stringSizer, manager};
+  Cache cache2{stringLoader(loadCount), {}, stringSizer, manager};
+
+  cache1.getData(1);
+  cache2.getData(1);
+  ASSERT_EQ(200, manager->getSizeInBytes());
+
+  // exceeds the budget => evicts the least recently used entry across all caches (cache1[1])
+  cache2.getData(2);
+  ASSERT_EQ(200, manager->getSizeInBytes());
+  ASSERT_EQ(0, cache1.getEntryCount());
+  ASSERT_EQ(2, cache2.getEntryCount());
+  ASSERT_EQ(1, cache1.getStats().fEvictions);
+  ASSERT_EQ(1, manager->getBudgetEvictionCount());
+
+  // shrinking the budget
+  manager->setMemoryBudgetInBytes(100);
+  ASSERT_EQ(1, cache2.getEntryCount());
+  ASSERT_EQ("2", *cache2.getData(2));
+}
+
+// LRUDataCache - testBackgroundLoading
+TEST(LRUDataCache, testBackgroundLoading)
+{
+  auto manager = std::make_shared<DataCacheManager>();
+  auto loadCount = std::make_shared<int>(0);
+
+  Cache cache{stringLoader(loadCount), {0, 0, true}, stringSizer, manager};
+
+  ASSERT_EQ(nullptr, cache.tryGetData(1));
+  cache.prefetch(2);
+  cache.prefetch(2); // already in flight
+  manager->getWorker().waitForIdle();
+  ASSERT_EQ(2, *loadCount);
+
+  ASSERT_EQ("1", *cache.tryGetData(1));
+  ASSERT_EQ("2", *cache.tryGetData(2));
+  ASSERT_EQ(2, *loadCount);
+  ASSERT_EQ(2, cache.getStats().fHits);
+  ASSERT_EQ(1, cache.getStats().fMisses);
+
+  // getData is synchronous
+  ASSERT_EQ("3", *cache.getData(3));
+  ASSERT_EQ(3, *loadCount);
+}
+
+// LRUDataCache - testShutdown
+TEST(LRUDataCache, testShutdown)
+{
+  auto manager = std::make_shared<DataCacheManager>();
+  auto loadCount = std::make_shared<int>(0);
+
+  Cache cache{stringLoader(loadCount), {0, 0, true}, stringSizer, manager};
+
+  cache.prefetch(1);
+  ASSERT_TRUE(manager->getWorker().isRunning());
+
+  // the pending jobs are executed before the thread stops
+  manager->shutdown();
+  ASSERT_FALSE(manager->getWorker().isRunning());
+  ASSERT_EQ(1, *loadCount);
+  ASSERT_EQ("1", *cache.tryGetData(1));
+
+  // restarted on demand
+  cache.prefetch(2);
+  manager->getWorker().waitForIdle();
+  ASSERT_EQ("2", *cache.tryGetData(2));
+  manager->shutdown();
+}
+
+// DataCacheManager - testGlobalUsers (the last user shuts the global manager down)
+TEST(DataCacheManager, testGlobalUsers)
+{
+  auto const &global = DataCacheManager::global();
+  auto users = DataCacheManager::getGlobalUserCount();
+
+  DataCacheManager::acquireGlobal();
+  DataCacheManager::acquireGlobal();
+  global->getWorker().submit([] {});
+  ASSERT_TRUE(global->getWorker().isRunning());
+
+  DataCacheManager::releaseGlobal();
+  ASSERT_EQ(users + 1, DataCacheManager::getGlobalUserCount());
+  ASSERT_TRUE(global->getWorker().isRunning());
+
+  DataCacheManager::releaseGlobal();
+  ASSERT_EQ(users, DataCacheManager::getGlobalUserCount());
+  if(users == 0)
+    ASSERT_FALSE(global->getWorker().isRunning());
+}
+
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <pongasoft/VST/MessageHandler.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace pongasoft::VST::TestMessageHandler {
+
+//------------------------------------------------------------------------
+// MyAttributeList - (int only) string keyed attribute list, similar to what hosts provide
+//------------------------------------------------------------------------
+class MyAttributeList : public IAttributeList
+{
+public:
+  tresult PLUGIN_API setInt(AttrID id, int64 value) SMTG_OVERRIDE { fInts[id] = value; return kResultOk; }
+  tresult PLUGIN_API getInt(AttrID id, int64 &value) SMTG_OVERRIDE
+  {
+    auto iter = fInts.find(id);
+    if(iter == fInts.end())
+      return kResultFalse;
+    value = iter->second;
+    return kResultOk;
+  }
+  tresult PLUGIN_API setFloat(AttrID id, double value) SMTG_OVERRIDE { return kNotImplemented; }
+  tresult PLUGIN_API getFloat(AttrID id, double &value) SMTG_OVERRIDE { return kNotImplemented; }
+  tresult PLUGIN_API setString(AttrID id, const TChar *string) SMTG_OVERRIDE { return kNotImplemented; }
+  tresult PLUGIN_API getString(AttrID id, TChar *string, uint32 sizeInBytes) SMTG_OVERRIDE { return kNotImplemented; }
+  tresult PLUGIN_API setBinary(AttrID id, const void *data, uint32 sizeInBytes) SMTG_OVERRIDE { return kNotImplemented; }
+  tresult PLUGIN_API getBinary(AttrID id, const void *&data, uint32 &sizeInBytes) SMTG_OVERRIDE { return kNotImplemented; }
+
+  // the objects live on the stack => no ref counting
+  tresult PLUGIN_API queryInterface(const TUID _iid, void **obj) SMTG_OVERRIDE { return kNoInterface; }
+  uint32 PLUGIN_API addRef() SMTG_OVERRIDE { return 1; }
+  uint32 PLUGIN_API release() SMTG_OVERRIDE { return 1; }
+
+private:
+  std::map<std::string, int64> fInts{};
+};
+
+//------------------------------------------------------------------------
+// MyMessage
+//------------------------------------------------------------------------
+class MyMessage : public IMessage
+{
+public:
+  FIDString PLUGIN_API getMessageID() SMTG_OVERRIDE { return "MyMessage"; }
+  void PLUGIN_API setMessageID(FIDString id) SMTG_OVERRIDE {}
+  IAttributeList *PLUGIN_API getAttributes() SMTG_OVERRIDE { return &fAttributes; }
+
+  tresult PLUGIN_API queryInterface(const TUID _iid, void **obj) SMTG_OVERRIDE { return kNoInterface; }
+  uint32 PLUGIN_API addRef() SMTG_OVERRIDE { return 1; }
+  uint32 PLUGIN_API release() SMTG_OVERRIDE { return 1; }
+
+private:
+  MyAttributeList fAttributes{};
+};
+
+//------------------------------------------------------------------------
+// MyHandler
+//------------------------------------------------------------------------
+struct MyHandler : public IMessageHandler
+{
+  tresult handleMessage(Message const &iMessage) override
+  {
+    fLastMessageID = iMessage.getMessageID();
+    fCount++;
+    return kResultOk;
+  }
+
+  MessageID fLastMessageID{-1};
+  int fCount{0};
+};
+
+// sendMessage
+tresult sendMessage(IMessageHandler &iHandler, MyMessage &iMessage, MessageID iMessageID)
+{
+  Message m{&iMessage};
+  m.setMessageID(iMessageID);
+  Message r{&iMessage};
+  return iHandler.handleMessage(r);
+}
+
+// MessageHandler - testDispatch
+TEST(MessageHandler, testDispatch)
+{
+  MyMessage message{};
+
+  // dense ids
+  {
+    MessageHandler handler{};
+    MyHandler h1{}, h2{}, h3{};
+    handler.registerHandler(1002, &h2);
+    handler.registerHandler(1000, &h1);
+    handler.registerHandler(1005, &h3);
+    ASSERT_EQ(3, handler.getHandlerCount());
+
+    ASSERT_EQ(kResultOk, sendMessage(handler, message, 1000));
+    ASSERT_EQ(1000, h1.fLastMessageID);
+    ASSERT_EQ(kResultOk, sendMessage(handler, message, 1005));
+    ASSERT_EQ(1005, h3.fLastMessageID);
+    ASSERT_EQ(kResultFalse, sendMessage(handler, message, 1001));
+    ASSERT_EQ(kResultFalse, sendMessage(handler, message, 999));
+    ASSERT_EQ(kResultFalse, sendMessage(handler, message, 1006));
+    ASSERT_EQ(kResultFalse, sendMessage(handler, message, -1));
+    ASSERT_EQ(0, h2.fCount);
+
+    // replaces the handler
+    MyHandler h4{};
+    handler.registerHandler(1002, &h4);
+    ASSERT_EQ(3, handler.getHandlerCount());
+    ASSERT_EQ(kResultOk, sendMessage(handler, message, 1002));
+    ASSERT_EQ(0, h2.fCount);
+    ASSERT_EQ(1, h4.fCount);
+  }
+
+  // sparse ids
+  {
+    MessageHandler handler{};
+    MyHandler h1{}, h2{};
+    handler.registerHandler(3, &h1);
+    handler.registerHandler(1000000, &h2);
+
+    ASSERT_EQ(&h1, handler.findHandler(3));
+    ASSERT_EQ(&h2, handler.findHandler(1000000));
+    ASSERT_EQ(nullptr, handler.findHandler(4));
+    ASSERT_EQ(kResultOk, sendMessage(handler, message, 1000000));
+    ASSERT_EQ(1000000, h2.fLastMessageID);
+  }
+
+  // no message id
+  {
+    MessageHandler handler{};
+    MyHandler h1{};
+    handler.registerHandler(-1, &h1);
+    MyMessage noID{};
+    ASSERT_EQ(kResultOk, handler.handleMessage(Message{&noID}));
+    ASSERT_EQ(-1, h1.fLastMessageID);
+  }
+}
+
+//------------------------------------------------------------------------
+// MapMessageHandler - reference implementation (previous implementation) for the benchmark
+//------------------------------------------------------------------------
+struct MapMessageHandler : public IMessageHandler
+{
+  tresult handleMessage(Message const &iMessage) override
+  {
+    auto iter = fHandlers.find(iMessage.getMessageID());
+    return iter == fHandlers.cend() ? kResultFalse : iter->second->handleMessage(iMessage);
+  }
+
+  std::map<MessageID, IMessageHandler *> fHandlers{};
+};
+
+// benchmarkRoundTrip
+template<typename Handler>
+double benchmarkRoundTrip(Handler &iHandler, int iNumHandlers, int iIterations)
+{
+  MyMessage message{};
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < iIterations; i++)
+    sendMessage(iHandler, message, 1000 + (i * 7) % iNumHandlers);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / iIterations;
+}
+
+// MessageHandler - benchmarkRoundTrip (message round trip cost with 10/100/1000 registered jmb params)
+TEST(MessageHandler, DISABLED_benchmarkRoundTrip)
+{
+  constexpr int kIterations = 100000;
+
+  for(int numHandlers: {10, 100, 1000})
+  {
+    std::vector<MyHandler> handlers(numHandlers);
+    MessageHandler handler{};
+    MapMessageHandler mapHandler{};
+    for(int i = 0; i < numHandlers; i++)
+    {
+      handler.registerHandler(1000 + i, &handlers[i]);
+      mapHandler.fHandlers[1000 + i] = &handlers[i];
+    }
+
+    auto mapTime = benchmarkRoundTrip(mapHandler, numHandlers, kIterations);
+    auto time = benchmarkRoundTrip(handler, numHandlers, kIterations);
+
+    std::cout << "MessageHandler[" << numHandlers << "] round trip: " << time << "ns (std::map: " << mapTime << "ns)"
+              << std::endl;
+
+    int count = 0;
+    for(auto &h: handlers)
+      count += h.fCount;
+    ASSERT_EQ(2 * kIterations, count);
+  }
+}
+
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <gtest/gtest.h>
+#include <pongasoft/VST/NormalizedState.h>
+#include <pongasoft/VST/Parameters.h>
+#include <pongasoft/VST/VstUtils/FastWriteMemoryStream.h>
+#include <pongasoft/VST/VstUtils/ReadOnlyMemoryStream.h>
+
+namespace pongasoft::VST::TestNormalizedState {
+
+// NormalizedState - testFindIndexDense
+TEST(NormalizedState, testFindIndexDense)
+{
+  NormalizedState::SaveOrder saveOrder{1, {1003, 1000, 1002}};
+  saveOrder.buildIndex();
+
+  ASSERT_FALSE(saveOrder.fDenseIndex.empty());
+  ASSERT_EQ(1, saveOrder.findIndex(1000));
+  ASSERT_EQ(-1, saveOrder.findIndex(1001));
+  ASSERT_EQ(2, saveOrder.findIndex(1002));
+  ASSERT_EQ(0, saveOrder.findIndex(1003));
+  ASSERT_EQ(-1, saveOrder.findIndex(999));
+  ASSERT_EQ(-1, saveOrder.findIndex(1004));
+  ASSERT_EQ(-1, saveOrder.findIndex(0));
+
+  // adding keeps the index in sync
+  saveOrder.addParamID(1001);
+  saveOrder.addParamID(10);
+  ASSERT_EQ(saveOrder.getCount(), saveOrder.fIndexedCount);
+  ASSERT_EQ(3, saveOrder.findIndex(1001));
+  ASSERT_EQ(4, saveOrder.findIndex(10));
+  ASSERT_EQ(1, saveOrder.findIndex(1000));
+
+  // modifying fOrder directly => falls back to linear search
+  saveOrder.fOrder.emplace_back(5);
+  ASSERT_EQ(5, saveOrder.findIndex(5));
+  ASSERT_EQ(4, saveOrder.findIndex(10));
+}
+
+// NormalizedState - testFindIndexSparse
+TEST(NormalizedState, testFindIndexSparse)
+{
+  NormalizedState::SaveOrder saveOrder{1, {0x7fffffff, 3, 0x10000, 3}};
+  saveOrder.buildIndex();
+
+  ASSERT_TRUE(saveOrder.fDenseIndex.empty());
+  ASSERT_EQ(0, saveOrder.findIndex(0x7fffffff));
+  ASSERT_EQ(1, saveOrder.findIndex(3)); // first one wins
+  ASSERT_EQ(2, saveOrder.findIndex(0x10000));
+  ASSERT_EQ(-1, saveOrder.findIndex(4));
+
+  saveOrder.addParamID(4);
+  ASSERT_EQ(4, saveOrder.findIndex(4));
+  ASSERT_EQ(1, saveOrder.findIndex(3));
+
+  NormalizedState::SaveOrder empty{};
+  empty.buildIndex();
+  ASSERT_EQ(-1, empty.findIndex(0));
+}
+
+constexpr int kNumParams = 5000;
+constexpr ParamID kFirstParamID = 1000;
+constexpr ParamID kDeprecatedParamID = 100;
+
+//------------------------------------------------------------------------
+// LargeParameters => version 1 saved the parameters in reverse order (+ 1 param that is now deprecated),
+// version 2 saves them in registration order
+//------------------------------------------------------------------------
+class LargeParameters : public Parameters
+{
+public:
+  LargeParameters()
+  {
+    raw(kDeprecatedParamID, STR16("deprecated")).deprecatedSince(1).add();
+
+    std::vector<ParamID> ids{};
+    for(int i = 0; i < kNumParams; i++)
+    {
+      auto id = kFirstParamID + i;
+      raw(id, STR16("param")).add();
+      ids.emplace_back(id);
+    }
+
+    setRTSaveStateOrder({2, ids});
+
+    std::reverse(ids.begin(), ids.end());
+    ids.emplace_back(kDeprecatedParamID);
+    setRTDeprecatedSaveStateOrder({1, ids});
+  }
+
+  tresult handleRTStateUpgrade(NormalizedState const &iDeprecatedState, NormalizedState &oNewState) const override
+  {
+    ParamValue value;
+    if(iDeprecatedState.getNormalizedValue(kDeprecatedParamID, value) == kResultTrue)
+      oNewState.setNormalizedValue(kFirstParamID, value);
+    return kResultTrue;
+  }
+};
+
+// NormalizedState - testLargeUpgrade
+TEST(NormalizedState, testLargeUpgrade)
+{
+  LargeParameters params{};
+
+  ASSERT_EQ(kNumParams, params.getRTSaveStateOrder().getCount());
+  ASSERT_EQ(kNumParams, params.getRTSaveStateOrder().fIndexedCount);
+
+  // write a version 1 state
+  VstUtils::FastWriteMemoryStream stream{};
+  {
+    IBStreamer streamer(&stream, kLittleEndian);
+    streamer.writeInt16u(1);
+    // reverse order
+    for(int i = kNumParams - 1; i >= 0; i--)
+      streamer.writeDouble(static_cast<ParamValue>(i) / kNumParams);
+    // deprecated param
+    streamer.writeDouble(0.5);
+  }
+
+  // read it back in the latest state
+  VstUtils::ReadOnlyMemoryStream readStream{stream.getData(), stream.getSize()};
+  IBStreamer streamer(&readStream, kLittleEndian);
+  auto state = params.newRTState();
+  ASSERT_EQ(kResultOk, params.readRTState(streamer, state.get()));
+
+  // upgraded by handleRTStateUpgrade
+  ASSERT_EQ(0.5, state->get(0));
+  for(int i = 1; i < kNumParams; i++)
+  {
+    ASSERT_EQ(static_cast<ParamValue>(i) / kNumParams, state->get(i));
+    ParamValue value;
+    ASSERT_EQ(kResultTrue, state->getNormalizedValue(kFirstParamID + i, value));
+    ASSERT_EQ(state->get(i), value);
+  }
+
+  // copy (same order => all values)
+  auto copy = params.newRTState();
+  ASSERT_EQ(kNumParams, state->copyValuesTo(*copy));
+  for(int i = 0; i < kNumParams; i++)
+    ASSERT_EQ(state->get(i), copy->get(i));
+}
+
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <pongasoft/VST/Oversampler.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace pongasoft::VST::TestOversampler {
+
+constexpr double kPi = 3.14159265358979323846;
+
+//------------------------------------------------------------------------
+// Bus (owns the memory of an AudioBusBuffers)
+//------------------------------------------------------------------------
+struct Bus
+{
+  Bus(int32 iNumChannels, int32 iNumSamples) :
+    fSamples(static_cast<size_t>(iNumChannels), std::vector<Sample32>(static_cast<size_t>(iNumSamples))),
+    fPtrs(static_cast<size_t>(iNumChannels)),
+    fNumSamples{iNumSamples}
+  {
+    for(size_t c = 0; c < fSamples.size(); c++)
+      fPtrs[c] = fSamples[c].data();
+    fBusBuffers.numChannels = iNumChannels;
+    fBusBuffers.channelBuffers32 = fPtrs.data();
+  }
+
+  AudioBuffers32 buffers() { return AudioBuffers32{fBusBuffers, fNumSamples}; }
+
+  std::vector<std::vector<Sample32>> fSamples;
+  std::vector<Sample32 *> fPtrs;
+  int32 fNumSamples;
+  AudioBusBuffers fBusBuffers{};
+};
+
+// Oversampler - testConfiguration
+TEST(Oversampler, testConfiguration)
+{
+  ASSERT_EQ(1, Oversampler<Sample32>(1).getFactor());
+  ASSERT_EQ(2, Oversampler<Sample32>(2).getFactor());
+  ASSERT_EQ(4, Oversampler<Sample32>(3).getFactor());
+  ASSERT_EQ(8, Oversampler<Sample32>(8).getFactor());
+  ASSERT_EQ(8, Oversampler<Sample32>(16).getFactor());
+
+  ASSERT_EQ(47, Oversampler<Sample32>(2).getNumTaps());
+  ASSERT_EQ(31, Oversampler<Sample32>(2, 30).getNumTaps());
+
+  // 2x: center tap (23) at the oversampled rate, twice (up + down)
+  ASSERT_EQ(0, Oversampler<Sample32>(1).getLatencySamples());
+  ASSERT_EQ(23.0, Oversampler<Sample32>(2).getLatency());
+  ASSERT_EQ(23.0 + 11.5, Oversampler<Sample32>(4).getLatency());
+  ASSERT_EQ(23.0 + 11.5 + 5.75, Oversampler<Sample32>(8).getLatency());
+  ASSERT_EQ(40, Oversampler<Sample32>(8).getLatencySamples());
+}
+
+// Oversampler - testIdentity (a sine in the pass band comes out unchanged, delayed by the latency)
+TEST(Oversampler, testIdentity)
+{
+  constexpr int32 kBlockSize = 64;
+  constexpr int32 kNumBlocks = 32;
+  constexpr double kFrequency = 0.02; // cycles per sample (~880Hz at 44.1kHz)
+
+  for(int32 factor: {1, 2, 4, 8})
+  {
+    Oversampler<Sample32> oversampler{factor};
+    oversampler.setup(2, kBlockSize);
+
+    auto latency = oversampler.getLatency();
+
+    Bus bus{2, kBlockSize};
+    int32 kernelSamples = 0;
+    double maxError = 0;
+
+    for(int32 b = 0; b < kNumBlocks; b++)
+    {
+      for(int32 c = 0; c < 2; c++)
+        for(int32 i = 0; i < kBlockSize; i++)
+          bus.fSamples[c][i] = static_cast<Sample32>((c + 1) * 0.5 * std::sin(2 * kPi * kFrequency * (b * kBlockSize + i)));
+
+      // in place (in == out)
+      auto buffers = bus.buffers();
+      ASSERT_TRUE(oversampler.process(buffers, buffers, [&kernelSamples](Sample32 s, int32) { kernelSamples++; return s; }));
+
+      // skip the first blocks (filters warming up)
+      if(b < 4)
+        continue;
+
+      for(int32 c = 0; c < 2; c++)
+      {
+        for(int32 i = 0; i < kBlockSize; i++)
+        {
+          auto expected = (c + 1) * 0.5 * std::sin(2 * kPi * kFrequency * (b * kBlockSize + i - latency));
+          maxError = std::max(maxError, std::abs(expected - bus.fSamples[c][i]));
+        }
+      }
+    }
+
+    ASSERT_EQ(kNumBlocks * kBlockSize * 2 * factor, kernelSamples);
+    ASSERT_LT(maxError, 1e-3) << "factor=" << factor;
+  }
+}
+
+// Oversampler - testAliasing (a hard clipper generates harmonics above Nyquist which fold back without oversampling)
+TEST(Oversampler, testAliasing)
+{
+  constexpr int32 kBlockSize = 256;
+  constexpr int32 kNumBlocks = 16;
+  constexpr double kFrequency = 0.1234; // cycles per sample (harmonics 5, 7, ... are above Nyquist)
+
+  auto measure = [](int32 iFactor) {
+    Oversampler<Sample32> oversampler{iFactor};
+    oversampler.setup(1, kBlockSize);
+
+    std::vector<Sample32> output{};
+    Bus bus{1, kBlockSize};
+    for(int32 b = 0; b < kNumBlocks; b++)
+    {
+      for(int32 i = 0; i < kBlockSize; i++)
+        bus.fSamples[0][i] = static_cast<Sample32>(std::sin(2 * kPi * kFrequency * (b * kBlockSize + i)));
+      auto buffers = bus.buffers();
+      oversampler.process(buffers, buffers, [](Sample32 s, int32) { return std::clamp(s * 4.0f, -1.0f, 1.0f); });
+      output.insert(output.end(), bus.fSamples[0].begin(), bus.fSamples[0].end());
+    }
+
+    // energy of the signal once the odd harmonics below Nyquist are removed (projection on sin/cos at each harmonic)
+    auto start = output.size() / 2;
+    auto n = output.size() - start;
+    std::vector<double> residual(output.begin() + start, output.end());
+    for(int h = 1; h * kFrequency < 0.5; h += 2)
+    {
+      double re = 0, im = 0;
+      for(size_t i = 0; i < n; i++)
+      {
+        re += residual[i] * std::cos(2 * kPi * h * kFrequency * i);
+        im += residual[i] * std::sin(2 * kPi * h * kFrequency * i);
+      }
+      for(size_t i = 0; i < n; i++)
+        residual[i] -= 2.0 / n * (re * std::cos(2 * kPi * h * kFrequency * i) + im * std::sin(2 * kPi * h * kFrequency * i));
+    }
+
+    double energy = 0;
+    for(auto s: residual)
+      energy += s * s;
+    return energy / n;
+  };
+
+  auto aliasing1x = measure(1);
+  auto aliasing8x = measure(8);
+
+  ASSERT_LT(aliasing8x * 10, aliasing1x);
+}
+
+// Oversampler - testFallback (block larger than setup => kernel at the host rate)
+TEST(Oversampler, testFallback)
+{
+  Oversampler<Sample32> oversampler{4};
+  oversampler.setup(1, 32);
+
+  Bus bus{1, 64};
+  int32 kernelSamples = 0;
+  auto buffers = bus.buffers();
+  ASSERT_FALSE(oversampler.process(buffers, buffers, [&kernelSamples](Sample32 s, int32) { kernelSamples++; return s; }));
+  ASSERT_EQ(64, kernelSamples);
+}
+
+// Oversampler - benchmarkProcess
+TEST(Oversampler, DISABLED_benchmarkProcess)
+{
+  constexpr int32 kBlockSize = 512;
+  constexpr int32 kIterations = 200;
+
+  for(int32 numChannels: {1, 2, 8})
+  {
+    for(int32 factor: {1, 2, 4, 8})
+    {
+      Oversampler<Sample32> oversampler{factor};
+      oversampler.setup(numChannels, kBlockSize);
+
+      Bus bus{numChannels, kBlockSize};
+      for(auto &samples: bus.fSamples)
+        for(int32 i = 0; i < kBlockSize; i++)
+          samples[i] = static_cast<Sample32>(std::sin(0.01 * i));
+
+      auto buffers = bus.buffers();
+      auto start = std::chrono::steady_clock::now();
+      for(int32 i = 0; i < kIterations; i++)
+        oversampler.process(buffers, buffers, [](Sample32 s, int32) { return std::tanh(s); });
+      auto time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / kIterations;
+
+      std::cout << "Oversampler " << factor << "x, " << numChannels << " channel(s), " << kBlockSize << " samples: "
+                << time << "us/block" << std::endl;
+    }
+  }
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+
+#include <pongasoft/VST/SharedObjectRegistry.h>
+#include <pongasoft/Utils/Collection/SPSCRingBuffer.h>
+#include <gtest/gtest.h>
+
+namespace pongasoft::VST::TestSharedObjectRegistry {
+
+using Ring = Utils::Collection::SPSCRingBuffer<float>;
+
+// SharedObjectRegistry - testShareAndFind
+TEST(SharedObjectRegistry, testShareAndFind)
+{
+  auto ring = std::make_shared<Ring>(64);
+
+  auto handle = SharedObjectRegistry::share(ring);
+  ASSERT_TRUE(handle.isValid());
+  ASSERT_EQ(SharedObjectRegistry::getProcessToken(), handle.fProcessToken);
+
+  // same process
+  ASSERT_EQ(ring, SharedObjectRegistry::find<Ring>(handle));
+
+  // wrong type
+  ASSERT_EQ(nullptr, SharedObjectRegistry::find<Utils::Collection::SPSCRingBuffer<double>>(handle));
+
+  // handle coming from another process
+  auto otherProcess = handle;
+  otherProcess.fProcessToken++;
+  ASSERT_EQ(nullptr, SharedObjectRegistry::find<Ring>(otherProcess));
+
+  // default handle
+  ASSERT_EQ(nullptr, SharedObjectRegistry::find<Ring>(SharedObjectHandle{}));
+
+  // the registry does not keep the object alive
+  auto ring2 = std::make_shared<Ring>(64);
+  auto handle2 = SharedObjectRegistry::share(ring2);
+  ASSERT_NE(handle, handle2);
+  ring2 = nullptr;
+  ASSERT_EQ(nullptr, SharedObjectRegistry::find<Ring>(handle2));
+
+  SharedObjectRegistry::unshare(handle);
+  ASSERT_EQ(nullptr, SharedObjectRegistry::find<Ring>(handle));
+}
+
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 pongasoft
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ *
+ * @author Yan Pujante
+ */
+#include <pongasoft/logging/rt_logging.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace pongasoft::logging::Test {
+
+// Implementation note: the tests use their own logger instead of RTLogger::instance() whose background thread may
+// be running (started by any RTProcessor initialized in the same process) and draining concurrently
+
+// RTLogger - testLogAndDrain
+TEST(RTLogger, testLogAndDrain)
+{
+  auto loggerPtr = std::make_unique<RTLogger>();
+  auto &logger = *loggerPtr;
+
+  ASSERT_EQ(0, logger.getLoggedCount());
+  ASSERT_EQ(0, logger.getDroppedCount());
+  ASSERT_EQ(0, logger.getTruncatedCount());
+
+  auto logged = logger.getLoggedCount();
+  auto dropped = logger.getDroppedCount();
+  auto truncated = logger.getTruncatedCount();
+
+  ASSERT_TRUE(logger.log(loguru::Verbosity_INFO, __FILE__, __LINE__, "value=%d/%f", 3, 0.5));
+  ASSERT_TRUE(logger.log(loguru::Verbosity_INFO, __FILE__, __LINE__, "%s", "second"));
+  ASSERT_EQ(logged + 2, logger.getLoggedCount());
+  ASSERT_EQ(2, logger.drain());
+  ASSERT_EQ(0, logger.drain());
+
+  // long message => truncated
+  std::string longMessage(RTLogger::kMessageSize * 2, 'x');
+  ASSERT_TRUE(logger.log(loguru::Verbosity_INFO, __FILE__, __LINE__, "%s", longMessage.c_str()));
+  ASSERT_EQ(truncated + 1, logger.getTruncatedCount());
+  ASSERT_EQ(1, logger.drain());
+
+  // fill the ring => drops the rest
+  for(uint64_t i = 0; i < RTLogger::kCapacity; i++)
+    ASSERT_TRUE(logger.log(loguru::Verbosity_INFO, __FILE__, __LINE__, "fill %d", static_cast<int>(i)));
+  ASSERT_FALSE(logger.log(loguru::Verbosity_INFO, __FILE__, __LINE__, "dropped"));
+  ASSERT_EQ(dropped + 1, logger.getDroppedCount());
+  ASSERT_EQ(static_cast<int>(RTLogger::kCapacity), logger.drain());
+  ASSERT_TRUE(logger.log(loguru::Verbosity_INFO, __FILE__, __LINE__, "room again"));
+  ASSERT_EQ(1, logger.drain());
+}
+
+// RTLogger - testMacro (the macro logs to the shared instance)
+TEST(RTLogger, testMacro)
+{
+  if(loguru::Verbosity_INFO > loguru::current_verbosity_cutoff())
+    GTEST_SKIP() << "INFO messages are filtered out";
+
+  auto logged = RTLogger::instance().getLoggedCount() + RTLogger::instance().getDroppedCount();
+  RTLOG_F(INFO, "%s", "macro");
+  ASSERT_EQ(logged + 1, RTLogger::instance().getLoggedCount() + RTLogger::instance().getDroppedCount());
+}
+
+// RTLogger - testMultipleProducers
+TEST(RTLogger, testMultipleProducers)
+{
+  auto loggerPtr = std::make_unique<RTLogger>();
+  auto &logger = *loggerPtr;
+
+  auto logged = logger.getLoggedCount();
+  auto dropped = logger.getDroppedCount();
+
+  constexpr int kNumThreads = 4;
+  constexpr int kNumMessages = 1000;
+
+  logger.start(1);
+
+  std::vector<std::thread> threads{};
+  for(int t = 0; t < kNumThreads; t++)
+  {
+    threads.emplace_back([&logger, t]() {
+      for(int i = 0; i < kNumMessages; i++)
+        logger.log(loguru::Verbosity_1, __FILE__, __LINE__, "thread %d / message %d", t, i);
+    });
+  }
+
+  for(auto &thread: threads)
+    thread.join();
+
+  logger.stop();
+  ASSERT_FALSE(logger.isStarted());
+
+  // every message was either logged or dropped and nothing is left in the ring
+  ASSERT_EQ(kNumThreads * kNumMessages,
+            (logger.getLoggedCount() - logged) + (logger.getDroppedCount() - dropped));
+  ASSERT_EQ(0, logger.drain());
+}
+
+// RTLogger - testAcquireRelease (the thread runs while there is at least one user)
+TEST(RTLogger, testAcquireRelease)
+{
+  auto loggerPtr = std::make_unique<RTLogger>();
+  auto &logger = *loggerPtr;
+
+  ASSERT_FALSE(logger.isStarted());
+
+  logger.acquire(1);
+  ASSERT_TRUE(logger.isStarted());
+  logger.acquire(1);
+  ASSERT_EQ(2, logger.getUserCount());
+
+  logger.release();
+  ASSERT_TRUE(logger.isStarted());
+
+  ASSERT_TRUE(logger.log(loguru::Verbosity_1, __FILE__, __LINE__, "drained on release"));
+
+  logger.release();
+  ASSERT_FALSE(logger.isStarted());
+  ASSERT_EQ(0, logger.getUserCount());
+
+  // stop drains whatever is left
+  ASSERT_EQ(0, logger.drain());
+
+  // unbalanced release => ignored
+  logger.release();
+  ASSERT_EQ(0, logger.getUserCount());
+  logger.acquire(1);
+  ASSERT_TRUE(logger.isStarted());
+  logger.release();
+  ASSERT_FALSE(logger.isStarted());
+}
+
+}